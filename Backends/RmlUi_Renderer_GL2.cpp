@@ -336,6 +336,48 @@ void RenderInterface_GL2::ReleaseTexture(Rml::TextureHandle texture_handle)
 	glDeleteTextures(1, (GLuint*)&texture_handle);
 }
 
+Rml::TextureHandle RenderInterface_GL2::GenerateAlphaTexture(Rml::Span<const Rml::byte> source, Rml::Vector2i source_dimensions)
+{
+	RMLUI_ASSERT(source.data() && source.size() == size_t(source_dimensions.x * source_dimensions.y));
+
+	GLuint texture_id = 0;
+	glGenTextures(1, &texture_id);
+	if (texture_id == 0)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Failed to generate texture.");
+		return {};
+	}
+
+	glBindTexture(GL_TEXTURE_2D, texture_id);
+
+	// Intensity textures replicate their single channel into all four channels, thereby sampling as premultiplied white.
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_INTENSITY8, source_dimensions.x, source_dimensions.y, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, source.data());
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+	return (Rml::TextureHandle)texture_id;
+}
+
+bool RenderInterface_GL2::UpdateTexture(Rml::TextureHandle texture_handle, Rml::Span<const Rml::byte> source, Rml::Rectanglei region)
+{
+	// Single-channel textures receive one byte per pixel, otherwise the data is in RGBA format.
+	const size_t num_pixels = size_t(region.Width() * region.Height());
+	RMLUI_ASSERT(source.data() && (source.size() == num_pixels || source.size() == num_pixels * 4));
+	const GLenum format = (source.size() == num_pixels ? GL_LUMINANCE : GL_RGBA);
+
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, region.Left(), region.Top(), region.Width(), region.Height(), format, GL_UNSIGNED_BYTE, source.data());
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	return true;
+}
+
 void RenderInterface_GL2::SetTransform(const Rml::Matrix4f* transform)
 {
 	transform_enabled = (transform != nullptr);
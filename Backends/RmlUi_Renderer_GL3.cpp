@@ -1307,6 +1307,63 @@ Rml::TextureHandle RenderInterface_GL3::GenerateTexture(Rml::Span<const Rml::byt
 	return (Rml::TextureHandle)texture_id;
 }
 
+Rml::TextureHandle RenderInterface_GL3::GenerateAlphaTexture(Rml::Span<const Rml::byte> source_data, Rml::Vector2i source_dimensions)
+{
+#ifdef RMLUI_PLATFORM_EMSCRIPTEN
+	// WebGL does not support texture swizzling, instead let RmlUi expand the data to RGBA.
+	(void)source_data;
+	(void)source_dimensions;
+	return {};
+#else
+	RMLUI_ASSERT(source_data.data() && source_data.size() == size_t(source_dimensions.x * source_dimensions.y));
+
+	GLuint texture_id = 0;
+	glGenTextures(1, &texture_id);
+	if (texture_id == 0)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Failed to generate texture.");
+		return {};
+	}
+
+	glBindTexture(GL_TEXTURE_2D, texture_id);
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, source_dimensions.x, source_dimensions.y, 0, GL_RED, GL_UNSIGNED_BYTE, source_data.data());
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	// Sample the single channel as premultiplied white by replicating it into all four channels.
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_RED);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_RED);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_RED);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	return (Rml::TextureHandle)texture_id;
+#endif
+}
+
+bool RenderInterface_GL3::UpdateTexture(Rml::TextureHandle texture_handle, Rml::Span<const Rml::byte> source_data, Rml::Rectanglei region)
+{
+	// Single-channel textures receive one byte per pixel, otherwise the data is in RGBA format.
+	const size_t num_pixels = size_t(region.Width() * region.Height());
+	RMLUI_ASSERT(source_data.data() && (source_data.size() == num_pixels || source_data.size() == num_pixels * 4));
+	const GLenum format = (source_data.size() == num_pixels ? GL_RED : GL_RGBA);
+
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, region.Left(), region.Top(), region.Width(), region.Height(), format, GL_UNSIGNED_BYTE, source_data.data());
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	return true;
+}
+
 void RenderInterface_GL3::DrawFullscreenQuad()
 {
 	RenderGeometry(fullscreen_quad_geometry, {}, RenderInterface_GL3::TexturePostprocess);
@@ -0,0 +1,1675 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "RmlUi_Renderer_Software.h"
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/DecorationTypes.h>
+#include <RmlUi/Core/FileInterface.h>
+#include <RmlUi/Core/Log.h>
+#include <RmlUi/Core/Math.h>
+#include <RmlUi/Core/SystemInterface.h>
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <string.h>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define RMLUI_SOFTWARE_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#include <arm_neon.h>
+	#define RMLUI_SOFTWARE_NEON
+#endif
+
+// The window is split into square tiles of this size, which are rasterized independently by the worker threads.
+#define RMLUI_SOFTWARE_TILE_SIZE 64
+
+#define MAX_NUM_STOPS 16
+
+namespace Software {
+
+using Rml::byte;
+using Rml::ColourbPremultiplied;
+using Rml::Vector4f;
+
+static const ColourbPremultiplied TransparentBlack = ColourbPremultiplied(0, 0);
+
+struct Texture {
+	Rml::Vector2i dimensions;
+	Rml::Vector<ColourbPremultiplied> pixels;
+	// Single-channel textures store only their alpha values here, representing premultiplied white.
+	Rml::Vector<byte> alpha;
+};
+
+struct Layer {
+	Rml::Vector<ColourbPremultiplied> pixels;
+};
+
+struct Geometry {
+	Rml::Span<const Rml::Vertex> vertices;
+	Rml::Span<const int> indices;
+};
+
+enum class FilterType { Invalid = 0, Passthrough, Blur, DropShadow, ColorMatrix, MaskImage };
+struct Filter {
+	FilterType type;
+
+	// Passthrough
+	float blend_factor;
+
+	// Blur
+	float sigma;
+
+	// Drop shadow
+	Rml::Vector2f offset;
+	ColourbPremultiplied color;
+
+	// ColorMatrix
+	Rml::Matrix4f color_matrix;
+};
+
+enum class ShaderType { Invalid = 0, Gradient, Creation };
+enum class GradientFunction { Linear, Radial, Conic, RepeatingLinear, RepeatingRadial, RepeatingConic };
+struct Shader {
+	ShaderType type;
+
+	// Gradient
+	GradientFunction gradient_function;
+	Rml::Vector2f p;
+	Rml::Vector2f v;
+	Rml::Vector<float> stop_positions;
+	Rml::Vector<Vector4f> stop_colors;
+
+	// Creation
+	Rml::Vector2f dimensions;
+};
+
+// The vertex attributes interpolated across triangles: inverse w-coordinate, color (RGBA), and texture coordinates (UV).
+enum { AttributeInvW, AttributeColor, AttributeTexCoord = AttributeColor + 4, NumAttributes = AttributeTexCoord + 2 };
+
+// A vertex transformed to window space. Its attributes are multiplied by the inverse w-coordinate, so that they can be interpolated
+// linearly in window space and then divided by the interpolated inverse w-coordinate for perspective-correct results.
+struct WindowVertex {
+	float x, y;
+	float attributes[NumAttributes];
+};
+
+enum class CommandType { Clear, Geometry, ClipMask, Composite };
+struct DrawCommand {
+	CommandType type;
+
+	// The window region affected by the command, already clipped to the scissor region and the viewport.
+	Rml::Rectanglei bounds;
+	Layer* target;
+
+	// Geometry and clip mask, the indices refer to window vertices of the frame data.
+	int index_begin;
+	int index_end;
+	Rml::ClipMaskOperation mask_operation;
+
+	// Geometry
+	const Texture* texture;
+	const Shader* shader;
+	float time;
+
+	// Composite
+	const Layer* source;
+	Rml::BlendMode blend_mode;
+
+	// Geometry and composite
+	bool clip_mask_test;
+	byte clip_mask_reference;
+};
+
+struct FrameData {
+	Rml::Vector<WindowVertex> vertices;
+	Rml::Vector<int> indices;
+	Rml::Vector<DrawCommand> commands;
+
+	// The indices of the commands affecting each tile, in submission order.
+	Rml::Vector<Rml::Vector<int>> tile_commands;
+
+	// Intermediate buffer used for blurring.
+	Rml::Vector<Vector4f> blur_buffer;
+};
+
+/*
+    Executes tasks on a fixed set of worker threads, with the calling thread participating in the work.
+*/
+class ThreadPool {
+public:
+	explicit ThreadPool(int num_threads)
+	{
+		for (int i = 1; i < num_threads; i++)
+			workers.emplace_back([this] { WorkerLoop(); });
+	}
+	~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			exit = true;
+		}
+		start_condition.notify_all();
+		for (std::thread& worker : workers)
+			worker.join();
+	}
+
+	int GetNumThreads() const { return (int)workers.size() + 1; }
+
+	// Calls the function for every task index in [0, num_tasks), and returns when all tasks are completed.
+	void Run(int num_tasks, const Rml::Function<void(int)>& function)
+	{
+		if (workers.empty() || num_tasks <= 1)
+		{
+			for (int i = 0; i < num_tasks; i++)
+				function(i);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			task_function = &function;
+			task_count = num_tasks;
+			next_task = 0;
+			num_busy_workers = (int)workers.size();
+			generation += 1;
+		}
+		start_condition.notify_all();
+
+		ExecuteTasks();
+
+		std::unique_lock<std::mutex> lock(mutex);
+		done_condition.wait(lock, [this] { return num_busy_workers == 0; });
+		task_function = nullptr;
+	}
+
+private:
+	void WorkerLoop()
+	{
+		unsigned int last_generation = 0;
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				start_condition.wait(lock, [&] { return exit || generation != last_generation; });
+				if (exit)
+					return;
+				last_generation = generation;
+			}
+
+			ExecuteTasks();
+
+			std::lock_guard<std::mutex> lock(mutex);
+			num_busy_workers -= 1;
+			if (num_busy_workers == 0)
+				done_condition.notify_one();
+		}
+	}
+
+	void ExecuteTasks()
+	{
+		for (int i = next_task++; i < task_count; i = next_task++)
+			(*task_function)(i);
+	}
+
+	Rml::Vector<std::thread> workers;
+
+	std::mutex mutex;
+	std::condition_variable start_condition;
+	std::condition_variable done_condition;
+
+	const Rml::Function<void(int)>* task_function = nullptr;
+	int task_count = 0;
+	std::atomic<int> next_task{0};
+	int num_busy_workers = 0;
+	unsigned int generation = 0;
+	bool exit = false;
+};
+
+static inline Vector4f Multiply(const Vector4f& a, const Vector4f& b)
+{
+	return {a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w};
+}
+
+static inline Vector4f ToVector(ColourbPremultiplied c)
+{
+	constexpr float scale = 1.f / 255.f;
+	return {scale * float(c.red), scale * float(c.green), scale * float(c.blue), scale * float(c.alpha)};
+}
+
+static inline byte ToByte(float value)
+{
+	return byte(Rml::Math::Clamp(value * 255.f + 0.5f, 0.f, 255.f));
+}
+
+static inline ColourbPremultiplied ToColour(const Vector4f& c)
+{
+	return ColourbPremultiplied(ToByte(c.x), ToByte(c.y), ToByte(c.z), ToByte(c.w));
+}
+
+// Blends the source color onto the destination, using premultiplied alpha.
+static inline void BlendPixel(ColourbPremultiplied& destination, const Vector4f& source)
+{
+	if (source.w >= 1.f)
+	{
+		destination = ToColour(source);
+		return;
+	}
+	const Vector4f result = source + ToVector(destination) * (1.f - source.w);
+	destination = ToColour(result);
+}
+
+static inline void BlendPixel(ColourbPremultiplied& destination, ColourbPremultiplied source)
+{
+	if (source.alpha == 255 || destination.alpha == 0)
+		destination = source;
+	else if (source.alpha != 0)
+		BlendPixel(destination, ToVector(source));
+}
+
+#if defined(RMLUI_SOFTWARE_SSE2)
+// Blends one pixel in premultiplied alpha, with its channels stored as 32-bit integers. Performs the same operations as BlendPixel().
+static inline __m128i BlendPixel4(__m128i source, __m128i destination)
+{
+	const __m128 scale = _mm_set1_ps(1.f / 255.f);
+	const __m128 s = _mm_mul_ps(scale, _mm_cvtepi32_ps(source));
+	const __m128 d = _mm_mul_ps(scale, _mm_cvtepi32_ps(destination));
+	const __m128 inv_alpha = _mm_sub_ps(_mm_set1_ps(1.f), _mm_shuffle_ps(s, s, _MM_SHUFFLE(3, 3, 3, 3)));
+	const __m128 result = _mm_add_ps(s, _mm_mul_ps(d, inv_alpha));
+	const __m128 max = _mm_set1_ps(255.f);
+	return _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(result, max), _mm_set1_ps(0.5f)), _mm_setzero_ps()), max));
+}
+#elif defined(RMLUI_SOFTWARE_NEON)
+static inline uint32x4_t BlendPixel4(uint32x4_t source, uint32x4_t destination)
+{
+	const float32x4_t scale = vdupq_n_f32(1.f / 255.f);
+	const float32x4_t s = vmulq_f32(scale, vcvtq_f32_u32(source));
+	const float32x4_t d = vmulq_f32(scale, vcvtq_f32_u32(destination));
+	const float32x4_t inv_alpha = vsubq_f32(vdupq_n_f32(1.f), vdupq_n_f32(vgetq_lane_f32(s, 3)));
+	const float32x4_t result = vaddq_f32(s, vmulq_f32(d, inv_alpha));
+	const float32x4_t max = vdupq_n_f32(255.f);
+	return vcvtq_u32_f32(vminq_f32(vmaxq_f32(vaddq_f32(vmulq_f32(result, max), vdupq_n_f32(0.5f)), vdupq_n_f32(0.f)), max));
+}
+#endif
+
+// Blends the row of source pixels onto the destination row, with the same result as calling BlendPixel() for each pixel.
+static void BlendRow(ColourbPremultiplied* destination, const ColourbPremultiplied* source, int count)
+{
+	int i = 0;
+#if defined(RMLUI_SOFTWARE_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+		const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i));
+
+		// Select the source where it is opaque or the destination is empty, and keep the destination where the source is empty.
+		const __m128i s_alpha = _mm_srli_epi32(s, 24);
+		const __m128i copy = _mm_or_si128(_mm_cmpeq_epi32(s_alpha, _mm_set1_epi32(255)), _mm_cmpeq_epi32(_mm_srli_epi32(d, 24), zero));
+		const __m128i keep = _mm_andnot_si128(copy, _mm_cmpeq_epi32(s_alpha, zero));
+		const __m128i selected = _mm_or_si128(_mm_and_si128(copy, s), _mm_and_si128(keep, d));
+		const __m128i blend = _mm_andnot_si128(_mm_or_si128(copy, keep), _mm_set1_epi32(-1));
+
+		if (_mm_movemask_epi8(blend) == 0)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), selected);
+			continue;
+		}
+
+		const __m128i s_low = _mm_unpacklo_epi8(s, zero), s_high = _mm_unpackhi_epi8(s, zero);
+		const __m128i d_low = _mm_unpacklo_epi8(d, zero), d_high = _mm_unpackhi_epi8(d, zero);
+		const __m128i p0 = BlendPixel4(_mm_unpacklo_epi16(s_low, zero), _mm_unpacklo_epi16(d_low, zero));
+		const __m128i p1 = BlendPixel4(_mm_unpackhi_epi16(s_low, zero), _mm_unpackhi_epi16(d_low, zero));
+		const __m128i p2 = BlendPixel4(_mm_unpacklo_epi16(s_high, zero), _mm_unpacklo_epi16(d_high, zero));
+		const __m128i p3 = BlendPixel4(_mm_unpackhi_epi16(s_high, zero), _mm_unpackhi_epi16(d_high, zero));
+		const __m128i blended = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_or_si128(selected, _mm_and_si128(blend, blended)));
+	}
+#elif defined(RMLUI_SOFTWARE_NEON)
+	const uint32x4_t zero = vdupq_n_u32(0);
+	for (; i + 4 <= count; i += 4)
+	{
+		const uint8x16_t s = vld1q_u8(reinterpret_cast<const uint8_t*>(source + i));
+		const uint8x16_t d = vld1q_u8(reinterpret_cast<const uint8_t*>(destination + i));
+		const uint32x4_t s32 = vreinterpretq_u32_u8(s);
+		const uint32x4_t d32 = vreinterpretq_u32_u8(d);
+
+		// Select the source where it is opaque or the destination is empty, and keep the destination where the source is empty.
+		const uint32x4_t s_alpha = vshrq_n_u32(s32, 24);
+		const uint32x4_t copy = vorrq_u32(vceqq_u32(s_alpha, vdupq_n_u32(255)), vceqq_u32(vshrq_n_u32(d32, 24), zero));
+		const uint32x4_t keep = vbicq_u32(vceqq_u32(s_alpha, zero), copy);
+		const uint32x4_t selected = vbslq_u32(copy, s32, d32);
+		const uint64x2_t selected_mask = vreinterpretq_u64_u32(vorrq_u32(copy, keep));
+
+		if ((vgetq_lane_u64(selected_mask, 0) & vgetq_lane_u64(selected_mask, 1)) == ~uint64_t(0))
+		{
+			vst1q_u32(reinterpret_cast<uint32_t*>(destination + i), selected);
+			continue;
+		}
+
+		const uint16x8_t s_low = vmovl_u8(vget_low_u8(s)), s_high = vmovl_u8(vget_high_u8(s));
+		const uint16x8_t d_low = vmovl_u8(vget_low_u8(d)), d_high = vmovl_u8(vget_high_u8(d));
+		const uint32x4_t p0 = BlendPixel4(vmovl_u16(vget_low_u16(s_low)), vmovl_u16(vget_low_u16(d_low)));
+		const uint32x4_t p1 = BlendPixel4(vmovl_u16(vget_high_u16(s_low)), vmovl_u16(vget_high_u16(d_low)));
+		const uint32x4_t p2 = BlendPixel4(vmovl_u16(vget_low_u16(s_high)), vmovl_u16(vget_low_u16(d_high)));
+		const uint32x4_t p3 = BlendPixel4(vmovl_u16(vget_high_u16(s_high)), vmovl_u16(vget_high_u16(d_high)));
+		const uint8x16_t blended =
+			vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(p0), vmovn_u32(p1))), vmovn_u16(vcombine_u16(vmovn_u32(p2), vmovn_u32(p3))));
+
+		vst1q_u32(reinterpret_cast<uint32_t*>(destination + i), vbslq_u32(vorrq_u32(copy, keep), selected, vreinterpretq_u32_u8(blended)));
+	}
+#endif
+	for (; i < count; i++)
+		BlendPixel(destination[i], source[i]);
+}
+
+// Rounds down to an integer, avoids a library call to floor() when not compiling for SSE 4.1 or later.
+static inline int FastFloor(float value)
+{
+	const int truncated = int(value);
+	return truncated - int(value < float(truncated));
+}
+
+static inline Vector4f FetchTexel(const Texture& texture, int index)
+{
+	if (!texture.alpha.empty())
+	{
+		const float value = (1.f / 255.f) * float(texture.alpha[index]);
+		return {value, value, value, value};
+	}
+	return ToVector(texture.pixels[index]);
+}
+
+// Bilinear texture lookup with repeat wrapping.
+static Vector4f SampleTexture(const Texture& texture, Rml::Vector2f tex_coord)
+{
+	const int width = texture.dimensions.x;
+	const int height = texture.dimensions.y;
+
+	// Wrap the coordinates before scaling them, so that the texel indices are at most one off from the texture bounds.
+	const float x = (tex_coord.x - float(FastFloor(tex_coord.x))) * float(width) - 0.5f;
+	const float y = (tex_coord.y - float(FastFloor(tex_coord.y))) * float(height) - 0.5f;
+	const int x_floor = FastFloor(x);
+	const int y_floor = FastFloor(y);
+	const float fx = x - float(x_floor);
+	const float fy = y - float(y_floor);
+
+	const int x0 = (x_floor < 0 ? width - 1 : Rml::Math::Min(x_floor, width - 1));
+	const int y0 = (y_floor < 0 ? height - 1 : Rml::Math::Min(y_floor, height - 1));
+	const int row0 = y0 * width;
+
+	// Fast path for lookups at texel centers, which is common for unscaled images and text.
+	if (fx < 1e-3f && fy < 1e-3f)
+		return FetchTexel(texture, row0 + x0);
+
+	const int x1 = (x0 + 1 == width ? 0 : x0 + 1);
+	const int y1 = (y0 + 1 == height ? 0 : y0 + 1);
+	const int row1 = y1 * width;
+
+	const Vector4f top = FetchTexel(texture, row0 + x0) * (1.f - fx) + FetchTexel(texture, row0 + x1) * fx;
+	const Vector4f bottom = FetchTexel(texture, row1 + x0) * (1.f - fx) + FetchTexel(texture, row1 + x1) * fx;
+	return top * (1.f - fy) + bottom * fy;
+}
+
+static inline float SmoothStep(float edge0, float edge1, float x)
+{
+	if (edge1 <= edge0)
+		return x < edge0 ? 0.f : 1.f;
+	const float t = Rml::Math::Clamp((x - edge0) / (edge1 - edge0), 0.f, 1.f);
+	return t * t * (3.f - 2.f * t);
+}
+
+static Vector4f ShadeGradient(const Shader& shader, Rml::Vector2f position)
+{
+	float t = 0.f;
+	const Rml::Vector2f V = position - shader.p;
+
+	switch (shader.gradient_function)
+	{
+	case GradientFunction::Linear:
+	case GradientFunction::RepeatingLinear:
+	{
+		const float dist_square = shader.v.DotProduct(shader.v);
+		t = shader.v.DotProduct(V) / dist_square;
+	}
+	break;
+	case GradientFunction::Radial:
+	case GradientFunction::RepeatingRadial:
+	{
+		t = Rml::Vector2f(shader.v.x * V.x, shader.v.y * V.y).Magnitude();
+	}
+	break;
+	case GradientFunction::Conic:
+	case GradientFunction::RepeatingConic:
+	{
+		const Rml::Vector2f R = {shader.v.x * V.x + shader.v.y * V.y, -shader.v.y * V.x + shader.v.x * V.y};
+		t = 0.5f + std::atan2(-R.x, R.y) / (2.f * Rml::Math::RMLUI_PI);
+	}
+	break;
+	}
+
+	const int num_stops = (int)shader.stop_positions.size();
+	if (shader.gradient_function == GradientFunction::RepeatingLinear || shader.gradient_function == GradientFunction::RepeatingRadial ||
+		shader.gradient_function == GradientFunction::RepeatingConic)
+	{
+		const float t0 = shader.stop_positions[0];
+		const float t1 = shader.stop_positions[num_stops - 1];
+		const float range = t1 - t0;
+		if (range > 0.f)
+			t = t0 + (t - t0) - range * float(FastFloor((t - t0) / range));
+	}
+
+	Vector4f color = shader.stop_colors[0];
+	for (int i = 1; i < num_stops; i++)
+	{
+		const float f = SmoothStep(shader.stop_positions[i - 1], shader.stop_positions[i], t);
+		color = color * (1.f - f) + shader.stop_colors[i] * f;
+	}
+	return color;
+}
+
+// "Creation" by Danilo Guanabara, based on: https://www.shadertoy.com/view/XsXXDn
+static Vector4f ShadeCreation(const Shader& shader, float time, Rml::Vector2f tex_coord, float alpha)
+{
+	float c[3];
+	float l = 0.f;
+	for (int i = 0; i < 3; i++)
+	{
+		Rml::Vector2f p = tex_coord;
+		Rml::Vector2f uv = p;
+		p -= Rml::Vector2f(0.5f);
+		p.x *= shader.dimensions.x / shader.dimensions.y;
+		const float z = time + float(i) * 0.07f;
+		l = p.Magnitude();
+		uv += p / l * (std::sin(z) + 1.f) * std::abs(std::sin(l * 9.f - z - z));
+		const Rml::Vector2f cell = {uv.x - float(FastFloor(uv.x)) - 0.5f, uv.y - float(FastFloor(uv.y)) - 0.5f};
+		c[i] = 0.01f / cell.Magnitude();
+	}
+	return {c[0] / l, c[1] / l, c[2] / l, alpha};
+}
+
+struct Edge {
+	Edge(const WindowVertex& a, const WindowVertex& b, float x, float y) :
+		step_x(a.y - b.y), step_y(b.x - a.x), value((b.x - a.x) * (y - a.y) - (b.y - a.y) * (x - a.x)),
+		// Top-left fill rule: pixel centers exactly on an edge belong to only one of the two triangles sharing it.
+		inclusive(a.y < b.y || (a.y == b.y && b.x < a.x))
+	{}
+	bool Inside(float edge_value) const { return edge_value > 0.f || (edge_value == 0.f && inclusive); }
+
+	float step_x, step_y;
+	float value;
+	bool inclusive;
+};
+
+/*
+    Rasterizes the triangle within the region, one horizontal span of covered pixels at a time.
+
+    For each span, the span function is called with the row, the span's pixel range, and the interpolated attributes at the
+    center of its first pixel. The attributes are linear in window space, and can be stepped to the next pixel by adding the
+    given derivatives.
+*/
+template <typename SpanFunction>
+static void RasterizeTriangle(const WindowVertex& v0, const WindowVertex& v1, const WindowVertex& v2, Rml::Rectanglei region,
+	SpanFunction&& span_function)
+{
+	if (v0.attributes[AttributeInvW] <= 0.f || v1.attributes[AttributeInvW] <= 0.f || v2.attributes[AttributeInvW] <= 0.f)
+		return;
+
+	const float area = (v1.x - v0.x) * (v2.y - v0.y) - (v2.x - v0.x) * (v1.y - v0.y);
+	if (area == 0.f || !std::isfinite(area))
+		return;
+
+	// Make the edge functions positive inside the triangle regardless of its winding order.
+	const bool clockwise = (area > 0.f);
+	const WindowVertex& a = v0;
+	const WindowVertex& b = (clockwise ? v1 : v2);
+	const WindowVertex& c = (clockwise ? v2 : v1);
+
+	const int x_min = Rml::Math::Max(region.Left(), FastFloor(std::min({a.x, b.x, c.x})));
+	const int y_min = Rml::Math::Max(region.Top(), FastFloor(std::min({a.y, b.y, c.y})));
+	const int x_max = Rml::Math::Min(region.Right(), -FastFloor(-std::max({a.x, b.x, c.x})));
+	const int y_max = Rml::Math::Min(region.Bottom(), -FastFloor(-std::max({a.y, b.y, c.y})));
+	if (x_min >= x_max || y_min >= y_max)
+		return;
+
+	// Edge functions evaluated at the center of the first pixel, each one is proportional to the barycentric weight of the opposite vertex.
+	const float x_start = float(x_min) + 0.5f;
+	const float y_start = float(y_min) + 0.5f;
+	const Edge e0(b, c, x_start, y_start);
+	const Edge e1(c, a, x_start, y_start);
+	const Edge e2(a, b, x_start, y_start);
+
+	// Set up the plane equation of each attribute from its barycentric interpolation.
+	const float inv_area = 1.f / Rml::Math::Absolute(area);
+	float attributes_origin[NumAttributes], attributes_dx[NumAttributes], attributes_dy[NumAttributes];
+	for (int i = 0; i < NumAttributes; i++)
+	{
+		const float a0 = a.attributes[i], a1 = b.attributes[i], a2 = c.attributes[i];
+		attributes_origin[i] = (a0 * e0.value + a1 * e1.value + a2 * e2.value) * inv_area;
+		attributes_dx[i] = (a0 * e0.step_x + a1 * e1.step_x + a2 * e2.step_x) * inv_area;
+		attributes_dy[i] = (a0 * e0.step_y + a1 * e1.step_y + a2 * e2.step_y) * inv_area;
+	}
+
+	float attributes[NumAttributes];
+	for (int y = y_min; y < y_max; y++)
+	{
+		const float dy = float(y - y_min);
+		float w0 = e0.value + dy * e0.step_y;
+		float w1 = e1.value + dy * e1.step_y;
+		float w2 = e2.value + dy * e2.step_y;
+
+		// The covered pixels of a row are contiguous since the triangle is convex, find the first and the last one.
+		int x = x_min;
+		for (; x < x_max && !(e0.Inside(w0) && e1.Inside(w1) && e2.Inside(w2)); x++)
+		{
+			w0 += e0.step_x;
+			w1 += e1.step_x;
+			w2 += e2.step_x;
+		}
+		const int x_begin = x;
+		for (; x < x_max && (e0.Inside(w0) && e1.Inside(w1) && e2.Inside(w2)); x++)
+		{
+			w0 += e0.step_x;
+			w1 += e1.step_x;
+			w2 += e2.step_x;
+		}
+		const int x_end = x;
+
+		if (x_begin < x_end)
+		{
+			const float dx = float(x_begin - x_min);
+			for (int i = 0; i < NumAttributes; i++)
+				attributes[i] = attributes_origin[i] + dx * attributes_dx[i] + dy * attributes_dy[i];
+			span_function(y, x_begin, x_end, attributes, attributes_dx);
+		}
+	}
+}
+
+static void ExecuteGeometryCommand(const FrameData& frame, const DrawCommand& command, Rml::Rectanglei region, byte* clip_mask, int width)
+{
+	const WindowVertex* vertices = frame.vertices.data();
+	const int* indices = frame.indices.data();
+
+	if (command.type == CommandType::ClipMask)
+	{
+		const bool increment = (command.mask_operation == Rml::ClipMaskOperation::Intersect);
+		for (int i = command.index_begin; i + 2 < command.index_end; i += 3)
+		{
+			RasterizeTriangle(vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]], region,
+				[&](int y, int x_begin, int x_end, const float* /*attributes*/, const float* /*attributes_dx*/) {
+					byte* mask_row = clip_mask + y * width;
+					if (increment)
+					{
+						for (int x = x_begin; x < x_end; x++)
+							mask_row[x] += 1;
+					}
+					else
+						std::fill(mask_row + x_begin, mask_row + x_end, byte(1));
+				});
+		}
+		return;
+	}
+
+	ColourbPremultiplied* const target = command.target->pixels.data();
+	const Texture* const texture = command.texture;
+	const Shader* const shader = command.shader;
+	const bool clip_mask_test = command.clip_mask_test;
+	const byte clip_mask_reference = command.clip_mask_reference;
+	const float time = command.time;
+
+	auto ShadeSpan = [=](int y, int x_begin, int x_end, const float* span_attributes, const float* attributes_dx) {
+		// Keep the state in local variables, writes to the render target could otherwise alias anything.
+		float attributes[NumAttributes];
+		std::copy_n(span_attributes, NumAttributes, attributes);
+		float dx[NumAttributes];
+		std::copy_n(attributes_dx, NumAttributes, dx);
+
+		ColourbPremultiplied* target_row = target + y * width;
+		const byte* mask_row = clip_mask + y * width;
+
+		for (int x = x_begin; x < x_end; x++)
+		{
+			if (!clip_mask_test || mask_row[x] == clip_mask_reference)
+			{
+				const float k = 1.f / attributes[AttributeInvW];
+				Vector4f color = {attributes[AttributeColor] * k, attributes[AttributeColor + 1] * k, attributes[AttributeColor + 2] * k,
+					attributes[AttributeColor + 3] * k};
+
+				if (texture || shader)
+				{
+					const Rml::Vector2f tex_coord = {attributes[AttributeTexCoord] * k, attributes[AttributeTexCoord + 1] * k};
+					if (shader && shader->type == ShaderType::Gradient)
+						color = Multiply(color, ShadeGradient(*shader, tex_coord));
+					else if (shader && shader->type == ShaderType::Creation)
+						color = ShadeCreation(*shader, time, tex_coord, color.w);
+					else if (texture)
+						color = Multiply(color, SampleTexture(*texture, tex_coord));
+				}
+
+				if (color.w > 0.f || color.x > 0.f || color.y > 0.f || color.z > 0.f)
+					BlendPixel(target_row[x], color);
+			}
+
+			for (int i = 0; i < NumAttributes; i++)
+				attributes[i] += dx[i];
+		}
+	};
+
+	for (int i = command.index_begin; i + 2 < command.index_end; i += 3)
+		RasterizeTriangle(vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]], region, ShadeSpan);
+}
+
+static void ExecuteCommand(const FrameData& frame, const DrawCommand& command, Rml::Rectanglei region, byte* clip_mask, int width)
+{
+	switch (command.type)
+	{
+	case CommandType::Clear:
+	{
+		ColourbPremultiplied* target = command.target->pixels.data();
+		for (int y = region.Top(); y < region.Bottom(); y++)
+			std::fill(target + y * width + region.Left(), target + y * width + region.Right(), TransparentBlack);
+	}
+	break;
+	case CommandType::ClipMask:
+	{
+		if (command.mask_operation != Rml::ClipMaskOperation::Intersect)
+		{
+			for (int y = region.Top(); y < region.Bottom(); y++)
+				std::fill(clip_mask + y * width + region.Left(), clip_mask + y * width + region.Right(), byte(0));
+		}
+		ExecuteGeometryCommand(frame, command, region, clip_mask, width);
+	}
+	break;
+	case CommandType::Geometry:
+	{
+		ExecuteGeometryCommand(frame, command, region, clip_mask, width);
+	}
+	break;
+	case CommandType::Composite:
+	{
+		ColourbPremultiplied* target = command.target->pixels.data();
+		const ColourbPremultiplied* source = command.source->pixels.data();
+		if (!command.clip_mask_test)
+		{
+			for (int y = region.Top(); y < region.Bottom(); y++)
+			{
+				const int offset = y * width + region.Left();
+				if (command.blend_mode == Rml::BlendMode::Replace)
+					std::copy_n(source + offset, region.Width(), target + offset);
+				else
+					BlendRow(target + offset, source + offset, region.Width());
+			}
+			break;
+		}
+
+		for (int y = region.Top(); y < region.Bottom(); y++)
+		{
+			for (int x = region.Left(); x < region.Right(); x++)
+			{
+				const int index = y * width + x;
+				if (command.clip_mask_test && clip_mask[index] != command.clip_mask_reference)
+					continue;
+				if (command.blend_mode == Rml::BlendMode::Replace)
+					target[index] = source[index];
+				else
+					BlendPixel(target[index], source[index]);
+			}
+		}
+	}
+	break;
+	}
+}
+
+// Determines the sizes of three consecutive box filters approximating a gaussian blur with the given standard deviation.
+static void SigmaToBoxSizes(float sigma, int (&box_sizes)[3])
+{
+	constexpr int num_boxes = 3;
+	const float ideal_width = Rml::Math::SquareRoot(12.f * sigma * sigma / float(num_boxes) + 1.f);
+	int lower_width = int(ideal_width);
+	if (lower_width % 2 == 0)
+		lower_width -= 1;
+	const int upper_width = lower_width + 2;
+
+	const float ideal_num_lower = (12.f * sigma * sigma - float(num_boxes * lower_width * lower_width + 4 * num_boxes * lower_width + 3 * num_boxes)) /
+		float(-4 * lower_width - 4);
+	const int num_lower = Rml::Math::RoundToInteger(ideal_num_lower);
+
+	for (int i = 0; i < num_boxes; i++)
+		box_sizes[i] = (i < num_lower ? lower_width : upper_width);
+}
+
+// Box filter along a line of colors, clamping lookups outside the line to the nearest edge.
+static void BoxBlurLine(Vector4f* line, Vector4f* temp, int size, int radius)
+{
+	if (radius <= 0 || size <= 0)
+		return;
+
+	const float scale = 1.f / float(2 * radius + 1);
+
+#if defined(RMLUI_SOFTWARE_SSE2)
+	const __m128 scale4 = _mm_set1_ps(scale);
+	__m128 sum4 = _mm_mul_ps(_mm_loadu_ps(&line[0].x), _mm_set1_ps(float(radius + 1)));
+	for (int i = 1; i <= radius; i++)
+		sum4 = _mm_add_ps(sum4, _mm_loadu_ps(&line[Rml::Math::Min(i, size - 1)].x));
+
+	for (int i = 0; i < size; i++)
+	{
+		_mm_storeu_ps(&temp[i].x, _mm_mul_ps(sum4, scale4));
+		sum4 = _mm_add_ps(sum4, _mm_loadu_ps(&line[Rml::Math::Min(i + radius + 1, size - 1)].x));
+		sum4 = _mm_sub_ps(sum4, _mm_loadu_ps(&line[Rml::Math::Max(i - radius, 0)].x));
+	}
+#elif defined(RMLUI_SOFTWARE_NEON)
+	const float32x4_t scale4 = vdupq_n_f32(scale);
+	float32x4_t sum4 = vmulq_f32(vld1q_f32(&line[0].x), vdupq_n_f32(float(radius + 1)));
+	for (int i = 1; i <= radius; i++)
+		sum4 = vaddq_f32(sum4, vld1q_f32(&line[Rml::Math::Min(i, size - 1)].x));
+
+	for (int i = 0; i < size; i++)
+	{
+		vst1q_f32(&temp[i].x, vmulq_f32(sum4, scale4));
+		sum4 = vaddq_f32(sum4, vld1q_f32(&line[Rml::Math::Min(i + radius + 1, size - 1)].x));
+		sum4 = vsubq_f32(sum4, vld1q_f32(&line[Rml::Math::Max(i - radius, 0)].x));
+	}
+#else
+	Vector4f sum = line[0] * float(radius + 1);
+	for (int i = 1; i <= radius; i++)
+		sum += line[Rml::Math::Min(i, size - 1)];
+
+	for (int i = 0; i < size; i++)
+	{
+		temp[i] = sum * scale;
+		sum += line[Rml::Math::Min(i + radius + 1, size - 1)];
+		sum -= line[Rml::Math::Max(i - radius, 0)];
+	}
+#endif
+
+	std::copy(temp, temp + size, line);
+}
+
+} // namespace Software
+
+using namespace Software;
+
+static Rml::Rectanglei MakeBounds(Rml::Vector2f min, Rml::Vector2f max)
+{
+	return Rml::Rectanglei::FromCorners(Rml::Vector2i(int(std::floor(min.x)), int(std::floor(min.y))),
+		Rml::Vector2i(int(std::ceil(max.x)), int(std::ceil(max.y))));
+}
+
+static bool IsEmpty(Rml::Rectanglei rectangle)
+{
+	return rectangle.Width() <= 0 || rectangle.Height() <= 0;
+}
+
+RenderInterface_Software::RenderInterface_Software(int num_threads)
+{
+	if (num_threads <= 0)
+		num_threads = Rml::Math::Max((int)std::thread::hardware_concurrency(), 1);
+
+	thread_pool = Rml::MakeUnique<ThreadPool>(num_threads);
+	frame_data = Rml::MakeUnique<FrameData>();
+	postprocess_primary = Rml::MakeUnique<Layer>();
+	postprocess_secondary = Rml::MakeUnique<Layer>();
+	blend_mask = Rml::MakeUnique<Layer>();
+}
+
+RenderInterface_Software::~RenderInterface_Software() {}
+
+void RenderInterface_Software::SetViewport(int width, int height)
+{
+	viewport_width = Rml::Math::Max(width, 1);
+	viewport_height = Rml::Math::Max(height, 1);
+}
+
+void RenderInterface_Software::BeginFrame()
+{
+	RMLUI_ASSERT(viewport_width >= 1 && viewport_height >= 1);
+	RMLUI_ASSERT(frame_data->commands.empty());
+
+	const size_t num_pixels = size_t(viewport_width * viewport_height);
+	auto ResizeLayer = [num_pixels](Layer& layer) {
+		if (layer.pixels.size() != num_pixels)
+			layer.pixels.assign(num_pixels, TransparentBlack);
+	};
+
+	for (auto& layer : layers)
+		ResizeLayer(*layer);
+	ResizeLayer(*postprocess_primary);
+	ResizeLayer(*postprocess_secondary);
+	ResizeLayer(*blend_mask);
+	clip_mask.assign(num_pixels, byte(0));
+
+	scissor_region = Rml::Rectanglei::MakeInvalid();
+	clip_mask_enabled = false;
+	clip_mask_reference = 0;
+	transform_active = false;
+
+	num_active_layers = 0;
+	PushLayer();
+}
+
+void RenderInterface_Software::EndFrame()
+{
+	RMLUI_ASSERT(num_active_layers == 1);
+	Flush();
+
+	frame_size = {viewport_width, viewport_height};
+	frame_pixels = GetLayer(0).pixels;
+}
+
+Rml::Vector2i RenderInterface_Software::GetFrameSize() const
+{
+	return frame_size;
+}
+
+Rml::Span<const Rml::ColourbPremultiplied> RenderInterface_Software::GetFramePixels() const
+{
+	return {frame_pixels.data(), frame_pixels.size()};
+}
+
+Rml::CompiledGeometryHandle RenderInterface_Software::CompileGeometry(Rml::Span<const Rml::Vertex> vertices, Rml::Span<const int> indices)
+{
+	// The vertex and index data are guaranteed to be valid until the geometry is released, so we don't need to copy them.
+	Geometry* geometry = new Geometry{vertices, indices};
+	return reinterpret_cast<Rml::CompiledGeometryHandle>(geometry);
+}
+
+void RenderInterface_Software::RenderGeometry(Rml::CompiledGeometryHandle handle, Rml::Vector2f translation, Rml::TextureHandle texture)
+{
+	SubmitGeometry(handle, translation, reinterpret_cast<const Texture*>(texture), nullptr, false, {});
+}
+
+void RenderInterface_Software::ReleaseGeometry(Rml::CompiledGeometryHandle handle)
+{
+	// Queued commands only refer to the transformed copies of the vertices, so the geometry can be released immediately.
+	delete reinterpret_cast<Geometry*>(handle);
+}
+
+void RenderInterface_Software::SubmitGeometry(Rml::CompiledGeometryHandle handle, Rml::Vector2f translation, const Texture* texture,
+	const void* shader, bool to_clip_mask, Rml::ClipMaskOperation mask_operation)
+{
+	const Geometry& geometry = *reinterpret_cast<const Geometry*>(handle);
+	FrameData& frame = *frame_data;
+
+	const Rml::Rectanglei region = GetScissorRegion();
+	if (IsEmpty(region) && !to_clip_mask)
+		return;
+
+	const int base_vertex = (int)frame.vertices.size();
+	const int index_begin = (int)frame.indices.size();
+
+	Rml::Vector2f min(FLT_MAX), max(-FLT_MAX);
+	for (const Rml::Vertex& vertex : geometry.vertices)
+	{
+		WindowVertex window_vertex;
+		const Rml::Vector2f position = vertex.position + translation;
+		float inv_w = 1.f;
+		if (transform_active)
+		{
+			const Rml::Vector4f clip_position = transform * Rml::Vector4f(position.x, position.y, 0.f, 1.f);
+			inv_w = (clip_position.w > 1e-6f ? 1.f / clip_position.w : 0.f);
+			window_vertex.x = clip_position.x * inv_w;
+			window_vertex.y = clip_position.y * inv_w;
+		}
+		else
+		{
+			window_vertex.x = position.x;
+			window_vertex.y = position.y;
+		}
+
+		const Vector4f color = ToVector(vertex.colour);
+		window_vertex.attributes[AttributeInvW] = inv_w;
+		window_vertex.attributes[AttributeColor] = color.x * inv_w;
+		window_vertex.attributes[AttributeColor + 1] = color.y * inv_w;
+		window_vertex.attributes[AttributeColor + 2] = color.z * inv_w;
+		window_vertex.attributes[AttributeColor + 3] = color.w * inv_w;
+		window_vertex.attributes[AttributeTexCoord] = vertex.tex_coord.x * inv_w;
+		window_vertex.attributes[AttributeTexCoord + 1] = vertex.tex_coord.y * inv_w;
+
+		if (inv_w > 0.f)
+		{
+			min = Rml::Math::Min(min, Rml::Vector2f(window_vertex.x, window_vertex.y));
+			max = Rml::Math::Max(max, Rml::Vector2f(window_vertex.x, window_vertex.y));
+		}
+		frame.vertices.push_back(window_vertex);
+	}
+
+	for (int index : geometry.indices)
+		frame.indices.push_back(base_vertex + index);
+
+	DrawCommand command = {};
+	command.type = (to_clip_mask ? CommandType::ClipMask : CommandType::Geometry);
+	command.target = &GetLayer(num_active_layers - 1);
+	command.index_begin = index_begin;
+	command.index_end = (int)frame.indices.size();
+	command.texture = texture;
+	command.shader = static_cast<const Shader*>(shader);
+	command.mask_operation = mask_operation;
+	command.clip_mask_test = clip_mask_enabled;
+	command.clip_mask_reference = byte(clip_mask_reference);
+	if (command.shader && command.shader->type == ShaderType::Creation)
+		command.time = (float)Rml::GetSystemInterface()->GetElapsedTime();
+
+	// Setting the clip mask clears it within the whole scissor region, while other commands only affect the area covered by the geometry.
+	const bool clears_region = (to_clip_mask && mask_operation != Rml::ClipMaskOperation::Intersect);
+	if (clears_region)
+		command.bounds = region;
+	else if (min.x <= max.x && min.y <= max.y)
+		command.bounds = MakeBounds(min, max).Intersect(region);
+	else
+		command.bounds = Rml::Rectanglei::FromSize({0, 0});
+
+	if (IsEmpty(command.bounds))
+	{
+		frame.vertices.resize(base_vertex);
+		frame.indices.resize(index_begin);
+		return;
+	}
+
+	frame.commands.push_back(command);
+}
+
+void RenderInterface_Software::Flush()
+{
+	FrameData& frame = *frame_data;
+	if (frame.commands.empty())
+		return;
+
+	const int tile_size = RMLUI_SOFTWARE_TILE_SIZE;
+	const int num_tiles_x = (viewport_width + tile_size - 1) / tile_size;
+	const int num_tiles_y = (viewport_height + tile_size - 1) / tile_size;
+	const int num_tiles = num_tiles_x * num_tiles_y;
+
+	// Bin the commands by the tiles they overlap.
+	if ((int)frame.tile_commands.size() < num_tiles)
+		frame.tile_commands.resize(num_tiles);
+	for (auto& tile_commands : frame.tile_commands)
+		tile_commands.clear();
+
+	for (int i = 0; i < (int)frame.commands.size(); i++)
+	{
+		const Rml::Rectanglei bounds = frame.commands[i].bounds;
+		const int tile_x_end = (bounds.Right() + tile_size - 1) / tile_size;
+		const int tile_y_end = (bounds.Bottom() + tile_size - 1) / tile_size;
+		for (int tile_y = bounds.Top() / tile_size; tile_y < tile_y_end; tile_y++)
+		{
+			for (int tile_x = bounds.Left() / tile_size; tile_x < tile_x_end; tile_x++)
+				frame.tile_commands[tile_y * num_tiles_x + tile_x].push_back(i);
+		}
+	}
+
+	// Rasterize each tile in parallel, the tiles cover disjoint regions of every render target.
+	byte* clip_mask_data = clip_mask.data();
+	const int width = viewport_width;
+	thread_pool->Run(num_tiles, [&](int tile_index) {
+		const Rml::Vector2i tile_position = {(tile_index % num_tiles_x) * tile_size, (tile_index / num_tiles_x) * tile_size};
+		const Rml::Rectanglei tile = Rml::Rectanglei::FromPositionSize(tile_position, Rml::Vector2i(tile_size))
+										 .Intersect(Rml::Rectanglei::FromSize({viewport_width, viewport_height}));
+
+		for (int command_index : frame.tile_commands[tile_index])
+		{
+			const DrawCommand& command = frame.commands[command_index];
+			ExecuteCommand(frame, command, command.bounds.Intersect(tile), clip_mask_data, width);
+		}
+	});
+
+	frame.commands.clear();
+	frame.vertices.clear();
+	frame.indices.clear();
+}
+
+void RenderInterface_Software::EnableScissorRegion(bool enable)
+{
+	if (!enable)
+		scissor_region = Rml::Rectanglei::MakeInvalid();
+}
+
+void RenderInterface_Software::SetScissorRegion(Rml::Rectanglei region)
+{
+	scissor_region = region;
+}
+
+Rml::Rectanglei RenderInterface_Software::GetScissorRegion() const
+{
+	const Rml::Rectanglei viewport = Rml::Rectanglei::FromSize({viewport_width, viewport_height});
+	if (!scissor_region.Valid())
+		return viewport;
+	return scissor_region.Intersect(viewport);
+}
+
+void RenderInterface_Software::EnableClipMask(bool enable)
+{
+	clip_mask_enabled = enable;
+}
+
+void RenderInterface_Software::RenderToClipMask(Rml::ClipMaskOperation operation, Rml::CompiledGeometryHandle geometry, Rml::Vector2f translation)
+{
+	SubmitGeometry(geometry, translation, nullptr, nullptr, true, operation);
+
+	switch (operation)
+	{
+	case Rml::ClipMaskOperation::Set: clip_mask_reference = 1; break;
+	case Rml::ClipMaskOperation::SetInverse: clip_mask_reference = 0; break;
+	case Rml::ClipMaskOperation::Intersect: clip_mask_reference += 1; break;
+	}
+}
+
+void RenderInterface_Software::SetTransform(const Rml::Matrix4f* new_transform)
+{
+	transform_active = (new_transform != nullptr);
+	if (new_transform)
+		transform = *new_transform;
+}
+
+// Set to byte packing, or the compiler will expand our struct, which means it won't read correctly from file
+#pragma pack(1)
+struct TGAHeader {
+	char idLength;
+	char colourMapType;
+	char dataType;
+	short int colourMapOrigin;
+	short int colourMapLength;
+	char colourMapDepth;
+	short int xOrigin;
+	short int yOrigin;
+	short int width;
+	short int height;
+	char bitsPerPixel;
+	char imageDescriptor;
+};
+// Restore packing
+#pragma pack()
+
+Rml::TextureHandle RenderInterface_Software::LoadTexture(Rml::Vector2i& texture_dimensions, const Rml::String& source)
+{
+	Rml::FileInterface* file_interface = Rml::GetFileInterface();
+	Rml::FileHandle file_handle = file_interface->Open(source);
+	if (!file_handle)
+		return {};
+
+	file_interface->Seek(file_handle, 0, SEEK_END);
+	size_t buffer_size = file_interface->Tell(file_handle);
+	file_interface->Seek(file_handle, 0, SEEK_SET);
+
+	if (buffer_size <= sizeof(TGAHeader))
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Texture file size is smaller than TGAHeader, file is not a valid TGA image.");
+		file_interface->Close(file_handle);
+		return {};
+	}
+
+	Rml::UniquePtr<byte[]> buffer(new byte[buffer_size]);
+	file_interface->Read(buffer.get(), buffer_size, file_handle);
+	file_interface->Close(file_handle);
+
+	TGAHeader header;
+	memcpy(&header, buffer.get(), sizeof(TGAHeader));
+
+	int color_mode = header.bitsPerPixel / 8;
+	const size_t image_size = header.width * header.height * 4; // We always make 32bit textures
+
+	if (header.dataType != 2)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Only 24/32bit uncompressed TGAs are supported.");
+		return {};
+	}
+
+	// Ensure we have at least 3 colors
+	if (color_mode < 3)
+	{
+		Rml::Log::Message(Rml::Log::LT_ERROR, "Only 24 and 32bit textures are supported.");
+		return {};
+	}
+
+	const byte* image_src = buffer.get() + sizeof(TGAHeader);
+	Rml::UniquePtr<byte[]> image_dest_buffer(new byte[image_size]);
+	byte* image_dest = image_dest_buffer.get();
+
+	// Targa is BGR, swap to RGB, flip Y axis, and convert to premultiplied alpha.
+	for (long y = 0; y < header.height; y++)
+	{
+		long read_index = y * header.width * color_mode;
+		long write_index = ((header.imageDescriptor & 32) != 0) ? read_index : (header.height - y - 1) * header.width * 4;
+		for (long x = 0; x < header.width; x++)
+		{
+			image_dest[write_index] = image_src[read_index + 2];
+			image_dest[write_index + 1] = image_src[read_index + 1];
+			image_dest[write_index + 2] = image_src[read_index];
+			if (color_mode == 4)
+			{
+				const byte alpha = image_src[read_index + 3];
+				for (size_t j = 0; j < 3; j++)
+					image_dest[write_index + j] = byte((image_dest[write_index + j] * alpha) / 255);
+				image_dest[write_index + 3] = alpha;
+			}
+			else
+				image_dest[write_index + 3] = 255;
+
+			write_index += 4;
+			read_index += color_mode;
+		}
+	}
+
+	texture_dimensions.x = header.width;
+	texture_dimensions.y = header.height;
+
+	return GenerateTexture({image_dest, image_size}, texture_dimensions);
+}
+
+Rml::TextureHandle RenderInterface_Software::GenerateTexture(Rml::Span<const byte> source_data, Rml::Vector2i source_dimensions)
+{
+	RMLUI_ASSERT(source_data.data() && source_data.size() == size_t(source_dimensions.x * source_dimensions.y * 4));
+	if (source_dimensions.x < 1 || source_dimensions.y < 1)
+		return {};
+
+	Texture* texture = new Texture;
+	texture->dimensions = source_dimensions;
+	texture->pixels.resize(size_t(source_dimensions.x * source_dimensions.y));
+	memcpy(texture->pixels.data(), source_data.data(), source_data.size());
+
+	return reinterpret_cast<Rml::TextureHandle>(texture);
+}
+
+Rml::TextureHandle RenderInterface_Software::GenerateAlphaTexture(Rml::Span<const byte> source_data, Rml::Vector2i source_dimensions)
+{
+	RMLUI_ASSERT(source_data.data() && source_data.size() == size_t(source_dimensions.x * source_dimensions.y));
+	if (source_dimensions.x < 1 || source_dimensions.y < 1)
+		return {};
+
+	Texture* texture = new Texture;
+	texture->dimensions = source_dimensions;
+	texture->alpha.assign(source_data.begin(), source_data.end());
+
+	return reinterpret_cast<Rml::TextureHandle>(texture);
+}
+
+bool RenderInterface_Software::UpdateTexture(Rml::TextureHandle texture_handle, Rml::Span<const byte> source_data, Rml::Rectanglei region)
+{
+	Texture* texture = reinterpret_cast<Texture*>(texture_handle);
+	const bool is_alpha = texture->pixels.empty();
+	const int bytes_per_pixel = (is_alpha ? 1 : 4);
+	RMLUI_ASSERT(source_data.data() && source_data.size() == size_t(region.Width() * region.Height() * bytes_per_pixel));
+	RMLUI_ASSERT(region.Left() >= 0 && region.Top() >= 0 && region.Right() <= texture->dimensions.x && region.Bottom() <= texture->dimensions.y);
+
+	// Any queued commands may still refer to the texture.
+	Flush();
+
+	byte* destination = (is_alpha ? texture->alpha.data() : reinterpret_cast<byte*>(texture->pixels.data()));
+	const size_t num_bytes_per_line = size_t(region.Width() * bytes_per_pixel);
+	for (int y = 0; y < region.Height(); y++)
+	{
+		const size_t offset = size_t(((region.Top() + y) * texture->dimensions.x + region.Left()) * bytes_per_pixel);
+		memcpy(destination + offset, source_data.data() + y * num_bytes_per_line, num_bytes_per_line);
+	}
+
+	return true;
+}
+
+void RenderInterface_Software::ReleaseTexture(Rml::TextureHandle texture_handle)
+{
+	// Any queued commands may still refer to the texture.
+	Flush();
+	delete reinterpret_cast<Texture*>(texture_handle);
+}
+
+Layer& RenderInterface_Software::GetLayer(Rml::LayerHandle layer) const
+{
+	RMLUI_ASSERT(size_t(layer) < (size_t)num_active_layers);
+	return *layers[layer];
+}
+
+Rml::LayerHandle RenderInterface_Software::PushLayer()
+{
+	RMLUI_ASSERT(num_active_layers <= (int)layers.size());
+	if (num_active_layers == (int)layers.size())
+	{
+		layers.push_back(Rml::MakeUnique<Layer>());
+		layers.back()->pixels.assign(size_t(viewport_width * viewport_height), TransparentBlack);
+	}
+
+	num_active_layers += 1;
+	const Rml::LayerHandle handle = Rml::LayerHandle(num_active_layers - 1);
+
+	// The new layer is cleared within the current scissor region, queued so that pending commands on the re-used layer are rendered first.
+	DrawCommand command = {};
+	command.type = CommandType::Clear;
+	command.target = &GetLayer(handle);
+	command.bounds = GetScissorRegion();
+	if (!IsEmpty(command.bounds))
+		frame_data->commands.push_back(command);
+
+	return handle;
+}
+
+void RenderInterface_Software::CompositeLayers(Rml::LayerHandle source_handle, Rml::LayerHandle destination_handle, Rml::BlendMode blend_mode,
+	Rml::Span<const Rml::CompiledFilterHandle> filters)
+{
+	const Rml::Rectanglei region = GetScissorRegion();
+	if (IsEmpty(region))
+		return;
+
+	DrawCommand command = {};
+	command.type = CommandType::Composite;
+	command.bounds = region;
+	command.target = &GetLayer(destination_handle);
+	command.source = &GetLayer(source_handle);
+	command.blend_mode = blend_mode;
+	command.clip_mask_test = clip_mask_enabled;
+	command.clip_mask_reference = byte(clip_mask_reference);
+
+	if (filters.empty())
+	{
+		// Without filters, compositing only depends on the pixel itself so it can be queued with the other commands.
+		frame_data->commands.push_back(command);
+		return;
+	}
+
+	// Filters may sample neighboring pixels, thus the source layer must be completely rendered before they are applied.
+	Flush();
+
+	const int width = viewport_width;
+	for (int y = region.Top(); y < region.Bottom(); y++)
+	{
+		const int offset = y * width + region.Left();
+		std::copy_n(command.source->pixels.begin() + offset, region.Width(), postprocess_primary->pixels.begin() + offset);
+	}
+
+	RenderFilters(filters);
+
+	command.source = postprocess_primary.get();
+	frame_data->commands.push_back(command);
+	Flush();
+}
+
+void RenderInterface_Software::RenderFilters(Rml::Span<const Rml::CompiledFilterHandle> filter_handles)
+{
+	const Rml::Rectanglei region = GetScissorRegion();
+	const int width = viewport_width;
+
+	// Calls the function for every pixel in the region, parallelized over rows.
+	auto ForEachPixel = [&](auto&& pixel_function) {
+		thread_pool->Run(region.Height(), [&](int row) {
+			const int y = region.Top() + row;
+			for (int x = region.Left(); x < region.Right(); x++)
+				pixel_function(y * width + x);
+		});
+	};
+
+	// Gaussian blur within the region, approximated by consecutive box filters along the rows and then the columns.
+	auto Blur = [&](Layer& layer, float sigma) {
+		int box_sizes[3];
+		SigmaToBoxSizes(sigma, box_sizes);
+
+		const int region_width = region.Width();
+		const int region_height = region.Height();
+		Rml::Vector<Vector4f>& buffer = frame_data->blur_buffer;
+		buffer.resize(size_t(region_width * region_height));
+
+		thread_pool->Run(region_height, [&](int row) {
+			Vector4f* line = buffer.data() + row * region_width;
+			const ColourbPremultiplied* pixels = layer.pixels.data() + (region.Top() + row) * width + region.Left();
+			for (int x = 0; x < region_width; x++)
+				line[x] = ToVector(pixels[x]);
+
+			Rml::Vector<Vector4f> temp(region_width);
+			for (int box_size : box_sizes)
+				BoxBlurLine(line, temp.data(), region_width, (box_size - 1) / 2);
+		});
+
+		thread_pool->Run(region_width, [&](int column) {
+			Rml::Vector<Vector4f> line(region_height), temp(region_height);
+			for (int y = 0; y < region_height; y++)
+				line[y] = buffer[y * region_width + column];
+
+			for (int box_size : box_sizes)
+				BoxBlurLine(line.data(), temp.data(), region_height, (box_size - 1) / 2);
+
+			for (int y = 0; y < region_height; y++)
+				layer.pixels[(region.Top() + y) * width + region.Left() + column] = ToColour(line[y]);
+		});
+	};
+
+	for (const Rml::CompiledFilterHandle filter_handle : filter_handles)
+	{
+		const Filter& filter = *reinterpret_cast<const Filter*>(filter_handle);
+		ColourbPremultiplied* pixels = postprocess_primary->pixels.data();
+
+		switch (filter.type)
+		{
+		case FilterType::Passthrough:
+		{
+			const float factor = filter.blend_factor;
+			ForEachPixel([&](int index) { pixels[index] = ToColour(ToVector(pixels[index]) * factor); });
+		}
+		break;
+		case FilterType::Blur:
+		{
+			if (filter.sigma >= 0.5f)
+				Blur(*postprocess_primary, filter.sigma);
+		}
+		break;
+		case FilterType::DropShadow:
+		{
+			// Render the shadow from the alpha channel of the offset source, then blend the source on top of it.
+			ColourbPremultiplied* shadow = postprocess_secondary->pixels.data();
+			const Rml::Vector2i offset = {Rml::Math::RoundToInteger(filter.offset.x), Rml::Math::RoundToInteger(filter.offset.y)};
+			const Vector4f color = ToVector(filter.color);
+
+			thread_pool->Run(region.Height(), [&](int row) {
+				const int y = region.Top() + row;
+				const int source_y = Rml::Math::Clamp(y - offset.y, region.Top(), region.Bottom() - 1);
+				for (int x = region.Left(); x < region.Right(); x++)
+				{
+					const int source_x = Rml::Math::Clamp(x - offset.x, region.Left(), region.Right() - 1);
+					const float alpha = float(pixels[source_y * width + source_x].alpha) * (1.f / 255.f);
+					shadow[y * width + x] = ToColour(color * alpha);
+				}
+			});
+
+			if (filter.sigma >= 0.5f)
+				Blur(*postprocess_secondary, filter.sigma);
+
+			thread_pool->Run(region.Height(), [&](int row) {
+				const int offset = (region.Top() + row) * width + region.Left();
+				BlendRow(shadow + offset, pixels + offset, region.Width());
+			});
+			std::swap(postprocess_primary, postprocess_secondary);
+		}
+		break;
+		case FilterType::ColorMatrix:
+		{
+			// Transform the colors directly in premultiplied space, see the corresponding shader of the GL3 renderer for details.
+			const Rml::Matrix4f& matrix = filter.color_matrix;
+			ForEachPixel([&](int index) {
+				const Vector4f color = ToVector(pixels[index]);
+				const Vector4f transformed = matrix * color;
+				pixels[index] = ToColour({transformed.x, transformed.y, transformed.z, color.w});
+			});
+		}
+		break;
+		case FilterType::MaskImage:
+		{
+			const ColourbPremultiplied* mask = blend_mask->pixels.data();
+			ForEachPixel([&](int index) { pixels[index] = ToColour(ToVector(pixels[index]) * (float(mask[index].alpha) * (1.f / 255.f))); });
+		}
+		break;
+		case FilterType::Invalid:
+		{
+			Rml::Log::Message(Rml::Log::LT_WARNING, "Unhandled render filter %d.", (int)filter.type);
+		}
+		break;
+		}
+	}
+}
+
+void RenderInterface_Software::PopLayer()
+{
+	RMLUI_ASSERT(num_active_layers > 1);
+	num_active_layers -= 1;
+}
+
+Rml::TextureHandle RenderInterface_Software::SaveLayerAsTexture()
+{
+	RMLUI_ASSERT(scissor_region.Valid());
+	const Rml::Rectanglei bounds = GetScissorRegion();
+	if (IsEmpty(bounds))
+		return {};
+
+	Flush();
+
+	const Layer& layer = GetLayer(num_active_layers - 1);
+	Texture* texture = new Texture;
+	texture->dimensions = bounds.Size();
+	texture->pixels.resize(size_t(bounds.Width() * bounds.Height()));
+	for (int y = 0; y < bounds.Height(); y++)
+	{
+		const int offset = (bounds.Top() + y) * viewport_width + bounds.Left();
+		std::copy_n(layer.pixels.begin() + offset, bounds.Width(), texture->pixels.begin() + y * bounds.Width());
+	}
+
+	return reinterpret_cast<Rml::TextureHandle>(texture);
+}
+
+Rml::CompiledFilterHandle RenderInterface_Software::SaveLayerAsMaskImage()
+{
+	Flush();
+
+	const Rml::Rectanglei region = GetScissorRegion();
+	const Layer& layer = GetLayer(num_active_layers - 1);
+	for (int y = region.Top(); y < region.Bottom(); y++)
+	{
+		const int offset = y * viewport_width + region.Left();
+		std::copy_n(layer.pixels.begin() + offset, region.Width(), blend_mask->pixels.begin() + offset);
+	}
+
+	Filter filter = {};
+	filter.type = FilterType::MaskImage;
+	return reinterpret_cast<Rml::CompiledFilterHandle>(new Filter(std::move(filter)));
+}
+
+Rml::CompiledFilterHandle RenderInterface_Software::CompileFilter(const Rml::String& name, const Rml::Dictionary& parameters)
+{
+	Filter filter = {};
+
+	if (name == "opacity")
+	{
+		filter.type = FilterType::Passthrough;
+		filter.blend_factor = Rml::Get(parameters, "value", 1.0f);
+	}
+	else if (name == "blur")
+	{
+		filter.type = FilterType::Blur;
+		filter.sigma = Rml::Get(parameters, "sigma", 1.0f);
+	}
+	else if (name == "drop-shadow")
+	{
+		filter.type = FilterType::DropShadow;
+		filter.sigma = Rml::Get(parameters, "sigma", 0.f);
+		filter.color = Rml::Get(parameters, "color", Rml::Colourb()).ToPremultiplied();
+		filter.offset = Rml::Get(parameters, "offset", Rml::Vector2f(0.f));
+	}
+	else if (name == "brightness")
+	{
+		filter.type = FilterType::ColorMatrix;
+		const float value = Rml::Get(parameters, "value", 1.0f);
+		filter.color_matrix = Rml::Matrix4f::Diag(value, value, value, 1.f);
+	}
+	else if (name == "contrast")
+	{
+		filter.type = FilterType::ColorMatrix;
+		const float value = Rml::Get(parameters, "value", 1.0f);
+		const float grayness = 0.5f - 0.5f * value;
+		filter.color_matrix = Rml::Matrix4f::Diag(value, value, value, 1.f);
+		filter.color_matrix.SetColumn(3, Rml::Vector4f(grayness, grayness, grayness, 1.f));
+	}
+	else if (name == "invert")
+	{
+		filter.type = FilterType::ColorMatrix;
+		const float value = Rml::Math::Clamp(Rml::Get(parameters, "value", 1.0f), 0.f, 1.f);
+		const float inverted = 1.f - 2.f * value;
+		filter.color_matrix = Rml::Matrix4f::Diag(inverted, inverted, inverted, 1.f);
+		filter.color_matrix.SetColumn(3, Rml::Vector4f(value, value, value, 1.f));
+	}
+	else if (name == "grayscale")
+	{
+		filter.type = FilterType::ColorMatrix;
+		const float value = Rml::Get(parameters, "value", 1.0f);
+		const float rev_value = 1.f - value;
+		const Rml::Vector3f gray = value * Rml::Vector3f(0.2126f, 0.7152f, 0.0722f);
+		// clang-format off
+		filter.color_matrix = Rml::Matrix4f::FromRows(
+			{gray.x + rev_value, gray.y,             gray.z,             0.f},
+			{gray.x,             gray.y + rev_value, gray.z,             0.f},
+			{gray.x,             gray.y,             gray.z + rev_value, 0.f},
+			{0.f,                0.f,                0.f,                1.f}
+		);
+		// clang-format on
+	}
+	else if (name == "sepia")
+	{
+		filter.type = FilterType::ColorMatrix;
+		const float value = Rml::Get(parameters, "value", 1.0f);
+		const float rev_value = 1.f - value;
+		const Rml::Vector3f r_mix = value * Rml::Vector3f(0.393f, 0.769f, 0.189f);
+		const Rml::Vector3f g_mix = value * Rml::Vector3f(0.349f, 0.686f, 0.168f);
+		const Rml::Vector3f b_mix = value * Rml::Vector3f(0.272f, 0.534f, 0.131f);
+		// clang-format off
+		filter.color_matrix = Rml::Matrix4f::FromRows(
+			{r_mix.x + rev_value, r_mix.y,             r_mix.z,             0.f},
+			{g_mix.x,             g_mix.y + rev_value, g_mix.z,             0.f},
+			{b_mix.x,             b_mix.y,             b_mix.z + rev_value, 0.f},
+			{0.f,                 0.f,                 0.f,                 1.f}
+		);
+		// clang-format on
+	}
+	else if (name == "hue-rotate")
+	{
+		// Hue-rotation and saturation values based on: https://www.w3.org/TR/filter-effects-1/#attr-valuedef-type-huerotate
+		filter.type = FilterType::ColorMatrix;
+		const float value = Rml::Get(parameters, "value", 1.0f);
+		const float s = Rml::Math::Sin(value);
+		const float c = Rml::Math::Cos(value);
+		// clang-format off
+		filter.color_matrix = Rml::Matrix4f::FromRows(
+			{0.213f + 0.787f * c - 0.213f * s,  0.715f - 0.715f * c - 0.715f * s,  0.072f - 0.072f * c + 0.928f * s,  0.f},
+			{0.213f - 0.213f * c + 0.143f * s,  0.715f + 0.285f * c + 0.140f * s,  0.072f - 0.072f * c - 0.283f * s,  0.f},
+			{0.213f - 0.213f * c - 0.787f * s,  0.715f - 0.715f * c + 0.715f * s,  0.072f + 0.928f * c + 0.072f * s,  0.f},
+			{0.f,                               0.f,                               0.f,                               1.f}
+		);
+		// clang-format on
+	}
+	else if (name == "saturate")
+	{
+		filter.type = FilterType::ColorMatrix;
+		const float value = Rml::Get(parameters, "value", 1.0f);
+		// clang-format off
+		filter.color_matrix = Rml::Matrix4f::FromRows(
+			{0.213f + 0.787f * value,  0.715f - 0.715f * value,  0.072f - 0.072f * value,  0.f},
+			{0.213f - 0.213f * value,  0.715f + 0.285f * value,  0.072f - 0.072f * value,  0.f},
+			{0.213f - 0.213f * value,  0.715f - 0.715f * value,  0.072f + 0.928f * value,  0.f},
+			{0.f,                      0.f,                      0.f,                      1.f}
+		);
+		// clang-format on
+	}
+
+	if (filter.type != FilterType::Invalid)
+		return reinterpret_cast<Rml::CompiledFilterHandle>(new Filter(std::move(filter)));
+
+	Rml::Log::Message(Rml::Log::LT_WARNING, "Unsupported filter type '%s'.", name.c_str());
+	return {};
+}
+
+void RenderInterface_Software::ReleaseFilter(Rml::CompiledFilterHandle filter)
+{
+	delete reinterpret_cast<Filter*>(filter);
+}
+
+Rml::CompiledShaderHandle RenderInterface_Software::CompileShader(const Rml::String& name, const Rml::Dictionary& parameters)
+{
+	auto ApplyColorStopList = [](Shader& shader, const Rml::Dictionary& shader_parameters) {
+		auto it = shader_parameters.find("color_stop_list");
+		RMLUI_ASSERT(it != shader_parameters.end() && it->second.GetType() == Rml::Variant::COLORSTOPLIST);
+		const Rml::ColorStopList& color_stop_list = it->second.GetReference<Rml::ColorStopList>();
+		const int num_stops = Rml::Math::Min((int)color_stop_list.size(), MAX_NUM_STOPS);
+
+		shader.stop_positions.resize(num_stops);
+		shader.stop_colors.resize(num_stops);
+		for (int i = 0; i < num_stops; i++)
+		{
+			const Rml::ColorStop& stop = color_stop_list[i];
+			RMLUI_ASSERT(stop.position.unit == Rml::Unit::NUMBER);
+			shader.stop_positions[i] = stop.position.number;
+			shader.stop_colors[i] = ToVector(stop.color);
+		}
+	};
+
+	Shader shader = {};
+
+	if (name == "linear-gradient")
+	{
+		shader.type = ShaderType::Gradient;
+		const bool repeating = Rml::Get(parameters, "repeating", false);
+		shader.gradient_function = (repeating ? GradientFunction::RepeatingLinear : GradientFunction::Linear);
+		shader.p = Rml::Get(parameters, "p0", Rml::Vector2f(0.f));
+		shader.v = Rml::Get(parameters, "p1", Rml::Vector2f(0.f)) - shader.p;
+		ApplyColorStopList(shader, parameters);
+	}
+	else if (name == "radial-gradient")
+	{
+		shader.type = ShaderType::Gradient;
+		const bool repeating = Rml::Get(parameters, "repeating", false);
+		shader.gradient_function = (repeating ? GradientFunction::RepeatingRadial : GradientFunction::Radial);
+		shader.p = Rml::Get(parameters, "center", Rml::Vector2f(0.f));
+		shader.v = Rml::Vector2f(1.f) / Rml::Get(parameters, "radius", Rml::Vector2f(1.f));
+		ApplyColorStopList(shader, parameters);
+	}
+	else if (name == "conic-gradient")
+	{
+		shader.type = ShaderType::Gradient;
+		const bool repeating = Rml::Get(parameters, "repeating", false);
+		shader.gradient_function = (repeating ? GradientFunction::RepeatingConic : GradientFunction::Conic);
+		shader.p = Rml::Get(parameters, "center", Rml::Vector2f(0.f));
+		const float angle = Rml::Get(parameters, "angle", 0.f);
+		shader.v = {Rml::Math::Cos(angle), Rml::Math::Sin(angle)};
+		ApplyColorStopList(shader, parameters);
+	}
+	else if (name == "shader")
+	{
+		const Rml::String value = Rml::Get(parameters, "value", Rml::String());
+		if (value == "creation")
+		{
+			shader.type = ShaderType::Creation;
+			shader.dimensions = Rml::Get(parameters, "dimensions", Rml::Vector2f(0.f));
+		}
+	}
+
+	if (shader.type != ShaderType::Invalid && (shader.type != ShaderType::Gradient || !shader.stop_positions.empty()))
+		return reinterpret_cast<Rml::CompiledShaderHandle>(new Shader(std::move(shader)));
+
+	Rml::Log::Message(Rml::Log::LT_WARNING, "Unsupported shader type '%s'.", name.c_str());
+	return {};
+}
+
+void RenderInterface_Software::RenderShader(Rml::CompiledShaderHandle shader_handle, Rml::CompiledGeometryHandle geometry_handle,
+	Rml::Vector2f translation, Rml::TextureHandle /*texture*/)
+{
+	RMLUI_ASSERT(shader_handle && geometry_handle);
+	SubmitGeometry(geometry_handle, translation, nullptr, reinterpret_cast<const Shader*>(shader_handle), false, {});
+}
+
+void RenderInterface_Software::ReleaseShader(Rml::CompiledShaderHandle shader_handle)
+{
+	// Any queued commands may still refer to the shader.
+	Flush();
+	delete reinterpret_cast<Shader*>(shader_handle);
+}
@@ -0,0 +1,153 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_BACKENDS_RENDERER_SOFTWARE_H
+#define RMLUI_BACKENDS_RENDERER_SOFTWARE_H
+
+#include <RmlUi/Core/RenderInterface.h>
+#include <RmlUi/Core/Types.h>
+
+namespace Software {
+struct Texture;
+struct Layer;
+struct FrameData;
+class ThreadPool;
+} // namespace Software
+
+/**
+    A render interface which rasterizes on the CPU, without any dependency on a graphics API.
+
+    Intended for headless rendering, such as generating thumbnails and screenshot comparisons on machines without a
+    GPU. Geometry is transformed to window space as it is submitted, and rasterized later when a result is needed.
+    Then, the window is split into tiles which are rendered in parallel by a pool of worker threads.
+
+    All render targets are stored as 8-bit RGBA with premultiplied alpha, and the rendered frame can be read back
+    after a call to EndFrame().
+ */
+class RenderInterface_Software : public Rml::RenderInterface {
+public:
+	// Rasterizes using the given number of threads, or one thread per hardware thread if zero.
+	explicit RenderInterface_Software(int num_threads = 0);
+	~RenderInterface_Software();
+
+	// The viewport should be updated whenever the window size changes.
+	void SetViewport(int viewport_width, int viewport_height);
+
+	// Prepares the render targets for taking rendering commands from RmlUi.
+	void BeginFrame();
+	// Completes the rendering of the current frame, after which the result can be retrieved.
+	void EndFrame();
+
+	// Returns the size of the rendered frame.
+	Rml::Vector2i GetFrameSize() const;
+	// Returns the pixels of the last rendered frame as rows of premultiplied RGBA colors, from top to bottom.
+	Rml::Span<const Rml::ColourbPremultiplied> GetFramePixels() const;
+
+	// -- Inherited from Rml::RenderInterface --
+
+	Rml::CompiledGeometryHandle CompileGeometry(Rml::Span<const Rml::Vertex> vertices, Rml::Span<const int> indices) override;
+	void RenderGeometry(Rml::CompiledGeometryHandle handle, Rml::Vector2f translation, Rml::TextureHandle texture) override;
+	void ReleaseGeometry(Rml::CompiledGeometryHandle handle) override;
+
+	Rml::TextureHandle LoadTexture(Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
+	Rml::TextureHandle GenerateTexture(Rml::Span<const Rml::byte> source_data, Rml::Vector2i source_dimensions) override;
+	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
+	Rml::TextureHandle GenerateAlphaTexture(Rml::Span<const Rml::byte> source_data, Rml::Vector2i source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, Rml::Span<const Rml::byte> source_data, Rml::Rectanglei region) override;
+
+	void EnableScissorRegion(bool enable) override;
+	void SetScissorRegion(Rml::Rectanglei region) override;
+
+	void EnableClipMask(bool enable) override;
+	void RenderToClipMask(Rml::ClipMaskOperation mask_operation, Rml::CompiledGeometryHandle geometry, Rml::Vector2f translation) override;
+
+	void SetTransform(const Rml::Matrix4f* transform) override;
+
+	Rml::LayerHandle PushLayer() override;
+	void CompositeLayers(Rml::LayerHandle source, Rml::LayerHandle destination, Rml::BlendMode blend_mode,
+		Rml::Span<const Rml::CompiledFilterHandle> filters) override;
+	void PopLayer() override;
+
+	Rml::TextureHandle SaveLayerAsTexture() override;
+
+	Rml::CompiledFilterHandle SaveLayerAsMaskImage() override;
+
+	Rml::CompiledFilterHandle CompileFilter(const Rml::String& name, const Rml::Dictionary& parameters) override;
+	void ReleaseFilter(Rml::CompiledFilterHandle filter) override;
+
+	Rml::CompiledShaderHandle CompileShader(const Rml::String& name, const Rml::Dictionary& parameters) override;
+	void RenderShader(Rml::CompiledShaderHandle shader_handle, Rml::CompiledGeometryHandle geometry_handle, Rml::Vector2f translation,
+		Rml::TextureHandle texture) override;
+	void ReleaseShader(Rml::CompiledShaderHandle shader_handle) override;
+
+private:
+	// Transforms the geometry to window space and queues it for rasterization to the top layer or the clip mask.
+	void SubmitGeometry(Rml::CompiledGeometryHandle handle, Rml::Vector2f translation, const Software::Texture* texture, const void* shader,
+		bool to_clip_mask, Rml::ClipMaskOperation mask_operation);
+
+	// Rasterizes all queued commands, must be called before reading from any render target.
+	void Flush();
+
+	// Applies the filters to the postprocess buffer, within the current scissor region.
+	void RenderFilters(Rml::Span<const Rml::CompiledFilterHandle> filter_handles);
+
+	// Returns the current scissor region, or the full viewport if scissoring is disabled.
+	Rml::Rectanglei GetScissorRegion() const;
+
+	Software::Layer& GetLayer(Rml::LayerHandle layer) const;
+
+	int viewport_width = 0;
+	int viewport_height = 0;
+
+	Rml::Rectanglei scissor_region = Rml::Rectanglei::MakeInvalid();
+	bool clip_mask_enabled = false;
+	int clip_mask_reference = 0;
+
+	bool transform_active = false;
+	Rml::Matrix4f transform;
+
+	// Layers are never deallocated during rendering, instead they are re-used as new layers are pushed.
+	Rml::Vector<Rml::UniquePtr<Software::Layer>> layers;
+	int num_active_layers = 0;
+
+	// Intermediate targets used for filters, and the mask image stored by SaveLayerAsMaskImage().
+	Rml::UniquePtr<Software::Layer> postprocess_primary, postprocess_secondary, blend_mask;
+
+	// One stencil value per pixel, shared by all layers.
+	Rml::Vector<Rml::byte> clip_mask;
+
+	// The commands and window-space vertices waiting to be rasterized.
+	Rml::UniquePtr<Software::FrameData> frame_data;
+
+	Rml::Vector<Rml::ColourbPremultiplied> frame_pixels;
+	Rml::Vector2i frame_size;
+
+	Rml::UniquePtr<Software::ThreadPool> thread_pool;
+};
+
+#endif
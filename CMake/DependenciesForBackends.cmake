@@ -188,6 +188,10 @@ endif()
 
 # --- Rendering APIs ---
 
+# Threads, used by the software renderer which is always available
+find_package("Threads")
+report_dependency_found_or_error("Threads" "Threads" Threads::Threads)
+
 # OpenGL
 
 # Set preferred OpenGL ABI on Linux for target OpenGL::GL
@@ -18,6 +18,7 @@ set(RMLUI_BACKEND_OPTIONS
 	"GLFW_VK"
 	"BackwardCompatible_GLFW_GL2"
 	"BackwardCompatible_GLFW_GL3"
+	"Headless_Software"
 )
 
 set(RMLUI_FONT_ENGINE_OPTIONS
@@ -62,6 +62,7 @@
 #include "Core/FontEffectInstancer.h"
 #include "Core/FontEngineInterface.h"
 #include "Core/FontGlyph.h"
+#include "Core/FontRunCache.h"
 #include "Core/Geometry.h"
 #include "Core/Header.h"
 #include "Core/ID.h"
@@ -83,6 +84,7 @@
 #include "Core/RenderManager.h"
 #include "Core/Spritesheet.h"
 #include "Core/StringUtilities.h"
+#include "Core/StyleSharing.h"
 #include "Core/StyleSheet.h"
 #include "Core/StyleSheetContainer.h"
 #include "Core/StyleSheetSpecification.h"
@@ -82,6 +82,8 @@ public:
 
 protected:
 	const URL* GetSourceURLPtr() const;
+	/// Sets the source URL reported during handling, for parsers that submit nodes without parsing a stream.
+	void SetSourceURLPtr(const URL* url);
 
 private:
 	const URL* source_url = nullptr;
@@ -58,6 +58,13 @@ public:
 
 	operator Texture() const;
 
+	/// Releases the generated texture, if any, while keeping the callback. The texture will be generated again the next
+	/// time it is used, thereby keeping existing references to this texture valid.
+	void Invalidate();
+	/// Marks a region of the generated texture, if any, as changed. The callback is called again the next time the texture is used, and the
+	/// region is then updated in place when supported by the render interface, otherwise the whole texture is generated again.
+	void InvalidateRegion(Rectanglei region);
+
 	void Release();
 
 private:
@@ -70,13 +77,21 @@ private:
  */
 class RMLUICORE_API CallbackTextureInterface {
 public:
-	CallbackTextureInterface(RenderManager& render_manager, RenderInterface& render_interface, TextureHandle& texture_handle, Vector2i& dimensions);
+	CallbackTextureInterface(RenderManager& render_manager, RenderInterface& render_interface, TextureHandle& texture_handle, Vector2i& dimensions,
+		bool& alpha_texture, Rectanglei update_region = Rectanglei::MakeInvalid());
 
 	/// Generate texture from byte source.
 	/// @param[in] source Texture data in 8-bit RGBA (premultiplied) format.
 	/// @param[in] dimensions The width and height of the texture.
 	/// @return True on success.
+	/// @note When called for an invalidated region of an existing texture, only that region is submitted to the render interface if possible.
 	bool GenerateTexture(Span<const byte> source, Vector2i dimensions) const;
+	/// Generate texture from single-channel byte source.
+	/// @param[in] source Texture data with one 8-bit value per pixel, representing premultiplied white with the given alpha.
+	/// @param[in] dimensions The width and height of the texture.
+	/// @return True on success.
+	/// @note Falls back to generating an RGBA texture if the render interface does not support single-channel textures.
+	bool GenerateAlphaTexture(Span<const byte> source, Vector2i dimensions) const;
 
 	/// Store the current layer as a texture, so that it can be rendered with geometry later.
 	/// @note The texture will be extracted using the bounds defined by the active scissor region, thereby matching its size.
@@ -85,10 +100,14 @@ public:
 	RenderManager& GetRenderManager() const;
 
 private:
+	bool UpdateTextureRegion(Span<const byte> source, Vector2i source_dimensions, bool source_alpha) const;
+
 	RenderManager& render_manager;
 	RenderInterface& render_interface;
 	TextureHandle& texture_handle;
 	Vector2i& dimensions;
+	bool& alpha_texture;
+	Rectanglei update_region;
 };
 
 /**
@@ -108,6 +127,12 @@ public:
 
 	Texture GetTexture(RenderManager& render_manager) const;
 
+	/// Releases the textures generated for all render managers. They will be generated again from the callback the
+	/// next time they are used.
+	void Invalidate();
+	/// Marks a region of the textures generated for all render managers as changed. See CallbackTexture::InvalidateRegion().
+	void InvalidateRegion(Rectanglei region);
+
 private:
 	CallbackTextureFunction callback;
 	mutable SmallUnorderedMap<RenderManager*, CallbackTexture> textures;
@@ -47,6 +47,7 @@ class DataModelConstructor;
 class DataTypeRegister;
 class ScrollController;
 class RenderManager;
+class RenderCommandList;
 class TextInputHandler;
 enum class EventId : uint16_t;
 
@@ -296,6 +297,20 @@ public:
 	/// @return Time until the next update is expected.
 	double GetNextUpdateDelay() const;
 
+	/// Enable or disable the render cache of this context. When enabled, the commands submitted during Render() are
+	/// recorded, and replayed on the next call if nothing in the context has changed since, without traversing any
+	/// elements. Disabled by default.
+	/// @param[in] enable True to enable the render cache, false to disable.
+	void EnableRenderCache(bool enable);
+	/// Invalidates the render cache, so that the next call to Render() renders all elements again. Changes to elements
+	/// are detected automatically, this is only needed for custom elements which change their rendered output without
+	/// changing any properties, attributes, layout, or geometry, or requesting an update.
+	void DirtyRenderCache();
+	/// Returns true if the next call to Render() will replay the previous frame, in which case the rendered output is
+	/// identical to the previous frame. Applications and backends can use this to skip rendering and presenting it.
+	/// @return True if the render cache is enabled and still valid.
+	bool IsRenderCacheValid() const;
+
 protected:
 	void Release() override;
 
@@ -314,13 +329,18 @@ private:
 
 	using ElementSet = SmallOrderedSet<Element*>;
 	using ElementList = Vector<Element*>;
-	// Set of elements that are currently in hover state.
-	ElementSet hover_chain;
+	// Path of elements that are currently in hover state, ordered from the root element down to the hovered element.
+	ElementList hover_chain;
 	// List of elements that are currently in active state.
 	ElementList active_chain;
 	// History of windows that have had focus
 	ElementList document_focus_history;
 
+	// Reusable containers for the parameters and element sets used while processing input events, to avoid allocating them on every event.
+	Vector<Dictionary> event_parameters_pool;
+	Vector<ElementList> element_list_pool;
+	Vector<Vector<ObserverPtr<Element>>> element_observer_list_pool;
+
 	// Documents that have been unloaded from the context but not yet released.
 	OwnedElementList unloaded_documents;
 
@@ -365,9 +385,9 @@ private:
 	// The element currently being dragged over. This is equivalent to hover, but only set while an element is being
 	// dragged, and excludes the dragged element.
 	Element* drag_hover;
-	// Set of elements that are currently being dragged over; this differs from the hover state as the dragged element
-	// itself can't be part of it.
-	ElementSet drag_hover_chain;
+	// Path of elements that are currently being dragged over, ordered from the root element down to the drag hover element;
+	// this differs from the hover state as the dragged element itself can't be part of it.
+	ElementList drag_hover_chain;
 
 	using DataModels = UnorderedMap<String, UniquePtr<DataModel>>;
 	DataModels data_models;
@@ -380,6 +400,12 @@ private:
 	// See RequestNextUpdate() and NextUpdateRequested() for details.
 	double next_update_timeout = 0;
 
+	// Render commands recorded during the previous call to Render(), see EnableRenderCache().
+	UniquePtr<RenderCommandList> render_cache;
+	bool render_cache_enabled = false;
+	bool render_cache_dirty = true;
+	int render_cache_resource_generation = 0;
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
 	// Internal callback for when a new element gains focus.
@@ -416,7 +442,10 @@ private:
 	void ReleaseUnloadedDocuments();
 
 	// Sends the specified event to all elements in new_items that don't appear in old_items.
-	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
+	void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
+	// Sends the specified event to all elements in the path beyond its first num_shared elements, either from the root downwards or from
+	// the leaf upwards.
+	void SendEvents(const ElementList& path, size_t num_shared, bool leaf_first, EventId id, const Dictionary& parameters);
 
 	friend class Rml::Element;
 };
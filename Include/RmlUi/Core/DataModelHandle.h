@@ -46,6 +46,10 @@ public:
 
 	bool IsVariableDirty(const String& variable_name);
 	void DirtyVariable(const String& variable_name);
+	// Dirty a single member or element of a variable, such as "players[3].hp". Only the views reading from this address,
+	// or from one of its parents or children, are updated. Prefer this over dirtying the whole variable for large containers.
+	void DirtyAddress(const String& address_str);
+	void DirtyAddress(const DataAddress& address);
 	void DirtyAllVariables();
 
 	explicit operator bool() { return model; }
@@ -56,6 +56,8 @@ class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
 class ElementStyle;
+class Factory;
+class HitTestIndex;
 class LayoutEngine;
 class ContainerBox;
 class InlineLevelBox;
@@ -66,6 +68,7 @@ class RenderManager;
 class StyleSheet;
 class StyleSheetContainer;
 class TransformState;
+class WidgetScroll;
 struct ElementMeta;
 struct StackingContextChild;
 
@@ -641,7 +644,20 @@ protected:
 	/// Forces the element to generate a local stacking context, regardless of the value of its z-index property.
 	void ForceLocalStackingContext();
 
+	/// Sets whether the element should be visited during every update loop.
+	/// @note Subtrees without any changes are skipped during the update loop. Elements that need OnUpdate() to be called every update, such as
+	/// for polling external state, must enable this flag. It is enabled by default for elements created through custom element instancers, so
+	/// that their OnUpdate() overrides keep being called every update. Such elements can disable the flag to be skipped while unchanged.
+	void SetNeedsUpdate(bool needs_update);
+
+	/// Sets which parts of the element's own rendering are skipped when its bounding box is entirely outside the current clipping region.
+	/// @param[in] cull_decoration Skip the background, border, and decorators. Enabled by default.
+	/// @param[in] cull_on_render Skip OnRender(). Disabled by default, only enable it when everything drawn by OnRender() lies within the element's box.
+	void SetRenderCulling(bool cull_decoration, bool cull_on_render);
+
 	/// Called during the update loop after children are updated.
+	/// @note Only called when the element is visited during the update loop, that is when the element or any of its descendants have changed,
+	/// or every update when enabled with SetNeedsUpdate().
 	virtual void OnUpdate();
 	/// Called during render after backgrounds, borders, decorators, but before children, are rendered.
 	virtual void OnRender();
@@ -674,7 +690,7 @@ protected:
 
 	/// Forces a re-layout of this element, and any other elements required.
 	virtual void DirtyLayout();
-	/// Returns true if the element has been marked as needing a re-layout.
+	/// Returns true if the element or any of its descendants has been marked as needing a re-layout.
 	virtual bool IsLayoutDirty();
 
 	/// Returns the RML of this element and all children.
@@ -690,6 +706,9 @@ protected:
 	enum class DirtyNodes { Self, SelfAndSiblings };
 	// Dirty the element style definition, including all descendants of the specified nodes.
 	void DirtyDefinition(DirtyNodes dirty_nodes);
+	// Dirty the style definitions affected by a change to a selector feature of this element, such as a class, pseudo-class, or attribute.
+	// @param[in] invalidation_flags The combined StyleSheetIndex::InvalidationFlags of the changed features.
+	void DirtySelectorDefinitions(int invalidation_flags);
 
 	void SetOwnerDocument(ElementDocument* document);
 
@@ -702,6 +721,9 @@ private:
 
 	void SetDataModel(DataModel* new_data_model);
 
+	/// Marks our ancestors, up to and including the owner document, as having a descendant with dirty layout.
+	void DirtyChildLayoutOfAncestors();
+
 	void DirtyAbsoluteOffset();
 	void DirtyAbsoluteOffsetRecursive();
 	void UpdateAbsoluteOffsetAndRenderBoxData();
@@ -713,8 +735,25 @@ private:
 	void AddToStackingContext(Vector<StackingContextChild>& stacking_children, bool is_flex_item, bool is_non_dom_element);
 	void DirtyStackingContext();
 
+	/// Rebuilds the hit test index of our local stacking context if it is dirty.
+	void UpdateHitTestIndex();
+	/// Returns the bounds of this element and its stacking context descendants in window coordinates, used to cull hit tests. Returns an
+	/// invalid rectangle if they cannot be bounded, such as when transformed.
+	Rectanglef GetHitTestBounds();
+	/// Dirties the hit test index of every stacking context we belong to, after our bounds or those of our descendants may have changed.
+	void DirtyHitTestIndex();
+
 	void UpdateDefinition();
 
+	/// Updates the element as the child at the given index of its parent, whose preceding siblings may share their computed values with us.
+	void Update(float dp_ratio, Vector2f vp_dimensions, int child_index);
+	void UpdateProperties(float dp_ratio, Vector2f vp_dimensions, int child_index);
+	/// Returns the up-to-date computed values of a preceding sibling that can be copied to this element, or nullptr if there are none.
+	const ComputedValues* FindSharedComputedValues(int child_index) const;
+
+	/// Marks this element as needing a visit during the next update loop, along with its ancestors so that the loop can reach it.
+	void DirtyUpdate();
+
 	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
 	void UpdateTransformState();
 
@@ -749,6 +788,7 @@ private:
 	bool local_stacking_context;
 	bool local_stacking_context_forced;
 	bool stacking_context_dirty;
+	bool hit_test_index_dirty;
 	bool computed_values_are_default_initialized;
 
 	bool visible; // True if the element is visible and active.
@@ -759,12 +799,23 @@ private:
 
 	bool dirty_definition : 1; // Implies dirty child definitions as well.
 	bool dirty_child_definitions : 1;
+	bool dirty_own_definition : 1; // Does not imply dirty child definitions.
 
 	bool dirty_animation : 1;
 	bool dirty_transition : 1;
 	bool dirty_transform : 1;
 	bool dirty_perspective : 1;
 
+	bool dirty_update : 1; // This element or any of its descendants need to be visited during the next update loop.
+	bool needs_update : 1;          // The element is visited during every update loop.
+	bool needs_update_explicit : 1; // The above flag was set by the element itself, instead of by default.
+
+	bool dirty_layout : 1;       // The layout of this element has changed, its nearest layout boundary needs to be formatted.
+	bool dirty_child_layout : 1; // The layout of any of our descendants has changed.
+
+	bool cull_decoration : 1; // Skip the background, border, and decorators when outside the clipping region.
+	bool cull_on_render : 1;  // Skip OnRender() when outside the clipping region.
+
 	OwnedElementList children;
 	int num_non_dom_children;
 
@@ -819,6 +870,7 @@ private:
 	float z_index;
 
 	ElementList stacking_context;
+	UniquePtr<HitTestIndex> hit_test_index;
 
 	UniquePtr<TransformState> transform_state;
 
@@ -828,11 +880,13 @@ private:
 
 	friend class Rml::Context;
 	friend class Rml::ElementStyle;
+	friend class Rml::Factory;
 	friend class Rml::ContainerBox;
 	friend class Rml::InlineLevelBox;
 	friend class Rml::ReplacedBox;
 	friend class Rml::LayoutEngine;
 	friend class Rml::ElementScroll;
+	friend class Rml::WidgetScroll;
 	friend RMLUICORE_API void Rml::ReleaseFontResources();
 };
 
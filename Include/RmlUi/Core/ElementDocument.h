@@ -164,7 +164,7 @@ private:
 
 	/// Sets the dirty flag on the layout so the document will format its children before the next render.
 	void DirtyLayout() override;
-	/// Returns true if the document has been marked as needing a re-layout.
+	/// Returns true if the document, or any element within it, has been marked as needing a re-layout.
 	bool IsLayoutDirty() override;
 
 	/// Notify the document that media query-related properties have changed and that style sheets need to be re-evaluated.
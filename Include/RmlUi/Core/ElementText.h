@@ -74,9 +74,22 @@ public:
 	/// @param[in] line_position The position of this line, as an offset from the first line.
 	/// @param[in] line The contents of the line.
 	void AddLine(Vector2f line_position, String line);
+	/// Replaces a range of lines with new lines, retaining the generated geometry of all other lines.
+	/// @param[in] begin The index of the first line to replace.
+	/// @param[in] end The index one past the last line to replace.
+	/// @param[in] new_lines The contents of the new lines.
+	/// @param[in] new_line_positions The position of each new line, as an offset from the first line.
+	void ReplaceLines(int begin, int end, Vector<String>&& new_lines, const Vector<Vector2f>& new_line_positions);
+	/// Moves all lines starting at the given index.
+	/// @param[in] begin The index of the first line to move.
+	/// @param[in] offset The offset to move the lines by. Should be whole pixels, so that the geometry of the lines can be retained.
+	void TranslateLines(int begin, Vector2f offset);
 
 	/// Prevents the element from dirtying its document's layout when its text is changed.
 	void SuppressAutoLayout();
+	/// Generates and renders geometry separately for each line. Then, only new lines need to have their geometry generated, and lines outside the
+	/// clipping region are skipped during rendering. Suitable for large texts that are modified only a few lines at a time.
+	void EnableGeometryPerLine();
 
 protected:
 	void OnRender() override;
@@ -89,12 +102,22 @@ private:
 	// Prepares the font effects this element uses for its font.
 	bool UpdateFontEffects();
 
+	struct TexturedGeometry {
+		Geometry geometry;
+		Texture texture;
+	};
+
 	// Used to store the position and length of each line we have geometry for.
 	struct Line {
-		Line(String text, Vector2f position) : text(std::move(text)), position(position), width(0) {}
+		Line(String text, Vector2f position) : text(std::move(text)), position(position), width(0), geometry_dirty(true) {}
 		String text;
 		Vector2f position;
 		int width;
+
+		// The geometry of this line when generating geometry per line, and how far the line has moved since it was generated.
+		Vector<TexturedGeometry> geometry;
+		Vector2f geometry_offset;
+		bool geometry_dirty;
 	};
 
 	// Clears and regenerates all of the text's geometry.
@@ -107,10 +130,6 @@ private:
 	using LineList = Vector<Line>;
 	LineList lines;
 
-	struct TexturedGeometry {
-		Geometry geometry;
-		Texture texture;
-	};
 	Vector<TexturedGeometry> geometry;
 
 	// The decoration geometry we've generated for this string.
@@ -125,6 +144,9 @@ private:
 
 	bool dirty_layout_on_change : 1;
 
+	bool geometry_per_line : 1;
+	bool line_geometry_dirty : 1;
+
 	// What the decoration type is that we have generated.
 	Style::TextDecoration generated_decoration;
 	// What the element's actual text-decoration property is; this may be different from the generated decoration
@@ -39,6 +39,7 @@ namespace Rml {
 class Factory;
 class Element;
 class EventInstancer;
+class EventInstancerDefault;
 struct EventSpecification;
 
 enum class EventPhase { None, Capture = 1, Target = 2, Bubble = 4 };
@@ -132,6 +133,11 @@ private:
 	/// Release this event through its instancer.
 	void Release() override;
 
+	/// Reinitialize this event for reuse, as if it was newly constructed.
+	void Reset(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible);
+	/// Read the mouse screen position from the parameters, if available.
+	void InitializeMousePosition();
+
 	String type;
 	EventId id = EventId::Invalid;
 	bool interruptible = false;
@@ -147,6 +153,7 @@ private:
 	EventInstancer* instancer = nullptr;
 
 	friend class Rml::Factory;
+	friend class Rml::EventInstancerDefault;
 };
 
 } // namespace Rml
@@ -26,50 +26,36 @@
  *
  */
 
-#ifndef TEXTURELAYOUTTEXTURE_H
-#define TEXTURELAYOUTTEXTURE_H
+#ifndef RMLUI_CORE_FONTRUNCACHE_H
+#define RMLUI_CORE_FONTRUNCACHE_H
 
-#include "../../Include/RmlUi/Core/Texture.h"
-#include "TextureLayoutRow.h"
+#include "Header.h"
+#include "Types.h"
 
 namespace Rml {
 
-class TextureLayout;
-
 /**
-    A texture layout texture is a single rectangular area which sub-rectangles are placed on within
-    a complete texture layout.
+    Statistics about the text run cache of the default font engine.
 
-    @author Peter
+    The cache holds the glyph quads of recently generated strings, keyed by their string, font face handle, letter spacing
+    and font effects. Strings generated again, such as repeated labels or table cells, only need to have their quads
+    translated and coloured.
  */
-
-class TextureLayoutTexture {
-public:
-	TextureLayoutTexture();
-	~TextureLayoutTexture();
-
-	/// Returns the texture's dimensions. This is only valid after the texture has been generated.
-	/// @return The texture's dimensions.
-	Vector2i GetDimensions() const;
-
-	/// Attempts to position unplaced rectangles from the layout into this texture. The size of
-	/// this texture will be determined by its contents.
-	/// @param[in] layout The layout to position rectangles from.
-	/// @param[in] maximum_dimensions The maximum dimensions of this texture. If this is not big enough to place all the rectangles, then as many will
-	/// be placed as possible.
-	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int maximum_dimensions);
-
-	/// Allocates the texture.
-	/// @return The allocated texture data.
-	Vector<byte> AllocateTexture();
-
-private:
-	using RowList = Vector<TextureLayoutRow>;
-
-	Vector2i dimensions;
-	RowList rows;
+struct FontRunCacheStatistics {
+	// Number of text runs currently held by the cache.
+	int num_runs = 0;
+	// Approximate memory used by the currently held runs, in bytes.
+	size_t memory_bytes = 0;
+	// The memory budget of the cache, in bytes. The least recently used runs are evicted when it is exceeded.
+	size_t memory_budget_bytes = 0;
+
+	// Number of generated strings that were found in the cache, and that had to be shaped, since initialization.
+	size_t num_hits = 0;
+	size_t num_misses = 0;
 };
 
+/// Returns statistics about the text run cache. All values are zero when the default font engine is not in use.
+RMLUICORE_API FontRunCacheStatistics GetFontRunCacheStatistics();
+
 } // namespace Rml
 #endif
@@ -104,6 +104,21 @@ public:
 	    @name Optional functions for advanced rendering features.
 	 */
 
+	/// Called by RmlUi when a single-channel texture is required to be generated from a sequence of pixels in memory.
+	/// @param[in] source The raw texture data. Each pixel is a single 8-bit value, which should be sampled as premultiplied white, that is,
+	/// with the value replicated in all four channels.
+	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
+	/// @return An application-specified handle identifying the texture, or zero if single-channel textures are not supported.
+	/// @note Used for font glyph textures. When zero is returned, the data is expanded to four channels and submitted to GenerateTexture() instead.
+	virtual TextureHandle GenerateAlphaTexture(Span<const byte> source, Vector2i source_dimensions);
+	/// Called by RmlUi when a region of a previously generated texture is to be replaced with new pixels.
+	/// @param[in] texture The texture handle to update, as returned by GenerateTexture() or GenerateAlphaTexture().
+	/// @param[in] source The new texture data of the region, tightly packed, using the same pixel format as when the texture was generated.
+	/// @param[in] region The region of the texture to update, in pixels.
+	/// @return True on success, false if texture updates are not supported.
+	/// @note Used when new glyphs are added to font textures. When false is returned, the whole texture is generated again instead.
+	virtual bool UpdateTexture(TextureHandle texture, Span<const byte> source, Rectanglei region);
+
 	/// Called by RmlUi when it wants to enable or disable the clip mask.
 	/// @param[in] enable True to enable the clip mask, false to disable it.
 	virtual void EnableClipMask(bool enable);
@@ -43,6 +43,7 @@ class CompiledShader;
 class TextureDatabase;
 class Texture;
 class RenderManagerAccess;
+class RenderCommandList;
 
 struct ClipMaskGeometry {
 	ClipMaskOperation operation;
@@ -80,6 +81,11 @@ public:
 	void SetViewport(Vector2i dimensions);
 	Vector2i GetViewport() const;
 
+	// Enables merging of consecutive geometry draws sharing the same texture and render state into a single draw.
+	// Disabled by default, as the merged geometry is compiled again every frame.
+	void EnableBatching(bool enable);
+	bool IsBatchingEnabled() const;
+
 	void DisableScissorRegion();
 	void SetScissorRegion(Rectanglei region);
 	Rectanglei GetScissorRegion() const;
@@ -121,6 +127,9 @@ private:
 
 	void Render(const Geometry& geometry, Vector2f translation, Texture texture, const CompiledShader& shader);
 
+	void FlushBatch();
+	void ReleaseBatchGeometry();
+
 	void GetTextureSourceList(StringList& source_list) const;
 
 	bool ReleaseTexture(const String& texture_source);
@@ -132,6 +141,10 @@ private:
 	void ReleaseResource(const CompiledFilter& filter);
 	void ReleaseResource(const CompiledShader& shader);
 
+	void BeginRecording(RenderCommandList* command_list);
+	bool EndRecording();
+	void Replay(const RenderCommandList& command_list);
+
 	struct GeometryData {
 		Mesh mesh;
 		CompiledGeometryHandle handle = {};
@@ -150,6 +163,27 @@ private:
 
 	Vector<LayerHandle> render_stack;
 
+	// Incremented whenever a resource is created, released, or invalidated, thereby invalidating any recorded commands.
+	int resource_generation = 0;
+
+	struct BatchedDraw {
+		StableVectorIndex geometry;
+		Vector2f translation;
+	};
+
+	bool batching_enabled = false;
+	Vector<BatchedDraw> batched_draws;
+	TextureHandle batched_texture = {};
+	// Geometry compiled from merged draws, released at the start of the next frame. Each handle refers to the mesh at the same index, which
+	// must remain unchanged until the handle is released. Meshes of released handles are kept for reuse to avoid reallocations.
+	Vector<CompiledGeometryHandle> batch_geometry_handles;
+	Vector<Mesh> batch_meshes;
+	Vector<Mesh> free_batch_meshes;
+
+	// When set, all commands submitted to the render interface are also added to this list.
+	RenderCommandList* recording = nullptr;
+	bool recording_aborted = false;
+
 	friend class RenderManagerAccess;
 };
 
@@ -0,0 +1,55 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_STYLESHARING_H
+#define RMLUI_CORE_STYLESHARING_H
+
+#include "Header.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+    Statistics about the sharing of computed values between sibling elements.
+
+    Siblings with the same style definition, and without any inline properties or variables, compute to identical values. When such an
+    element is updated, the computed values of a recently updated sibling are copied instead of being resolved from its properties. This
+    commonly applies to the rows of large lists and tables.
+ */
+struct StyleSharingStatistics {
+	// Number of computed value updates which were copied from a sibling, and which had to be resolved, since initialization. Reset
+	// during shutdown.
+	size_t num_hits = 0;
+	size_t num_misses = 0;
+};
+
+/// Returns statistics about the sharing of computed values between siblings.
+RMLUICORE_API StyleSharingStatistics GetStyleSharingStatistics();
+
+} // namespace Rml
+#endif
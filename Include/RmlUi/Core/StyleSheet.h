@@ -84,6 +84,13 @@ public:
 	/// Returns the compiled element definition for a given element and its hierarchy.
 	SharedPtr<const ElementDefinition> GetElementDefinition(const Element* element) const;
 
+	/// Returns which elements may need their definition updated when an element changes the given selector feature.
+	/// @param[in] element The element on which the feature changed.
+	/// @param[in] feature The type of the changed feature.
+	/// @param[in] name The name of the changed id, class, pseudo-class, or attribute.
+	/// @return A combination of StyleSheetIndex::InvalidationFlags, or zero if no selector uses the given name.
+	int GetInvalidationFlags(const Element* element, StyleSheetIndex::SelectorFeature feature, const String& name) const;
+
 	/// Returns a list of instanced decorators from the declarations. The instances are cached for faster future retrieval.
 	const DecoratorPtrList& InstanceDecorators(RenderManager& render_manager, const DecoratorDeclarationList& declaration_list,
 		const PropertySource* decorator_source) const;
@@ -105,8 +105,29 @@ struct StyleSheetIndex {
 	using NodeIndex = UnorderedMap<size_t, NodeList>;
 
 	// The following objects are given in prioritized order. Any nodes in the first object will not be contained in the next one and so on.
-	NodeIndex ids, classes, tags;
+	// Nodes are keyed by the interned atom of their id, class, pseudo-class, or tag name.
+	NodeIndex ids, classes, pseudo_classes, tags;
 	NodeList other;
+
+	// Selector features which can change on an element, thereby affecting which nodes apply to it or other elements.
+	enum class SelectorFeature { Id, Class, PseudoClass, Attribute };
+	// Which elements may need to be matched again when an element changes a selector feature, based on where the feature is used.
+	enum InvalidationFlags {
+		InvalidateSelf = 1 << 0,        // Used by the rightmost compound selector of a rule.
+		InvalidateDescendants = 1 << 1, // Used to the left of a descendant or child combinator.
+		InvalidateSiblings = 1 << 2,    // Used to the left of a sibling combinator.
+		InvalidateAll = InvalidateSelf | InvalidateDescendants | InvalidateSiblings,
+	};
+	struct Invalidation {
+		int flags = 0;
+		// Nodes using the feature to the left of a combinator, along with their invalidation flags. These flags only apply to elements which can
+		// match the rest of the node's compound selector.
+		Vector<Pair<const StyleSheetNode*, int>> relative_nodes;
+	};
+	using InvalidationIndex = UnorderedMap<size_t, Invalidation>;
+
+	// Invalidation of every feature used in the style sheet, keyed by the hash of its name.
+	InvalidationIndex id_invalidation, class_invalidation, pseudo_class_invalidation, attribute_invalidation;
 };
 } // namespace Rml
 
@@ -40,6 +40,19 @@ class Animation;
 
 namespace Rml {
 
+namespace Lottie {
+	struct FrameData;
+	struct FrameRender;
+} // namespace Lottie
+
+/**
+    Element for displaying Lottie animations.
+
+    Animation frames are rendered in the background, the element keeps displaying the previous frame until the next one is ready. The
+    optional 'frame-cache' attribute specifies the maximum number of rendered frames to keep for the current animation and size, so that
+    looping animations can display cached frames instead of rendering them again. Cached frames keep their texture, and the least recently
+    displayed frame is evicted when the cache is full.
+ */
 class RMLUICORE_API ElementLottie : public Element {
 public:
 	RMLUI_RTTI_DefineWithParent(ElementLottie, Element)
@@ -75,16 +88,30 @@ private:
 	bool LoadAnimation();
 	// Update the texture for the next animation frame when necessary.
 	void UpdateTexture();
+	// Starts rendering the given animation frame in the background.
+	void StartFrameRender(size_t frame_index);
+	// Waits for any background frame render to finish, and discards its result.
+	void CancelFrameRender();
+	// Displays the given frame, and adds it to the frame cache if enabled.
+	void SetFrame(SharedPtr<Lottie::FrameData> frame);
+	// Evicts the least recently displayed frames until the frame cache holds at most the given number of frames.
+	void TrimFrameCache(int max_num_frames);
 
 	bool animation_dirty = false;
 	bool geometry_dirty = false;
-	bool texture_size_dirty = false;
 
-	// The texture this element is rendering from.
-	CallbackTexture texture;
-	// The texture data buffer.
-	size_t texture_data_size = 0;
-	UniquePtr<byte[]> texture_data;
+	// The frame currently displayed, along with the texture this element is rendering from.
+	SharedPtr<Lottie::FrameData> frame;
+	// The frame currently being rendered in the background, if any.
+	UniquePtr<Lottie::FrameRender> frame_render;
+
+	// Previously rendered frames of the current animation, indexed by frame number, all with the same dimensions.
+	SmallUnorderedMap<size_t, SharedPtr<Lottie::FrameData>> frame_cache;
+	Vector2i frame_cache_dimensions;
+	// The maximum number of frames to keep in the frame cache, from the 'frame-cache' attribute.
+	int frame_cache_capacity = 0;
+	// Incremented whenever a frame is displayed, used to find the least recently displayed frame.
+	uint64_t frame_use_counter = 0;
 
 	// The animation's intrinsic dimensions.
 	Vector2f intrinsic_dimensions;
@@ -96,8 +123,6 @@ private:
 
 	// The absolute time when the current animation was first displayed.
 	double time_animation_start = -1;
-	// The previous animation frame displayed.
-	size_t prev_animation_frame = size_t(-1);
 
 	UniquePtr<rlottie::Animation> animation;
 };
@@ -29,17 +29,17 @@
 #ifndef RMLUI_SVG_ELEMENT_SVG_H
 #define RMLUI_SVG_ELEMENT_SVG_H
 
-#include "../Core/CallbackTexture.h"
 #include "../Core/Element.h"
 #include "../Core/Geometry.h"
 #include "../Core/Header.h"
 
-namespace lunasvg {
-class Document;
-}
-
 namespace Rml {
 
+namespace SVG {
+	struct SVGDocument;
+	struct SVGTexture;
+} // namespace SVG
+
 class RMLUICORE_API ElementSVG : public Element {
 public:
 	RMLUI_RTTI_DefineWithParent(ElementSVG, Element)
@@ -72,13 +72,16 @@ private:
 	bool LoadSource();
 	// Update the texture when necessary.
 	void UpdateTexture();
+	// Hands the shared document and texture back to the cache.
+	void ReleaseSource();
+	void ReleaseTexture();
 
 	bool source_dirty = false;
 	bool geometry_dirty = false;
 	bool texture_dirty = false;
 
-	// The texture this element is rendering from.
-	CallbackTexture texture;
+	// The texture this element is rendering from, shared with all elements rendering the same document at the same size.
+	SVG::SVGTexture* texture = nullptr;
 
 	// The image's intrinsic dimensions.
 	Vector2f intrinsic_dimensions;
@@ -88,7 +91,8 @@ private:
 	// The geometry used to render this element.
 	Geometry geometry;
 
-	UniquePtr<lunasvg::Document> svg_document;
+	// The parsed document, shared with all elements using the same source.
+	SVG::SVGDocument* svg_document = nullptr;
 };
 
 } // namespace Rml
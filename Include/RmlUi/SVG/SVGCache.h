@@ -0,0 +1,64 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_SVG_SVG_CACHE_H
+#define RMLUI_SVG_SVG_CACHE_H
+
+#include "../Core/Header.h"
+#include "../Core/Types.h"
+
+namespace Rml {
+namespace SVG {
+
+	/**
+	    Statistics about the documents and textures shared between all SVG elements.
+	 */
+	struct CacheStatistics {
+		// Number of parsed documents currently held by the cache.
+		int num_documents = 0;
+		// Number of rasterized textures currently held by the cache, one for each unique combination of source and dimensions.
+		int num_textures = 0;
+
+		// Total size of the source data of the currently held documents, in bytes.
+		size_t document_source_bytes = 0;
+		// Total size of the pixel data of the currently held textures, in bytes.
+		size_t texture_bytes = 0;
+
+		// Number of times a document has been loaded and parsed since initialization.
+		int num_document_loads = 0;
+		// Number of times a document has been rasterized to a texture since initialization.
+		int num_texture_renders = 0;
+	};
+
+	/// Returns statistics about the shared SVG document and texture caches.
+	RMLUICORE_API CacheStatistics GetCacheStatistics();
+
+} // namespace SVG
+} // namespace Rml
+
+#endif
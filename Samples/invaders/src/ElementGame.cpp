@@ -39,6 +39,7 @@
 ElementGame::ElementGame(const Rml::String& tag) : Rml::Element(tag)
 {
 	game = new Game();
+	SetNeedsUpdate(true);
 }
 
 ElementGame::~ElementGame()
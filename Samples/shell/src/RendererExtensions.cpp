@@ -54,6 +54,11 @@
 
 	#include <GLES3/gl3.h>
 
+#elif defined RMLUI_RENDERER_SOFTWARE
+
+	#include <RmlUi_Backend.h>
+	#include <RmlUi_Renderer_Software.h>
+
 #endif
 
 RendererExtensions::Image RendererExtensions::CaptureScreen()
@@ -89,6 +94,38 @@ RendererExtensions::Image RendererExtensions::CaptureScreen()
 
 	return image;
 
+#elif defined RMLUI_RENDERER_SOFTWARE
+
+	const auto& render_interface = static_cast<const RenderInterface_Software&>(*Backend::GetRenderInterface());
+	const Rml::Vector2i size = render_interface.GetFrameSize();
+	const Rml::Span<const Rml::ColourbPremultiplied> pixels = render_interface.GetFramePixels();
+
+	Image image;
+	image.num_components = 3;
+	image.width = size.x;
+	image.height = size.y;
+
+	if (image.width < 1 || image.height < 1 || pixels.size() != size_t(image.width * image.height))
+		return Image();
+
+	const int byte_size = image.width * image.height * image.num_components;
+	image.data = Rml::UniquePtr<Rml::byte[]>(new Rml::byte[byte_size]);
+
+	// Match the bottom-up row order of the OpenGL renderers, with the frame composited onto a black background.
+	for (int y = 0; y < image.height; y++)
+	{
+		const Rml::ColourbPremultiplied* row = pixels.data() + (image.height - y - 1) * image.width;
+		Rml::byte* destination = image.data.get() + y * image.width * image.num_components;
+		for (int x = 0; x < image.width; x++)
+		{
+			destination[3 * x + 0] = row[x].red;
+			destination[3 * x + 1] = row[x].green;
+			destination[3 * x + 2] = row[x].blue;
+		}
+	}
+
+	return image;
+
 #else
 
 	return Image();
@@ -0,0 +1,204 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "AncestorFilter.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "ControlledLifetimeResource.h"
+#include "ElementStyle.h"
+
+namespace Rml {
+
+static constexpr uint32_t num_counter_bits = 12;
+static constexpr uint32_t counter_mask = (1u << num_counter_bits) - 1;
+
+struct AncestorFilterData {
+	struct Parent {
+		const Element* element;
+		// Index of the parent's first hash, only valid once the parent has been hashed.
+		size_t hashes_begin;
+		// True if the parent was added while adding the missing ancestors of an explicitly pushed parent.
+		bool implicit;
+	};
+
+	// Parents are only hashed when the filter is prepared for matching, the first 'num_hashed_parents' have been added to the counters.
+	Vector<Parent> parents;
+	size_t num_hashed_parents = 0;
+	Vector<uint32_t> hashes;
+
+	// Counters saturate at their maximum value, after which they are never decremented. This can only lead to additional false positives.
+	Array<uint8_t, (1u << num_counter_bits)> counters = {};
+};
+
+static ControlledLifetimeResource<AncestorFilterData> ancestor_filter_data;
+
+enum class HashType : uint32_t { Tag = 1, Id = 2, Class = 3 };
+
+static uint32_t GetHash(HashType type, Atom atom)
+{
+	return ((atom << 2) | uint32_t(type)) * 2654435761u;
+}
+
+static void AddHash(uint32_t hash)
+{
+	auto& counters = ancestor_filter_data->counters;
+	for (uint32_t index : {hash & counter_mask, (hash >> num_counter_bits) & counter_mask})
+	{
+		if (counters[index] != 0xff)
+			counters[index] += 1;
+	}
+	ancestor_filter_data->hashes.push_back(hash);
+}
+
+static void RemoveHash(uint32_t hash)
+{
+	auto& counters = ancestor_filter_data->counters;
+	for (uint32_t index : {hash & counter_mask, (hash >> num_counter_bits) & counter_mask})
+	{
+		RMLUI_ASSERT(counters[index] != 0);
+		if (counters[index] != 0xff)
+			counters[index] -= 1;
+	}
+}
+
+static void PushParent(const Element* parent, bool implicit)
+{
+	auto& parents = ancestor_filter_data->parents;
+
+	const Element* grandparent = parent->GetParentNode();
+	const bool ancestors_present = (parents.empty() ? grandparent == nullptr : parents.back().element == grandparent);
+
+	// Add the missing ancestors on top of any existing parents, such as during a nested traversal. Leaving the existing parents in place only
+	// makes the filter more permissive.
+	if (!ancestors_present && grandparent)
+		PushParent(grandparent, true);
+
+	parents.push_back(AncestorFilterData::Parent{parent, 0, implicit});
+}
+
+static void PopParent()
+{
+	auto& parents = ancestor_filter_data->parents;
+	auto& hashes = ancestor_filter_data->hashes;
+	size_t& num_hashed_parents = ancestor_filter_data->num_hashed_parents;
+
+	if (num_hashed_parents == parents.size())
+	{
+		const size_t hashes_begin = parents.back().hashes_begin;
+		for (size_t i = hashes_begin; i < hashes.size(); i++)
+			RemoveHash(hashes[i]);
+
+		hashes.resize(hashes_begin);
+		num_hashed_parents -= 1;
+	}
+
+	parents.pop_back();
+}
+
+static void HashParents()
+{
+	auto& parents = ancestor_filter_data->parents;
+	size_t& num_hashed_parents = ancestor_filter_data->num_hashed_parents;
+
+	for (; num_hashed_parents < parents.size(); num_hashed_parents++)
+	{
+		AncestorFilterData::Parent& parent = parents[num_hashed_parents];
+		parent.hashes_begin = ancestor_filter_data->hashes.size();
+
+		const ElementStyle* style = parent.element->GetStyle();
+		AddHash(GetHash(HashType::Tag, style->GetTagAtom()));
+		if (style->GetIdAtom())
+			AddHash(GetHash(HashType::Id, style->GetIdAtom()));
+		for (Atom class_atom : style->GetClassAtomList())
+			AddHash(GetHash(HashType::Class, class_atom));
+	}
+}
+
+namespace AncestorFilter {
+
+	void Initialize()
+	{
+		ancestor_filter_data.Initialize();
+	}
+
+	void Shutdown()
+	{
+		ancestor_filter_data.Shutdown();
+	}
+
+	uint32_t GetTagHash(Atom tag)
+	{
+		return GetHash(HashType::Tag, tag);
+	}
+
+	uint32_t GetIdHash(Atom id)
+	{
+		return GetHash(HashType::Id, id);
+	}
+
+	uint32_t GetClassHash(Atom class_name)
+	{
+		return GetHash(HashType::Class, class_name);
+	}
+
+	void PushParent(const Element* parent)
+	{
+		Rml::PushParent(parent, false);
+	}
+
+	void PopParent(const Element* parent)
+	{
+		auto& parents = ancestor_filter_data->parents;
+		RMLUI_ASSERT(!parents.empty() && parents.back().element == parent && !parents.back().implicit);
+		(void)parent;
+
+		Rml::PopParent();
+
+		// Remove any ancestors implicitly added for this parent, so that the filter does not outlive the traversal.
+		while (!parents.empty() && parents.back().implicit)
+			Rml::PopParent();
+	}
+
+	bool PrepareFor(const Element* element)
+	{
+		const auto& parents = ancestor_filter_data->parents;
+		if (parents.empty() || parents.back().element != element->GetParentNode())
+			return false;
+
+		HashParents();
+		return true;
+	}
+
+	bool MayContain(uint32_t hash)
+	{
+		const auto& counters = ancestor_filter_data->counters;
+		return counters[hash & counter_mask] != 0 && counters[(hash >> num_counter_bits) & counter_mask] != 0;
+	}
+
+} // namespace AncestorFilter
+
+} // namespace Rml
@@ -0,0 +1,69 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ANCESTORFILTER_H
+#define RMLUI_CORE_ANCESTORFILTER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "AtomTable.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+    A counting bloom filter of the tag, id, and class names of the ancestors of the element currently being updated.
+
+    The filter is maintained during the top-down element update traversal. Style sheet nodes requiring an ancestor with a name not present in the
+    filter can then be rejected without walking the ancestors of the element.
+ */
+namespace AncestorFilter {
+
+	void Initialize();
+	void Shutdown();
+
+	// Get the hashes of the given names, for looking up in the filter.
+	uint32_t GetTagHash(Atom tag);
+	uint32_t GetIdHash(Atom id);
+	uint32_t GetClassHash(Atom class_name);
+
+	// Add the names of the given element to the filter, before visiting its children.
+	// If the element's ancestors are not already on top of the filter, they are added first, starting from the root element.
+	void PushParent(const Element* parent);
+	// Remove the names of the given element from the filter, after visiting its children.
+	void PopParent(const Element* parent);
+
+	// Prepare the filter for matching the given element, returns false if the ancestors of the element are not available in the filter.
+	bool PrepareFor(const Element* element);
+	// Returns false if the filter definitely does not contain the given hash, true if it may contain it.
+	bool MayContain(uint32_t hash);
+
+} // namespace AncestorFilter
+
+} // namespace Rml
+#endif
@@ -26,71 +26,56 @@
  *
  */
 
-#include "TextureLayoutRectangle.h"
+#include "AtomTable.h"
+#include "ControlledLifetimeResource.h"
 
 namespace Rml {
 
-TextureLayoutRectangle::TextureLayoutRectangle(const int _id, const Vector2i dimensions) : dimensions(dimensions), texture_position(0, 0)
-{
-	id = _id;
-	texture_index = -1;
+struct AtomTableData {
+	UnorderedMap<String, Atom> atoms;
+};
 
-	texture_data = nullptr;
-	texture_stride = 0;
-}
+static ControlledLifetimeResource<AtomTableData> atom_table_data;
 
-TextureLayoutRectangle::~TextureLayoutRectangle() {}
+namespace AtomTable {
 
-int TextureLayoutRectangle::GetId() const
-{
-	return id;
-}
+	void Initialize()
+	{
+		atom_table_data.Initialize();
 
-Vector2i TextureLayoutRectangle::GetPosition() const
-{
-	return texture_position;
-}
+		// Intern the most common pseudo-classes first so that they can be represented by pseudo-class masks.
+		const String common_names[] = {"", "hover", "active", "focus", "focus-visible", "checked", "disabled", "selected", "drag"};
+		for (const String& name : common_names)
+			GetOrInsert(name);
 
-Vector2i TextureLayoutRectangle::GetDimensions() const
-{
-	return dimensions;
-}
+		RMLUI_ASSERT(atom_table_data->atoms[""] == 0);
+	}
 
-void TextureLayoutRectangle::Place(const int _texture_index, const Vector2i position)
-{
-	texture_index = _texture_index;
-	texture_position = position;
-}
+	void Shutdown()
+	{
+		atom_table_data.Shutdown();
+	}
 
-void TextureLayoutRectangle::Unplace()
-{
-	texture_index = -1;
-}
+	Atom GetOrInsert(const String& name)
+	{
+		auto& atoms = atom_table_data->atoms;
+		const auto result = atoms.emplace(name, Atom(atoms.size()));
+		return result.first->second;
+	}
 
-bool TextureLayoutRectangle::IsPlaced() const
-{
-	return texture_index > -1;
-}
+	Atom Find(const String& name)
+	{
+		const auto& atoms = atom_table_data->atoms;
+		const auto it = atoms.find(name);
+		return it == atoms.end() ? Unknown : it->second;
+	}
 
-void TextureLayoutRectangle::Allocate(byte* _texture_data, int _texture_stride)
-{
-	texture_data = _texture_data + ((texture_position.y * _texture_stride) + texture_position.x * 4);
-	texture_stride = _texture_stride;
-}
+	uint32_t GetGeneration()
+	{
+		// Atoms are never removed, thus the number of atoms changes whenever a new name is interned.
+		return uint32_t(atom_table_data->atoms.size());
+	}
 
-int TextureLayoutRectangle::GetTextureIndex()
-{
-	return texture_index;
-}
-
-byte* TextureLayoutRectangle::GetTextureData()
-{
-	return texture_data;
-}
-
-int TextureLayoutRectangle::GetTextureStride() const
-{
-	return texture_stride;
-}
+} // namespace AtomTable
 
 } // namespace Rml
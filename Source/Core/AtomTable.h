@@ -0,0 +1,72 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ATOMTABLE_H
+#define RMLUI_CORE_ATOMTABLE_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/// An atom is a small integer uniquely identifying an interned string, such as a tag, id, class or pseudo-class name. Atoms enable
+/// selector matching using integer comparisons. The empty string is always represented by atom zero.
+/// @note Only names used by style sheet selectors are interned, they stay interned until the table is cleared during Rml::Shutdown().
+/// Names of elements are only looked up, thus class names generated at runtime do not grow the table.
+using Atom = uint32_t;
+
+namespace AtomTable {
+
+	void Initialize();
+	// Clears the table, invalidating all atoms.
+	void Shutdown();
+
+	// Represents names which are not interned, thereby not used by any selector. Never matches any selector.
+	constexpr Atom Unknown = Atom(-1);
+
+	// Get the atom for the given name.
+	// If not found: Interns the name as a new atom. Should only be used for names in selectors.
+	Atom GetOrInsert(const String& name);
+
+	// Get the atom for the given name.
+	// If not found: Returns AtomTable::Unknown.
+	Atom Find(const String& name);
+
+	// Returns a value which changes whenever a new name is interned, so that users holding unknown atoms can look them up again.
+	uint32_t GetGeneration();
+
+	// Returns the bit representing the given pseudo-class atom in a pseudo-class mask, or zero if the atom is too large to be represented.
+	// The most common pseudo-classes are interned first, so that these are always represented.
+	inline uint32_t GetPseudoClassBit(Atom atom)
+	{
+		return atom < 32 ? (1u << atom) : 0u;
+	}
+
+} // namespace AtomTable
+
+} // namespace Rml
+#endif
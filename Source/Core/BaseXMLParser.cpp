@@ -100,6 +100,11 @@ const URL* BaseXMLParser::GetSourceURLPtr() const
 	return source_url;
 }
 
+void BaseXMLParser::SetSourceURLPtr(const URL* url)
+{
+	source_url = url;
+}
+
 void BaseXMLParser::Next()
 {
 	xml_index += 1;
@@ -29,9 +29,22 @@
 #include "../../Include/RmlUi/Core/CallbackTexture.h"
 #include "../../Include/RmlUi/Core/Texture.h"
 #include "RenderManagerAccess.h"
+#include <string.h>
 
 namespace Rml {
 
+void CallbackTexture::Invalidate()
+{
+	if (resource_handle != StableVectorIndex::Invalid)
+		RenderManagerAccess::InvalidateCallbackTexture(render_manager, resource_handle);
+}
+
+void CallbackTexture::InvalidateRegion(Rectanglei region)
+{
+	if (resource_handle != StableVectorIndex::Invalid)
+		RenderManagerAccess::InvalidateCallbackTextureRegion(render_manager, resource_handle, region);
+}
+
 void CallbackTexture::Release()
 {
 	if (resource_handle != StableVectorIndex::Invalid)
@@ -47,22 +60,103 @@ Rml::CallbackTexture::operator Texture() const
 }
 
 CallbackTextureInterface::CallbackTextureInterface(RenderManager& render_manager, RenderInterface& render_interface, TextureHandle& texture_handle,
-	Vector2i& dimensions) : render_manager(render_manager), render_interface(render_interface), texture_handle(texture_handle), dimensions(dimensions)
+	Vector2i& dimensions, bool& alpha_texture, Rectanglei update_region) :
+	render_manager(render_manager), render_interface(render_interface), texture_handle(texture_handle), dimensions(dimensions),
+	alpha_texture(alpha_texture), update_region(update_region)
 {}
 
 bool CallbackTextureInterface::GenerateTexture(Span<const byte> source, Vector2i new_dimensions) const
 {
 	if (texture_handle)
 	{
+		if (update_region.Valid())
+			return UpdateTextureRegion(source, new_dimensions, false);
 		RMLUI_ERRORMSG("Texture already set");
 		return false;
 	}
 	texture_handle = render_interface.GenerateTexture(source, new_dimensions);
 	if (texture_handle)
+	{
 		dimensions = new_dimensions;
+		alpha_texture = false;
+	}
 	return texture_handle != TextureHandle{};
 }
 
+bool CallbackTextureInterface::GenerateAlphaTexture(Span<const byte> source, Vector2i new_dimensions) const
+{
+	if (texture_handle)
+	{
+		if (update_region.Valid())
+			return UpdateTextureRegion(source, new_dimensions, true);
+		RMLUI_ERRORMSG("Texture already set");
+		return false;
+	}
+	texture_handle = render_interface.GenerateAlphaTexture(source, new_dimensions);
+	if (texture_handle)
+	{
+		dimensions = new_dimensions;
+		alpha_texture = true;
+		return true;
+	}
+
+	// Single-channel textures are not supported by the render interface, expand the data to premultiplied RGBA.
+	Vector<byte> rgba_source(source.size() * 4);
+	for (size_t i = 0; i < source.size(); i++)
+	{
+		for (size_t c = 0; c < 4; c++)
+			rgba_source[i * 4 + c] = source[i];
+	}
+	return GenerateTexture(rgba_source, new_dimensions);
+}
+
+bool CallbackTextureInterface::UpdateTextureRegion(Span<const byte> source, Vector2i source_dimensions, bool source_alpha) const
+{
+	if (source_dimensions == dimensions)
+	{
+		const Rectanglei region = update_region.Intersect(Rectanglei::FromSize(source_dimensions));
+		if (region.Width() <= 0 || region.Height() <= 0)
+			return true;
+
+		// Pack the rows of the region, using the same format as the existing texture. Single-channel data is expanded to premultiplied RGBA
+		// when the render interface did not support single-channel textures.
+		const int source_bytes_per_pixel = (source_alpha ? 1 : 4);
+		const int texture_bytes_per_pixel = (alpha_texture ? 1 : 4);
+		const Vector2i size = region.Size();
+		Vector<byte> region_data(size_t(size.x * size.y * texture_bytes_per_pixel));
+
+		for (int y = 0; y < size.y; y++)
+		{
+			const byte* source_row = source.data() + ((region.Top() + y) * source_dimensions.x + region.Left()) * source_bytes_per_pixel;
+			byte* destination_row = region_data.data() + y * size.x * texture_bytes_per_pixel;
+			if (source_bytes_per_pixel == texture_bytes_per_pixel)
+			{
+				memcpy(destination_row, source_row, size_t(size.x * texture_bytes_per_pixel));
+			}
+			else
+			{
+				for (int x = 0; x < size.x; x++)
+				{
+					for (int c = 0; c < 4; c++)
+						destination_row[x * 4 + c] = source_row[x];
+				}
+			}
+		}
+
+		if (render_interface.UpdateTexture(texture_handle, region_data, region))
+			return true;
+	}
+
+	// Texture updates are not supported by the render interface, generate the whole texture again instead.
+	render_interface.ReleaseTexture(texture_handle);
+	texture_handle = {};
+	dimensions = {};
+
+	if (source_alpha)
+		return GenerateAlphaTexture(source, source_dimensions);
+	return GenerateTexture(source, source_dimensions);
+}
+
 void CallbackTextureInterface::SaveLayerAsTexture() const
 {
 	if (texture_handle)
@@ -109,4 +203,16 @@ Texture CallbackTextureSource::GetTexture(RenderManager& render_manager) const
 	return Texture(texture);
 }
 
+void CallbackTextureSource::Invalidate()
+{
+	for (auto& pair : textures)
+		pair.second.Invalidate();
+}
+
+void CallbackTextureSource::InvalidateRegion(Rectanglei region)
+{
+	for (auto& pair : textures)
+		pair.second.InvalidateRegion(region);
+}
+
 } // namespace Rml
@@ -41,7 +41,11 @@
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "DataModel.h"
 #include "EventDispatcher.h"
+#include "HitTestIndex.h"
 #include "PluginRegistry.h"
+#include "PooledContainer.h"
+#include "RenderCommandList.h"
+#include "RenderManagerAccess.h"
 #include "ScrollController.h"
 #include "StreamFile.h"
 #include <algorithm>
@@ -54,6 +58,25 @@ static constexpr float DOUBLE_CLICK_TIME = 0.5f;    // [s]
 static constexpr float DOUBLE_CLICK_MAX_DIST = 3.f; // [dp]
 static constexpr float UNIT_SCROLL_LENGTH = 80.f;   // [dp]
 
+// Builds the path from the root element down to the given element.
+static void BuildElementPath(Element* element, Vector<Element*>& path)
+{
+	path.clear();
+	for (; element; element = element->GetParentNode())
+		path.push_back(element);
+	std::reverse(path.begin(), path.end());
+}
+
+// Returns the number of leading elements shared by the two paths, i.e. the length of the path to their closest common ancestor.
+static size_t GetNumSharedElements(const Vector<Element*>& path_a, const Vector<Element*>& path_b)
+{
+	const size_t num_elements = Math::Min(path_a.size(), path_b.size());
+	size_t i = 0;
+	while (i < num_elements && path_a[i] == path_b[i])
+		i++;
+	return i;
+}
+
 Context::Context(const String& name, RenderManager* render_manager, TextInputHandler* text_input_handler) :
 	name(name), render_manager(render_manager), text_input_handler(text_input_handler)
 {
@@ -125,6 +148,7 @@ void Context::SetDimensions(const Vector2i _dimensions)
 	if (dimensions != _dimensions)
 	{
 		dimensions = _dimensions;
+		DirtyRenderCache();
 		render_manager->SetViewport(dimensions);
 		root->SetBox(Box(Vector2f(dimensions)));
 		root->DirtyLayout();
@@ -154,6 +178,7 @@ void Context::SetDensityIndependentPixelRatio(float dp_ratio)
 	if (density_independent_pixel_ratio != dp_ratio)
 	{
 		density_independent_pixel_ratio = dp_ratio;
+		DirtyRenderCache();
 
 		for (int i = 0; i < root->GetNumChildren(true); ++i)
 		{
@@ -218,6 +243,17 @@ bool Context::Render()
 
 	render_manager->PrepareRender(dimensions);
 
+	if (IsRenderCacheValid())
+	{
+		RenderManagerAccess::Replay(render_manager, *render_cache);
+		return true;
+	}
+
+	// Anything dirtying the cache while rendering, such as a render callback, invalidates this recording.
+	render_cache_dirty = false;
+	if (render_cache_enabled)
+		RenderManagerAccess::BeginRecording(render_manager, render_cache.get());
+
 	root->Render();
 
 	// Render the cursor proxy so that any attached drag clone will be rendered below the cursor.
@@ -231,6 +267,13 @@ bool Context::Render()
 
 	render_manager->ResetState();
 
+	if (render_cache_enabled)
+	{
+		if (!RenderManagerAccess::EndRecording(render_manager) || drag_clone)
+			render_cache_dirty = true;
+		render_cache_resource_generation = RenderManagerAccess::GetResourceGeneration(render_manager);
+	}
+
 	return true;
 }
 
@@ -519,27 +562,27 @@ void Context::RemoveEventListener(const String& event, EventListener* listener,
 bool Context::ProcessKeyDown(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
 	// Generate the parameters for the key event.
-	Dictionary parameters;
-	GenerateKeyEventParameters(parameters, key_identifier);
-	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
+	PooledContainer<Dictionary> parameters(event_parameters_pool);
+	GenerateKeyEventParameters(*parameters, key_identifier);
+	GenerateKeyModifierEventParameters(*parameters, key_modifier_state);
 
 	if (focus)
-		return focus->DispatchEvent(EventId::Keydown, parameters);
+		return focus->DispatchEvent(EventId::Keydown, *parameters);
 	else
-		return root->DispatchEvent(EventId::Keydown, parameters);
+		return root->DispatchEvent(EventId::Keydown, *parameters);
 }
 
 bool Context::ProcessKeyUp(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
 	// Generate the parameters for the key event.
-	Dictionary parameters;
-	GenerateKeyEventParameters(parameters, key_identifier);
-	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
+	PooledContainer<Dictionary> parameters(event_parameters_pool);
+	GenerateKeyEventParameters(*parameters, key_identifier);
+	GenerateKeyModifierEventParameters(*parameters, key_modifier_state);
 
 	if (focus)
-		return focus->DispatchEvent(EventId::Keyup, parameters);
+		return focus->DispatchEvent(EventId::Keyup, *parameters);
 	else
-		return root->DispatchEvent(EventId::Keyup, parameters);
+		return root->DispatchEvent(EventId::Keyup, *parameters);
 }
 
 bool Context::ProcessTextInput(char character)
@@ -578,18 +621,18 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 	mouse_active = true;
 
 	// Update the current hover chain. This will send all necessary 'onmouseout', 'onmouseover', 'ondragout' and 'ondragover' messages.
-	Dictionary parameters, drag_parameters;
-	UpdateHoverChain(old_mouse_position, key_modifier_state, &parameters, &drag_parameters);
+	PooledContainer<Dictionary> parameters(event_parameters_pool), drag_parameters(event_parameters_pool);
+	UpdateHoverChain(old_mouse_position, key_modifier_state, &*parameters, &*drag_parameters);
 
 	// Dispatch any 'onmousemove' events.
 	if (mouse_moved)
 	{
 		if (hover)
 		{
-			hover->DispatchEvent(EventId::Mousemove, parameters);
+			hover->DispatchEvent(EventId::Mousemove, *parameters);
 
 			if (drag_hover && drag_verbose)
-				drag_hover->DispatchEvent(EventId::Dragmove, drag_parameters);
+				drag_hover->DispatchEvent(EventId::Dragmove, *drag_parameters);
 		}
 	}
 
@@ -612,9 +655,9 @@ static Element* FindFocusElement(Element* element)
 
 bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 {
-	Dictionary parameters;
-	GenerateMouseEventParameters(parameters, button_index);
-	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
+	PooledContainer<Dictionary> parameters(event_parameters_pool);
+	GenerateMouseEventParameters(*parameters, button_index);
+	GenerateKeyModifierEventParameters(*parameters, key_modifier_state);
 
 	bool propagate = true;
 
@@ -638,7 +681,7 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 
 		// Call 'onmousedown' on every item in the hover chain, and copy the hover chain to the active chain.
 		if (hover)
-			propagate = hover->DispatchEvent(EventId::Mousedown, parameters);
+			propagate = hover->DispatchEvent(EventId::Mousedown, *parameters);
 
 		if (propagate)
 		{
@@ -653,7 +696,7 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 				mouse_distance_squared < max_mouse_distance * max_mouse_distance)
 			{
 				if (hover)
-					propagate = hover->DispatchEvent(EventId::Dblclick, parameters);
+					propagate = hover->DispatchEvent(EventId::Dblclick, *parameters);
 
 				last_click_element = nullptr;
 				last_click_time = 0;
@@ -692,7 +735,7 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 	{
 		// Not the primary mouse button, so we're not doing any special processing.
 		if (hover)
-			propagate = hover->DispatchEvent(EventId::Mousedown, parameters);
+			propagate = hover->DispatchEvent(EventId::Mousedown, *parameters);
 	}
 
 	if (scroll_controller->GetMode() == ScrollController::Mode::Autoscroll)
@@ -701,13 +744,13 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 	}
 	else if (button_index == 2 && hover && propagate)
 	{
-		Dictionary scroll_parameters;
-		GenerateMouseEventParameters(scroll_parameters);
-		GenerateKeyModifierEventParameters(scroll_parameters, key_modifier_state);
-		scroll_parameters["autoscroll"] = true;
+		PooledContainer<Dictionary> scroll_parameters(event_parameters_pool);
+		GenerateMouseEventParameters(*scroll_parameters);
+		GenerateKeyModifierEventParameters(*scroll_parameters, key_modifier_state);
+		(*scroll_parameters)["autoscroll"] = true;
 
 		// Dispatch a mouse scroll event, this gives elements an opportunity to block autoscroll from being initialized.
-		if (hover->DispatchEvent(EventId::Mousescroll, scroll_parameters))
+		if (hover->DispatchEvent(EventId::Mousescroll, *scroll_parameters))
 			scroll_controller->ActivateAutoscroll(hover->GetClosestScrollableContainer(), mouse_position);
 	}
 
@@ -716,9 +759,9 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 
 bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 {
-	Dictionary parameters;
-	GenerateMouseEventParameters(parameters, button_index);
-	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
+	PooledContainer<Dictionary> parameters(event_parameters_pool);
+	GenerateMouseEventParameters(*parameters, button_index);
+	GenerateKeyModifierEventParameters(*parameters, key_modifier_state);
 
 	// We want to return the interaction state before handling the mouse up events, so that any active element that is released is considered to
 	// capture the event.
@@ -729,13 +772,13 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 	{
 		// The elements in the new hover chain have the 'onmouseup' event called on them.
 		if (hover)
-			hover->DispatchEvent(EventId::Mouseup, parameters);
+			hover->DispatchEvent(EventId::Mouseup, *parameters);
 
 		// If the active element (the one that was being hovered over when the mouse button was pressed) is still being
 		// hovered over, we click it.
 		if (hover && active && active == FindFocusElement(hover))
 		{
-			active->DispatchEvent(EventId::Click, parameters);
+			active->DispatchEvent(EventId::Click, *parameters);
 		}
 
 		// Unset the 'active' pseudo-class on all the elements in the active chain; because they may not necessarily
@@ -749,24 +792,24 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 		{
 			if (drag_started)
 			{
-				Dictionary drag_parameters;
-				GenerateMouseEventParameters(drag_parameters);
-				GenerateDragEventParameters(drag_parameters);
-				GenerateKeyModifierEventParameters(drag_parameters, key_modifier_state);
+				PooledContainer<Dictionary> drag_parameters(event_parameters_pool);
+				GenerateMouseEventParameters(*drag_parameters);
+				GenerateDragEventParameters(*drag_parameters);
+				GenerateKeyModifierEventParameters(*drag_parameters, key_modifier_state);
 
 				if (drag_hover)
 				{
 					if (drag_verbose)
 					{
-						drag_hover->DispatchEvent(EventId::Dragdrop, drag_parameters);
+						drag_hover->DispatchEvent(EventId::Dragdrop, *drag_parameters);
 						// User may have removed the element, do an extra check.
 						if (drag_hover)
-							drag_hover->DispatchEvent(EventId::Dragout, drag_parameters);
+							drag_hover->DispatchEvent(EventId::Dragout, *drag_parameters);
 					}
 				}
 
 				if (drag)
-					drag->DispatchEvent(EventId::Dragend, drag_parameters);
+					drag->DispatchEvent(EventId::Dragend, *drag_parameters);
 
 				ReleaseDragClone();
 			}
@@ -783,7 +826,7 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 	{
 		// Not the left mouse button, so we're not doing any special processing.
 		if (hover)
-			hover->DispatchEvent(EventId::Mouseup, parameters);
+			hover->DispatchEvent(EventId::Mouseup, *parameters);
 	}
 
 	// If we have autoscrolled while holding the middle mouse button, release the autoscroll mode now.
@@ -811,14 +854,14 @@ bool Context::ProcessMouseWheel(Vector2f wheel_delta, int key_modifier_state)
 		return true;
 	}
 
-	Dictionary scroll_parameters;
-	GenerateMouseEventParameters(scroll_parameters);
-	GenerateKeyModifierEventParameters(scroll_parameters, key_modifier_state);
-	scroll_parameters["wheel_delta_x"] = wheel_delta.x;
-	scroll_parameters["wheel_delta_y"] = wheel_delta.y;
+	PooledContainer<Dictionary> scroll_parameters(event_parameters_pool);
+	GenerateMouseEventParameters(*scroll_parameters);
+	GenerateKeyModifierEventParameters(*scroll_parameters, key_modifier_state);
+	(*scroll_parameters)["wheel_delta_x"] = wheel_delta.x;
+	(*scroll_parameters)["wheel_delta_y"] = wheel_delta.y;
 
 	// Dispatch a mouse scroll event, this gives elements an opportunity to block scrolling from being performed.
-	if (!hover->DispatchEvent(EventId::Mousescroll, scroll_parameters))
+	if (!hover->DispatchEvent(EventId::Mousescroll, *scroll_parameters))
 		return false;
 
 	const float unit_scroll_length = UNIT_SCROLL_LENGTH * density_independent_pixel_ratio;
@@ -915,7 +958,7 @@ bool Context::RemoveDataModel(const String& name)
 
 void Context::OnElementDetach(Element* element)
 {
-	auto it_hover = hover_chain.find(element);
+	auto it_hover = std::find(hover_chain.begin(), hover_chain.end(), element);
 	if (it_hover != hover_chain.end())
 	{
 		Dictionary parameters;
@@ -939,7 +982,7 @@ void Context::OnElementDetach(Element* element)
 
 	if (drag)
 	{
-		auto it = drag_hover_chain.find(element);
+		auto it = std::find(drag_hover_chain.begin(), drag_hover_chain.end(), element);
 		if (it != drag_hover_chain.end())
 		{
 			drag_hover_chain.erase(it);
@@ -1063,9 +1106,9 @@ void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_sta
 {
 	const Vector2f position(mouse_position);
 
-	Dictionary local_parameters, local_drag_parameters;
-	Dictionary& parameters = out_parameters ? *out_parameters : local_parameters;
-	Dictionary& drag_parameters = out_drag_parameters ? *out_drag_parameters : local_drag_parameters;
+	PooledContainer<Dictionary> local_parameters(event_parameters_pool), local_drag_parameters(event_parameters_pool);
+	Dictionary& parameters = out_parameters ? *out_parameters : *local_parameters;
+	Dictionary& drag_parameters = out_drag_parameters ? *out_drag_parameters : *local_drag_parameters;
 
 	// Generate the parameters for the mouse events (there could be a few!).
 	GenerateMouseEventParameters(parameters);
@@ -1119,44 +1162,40 @@ void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_sta
 		}
 	}
 
-	// Build the new hover chain.
-	ElementSet new_hover_chain;
-	Element* element = hover;
-	while (element != nullptr)
+	// The hover chain only needs to be rebuilt when the hovered element changes. Elements are removed from the chain as soon as they are
+	// detached, which also detaches all of their descendants, so the chain always remains a valid path down from the root element.
+	if (hover != (hover_chain.empty() ? nullptr : hover_chain.back()))
 	{
-		new_hover_chain.insert(element);
-		element = element->GetParentNode();
+		PooledContainer<ElementList> old_hover_chain(element_list_pool);
+		old_hover_chain->swap(hover_chain);
+		BuildElementPath(hover, hover_chain);
+		const size_t num_shared = GetNumSharedElements(*old_hover_chain, hover_chain);
+
+		// Send mouseout / mouseover events, the hover state is updated by their default actions.
+		SendEvents(*old_hover_chain, num_shared, true, EventId::Mouseout, parameters);
+		SendEvents(hover_chain, num_shared, false, EventId::Mouseover, parameters);
 	}
 
-	// Send mouseout / mouseover events.
-	SendEvents(hover_chain, new_hover_chain, EventId::Mouseout, parameters);
-	SendEvents(new_hover_chain, hover_chain, EventId::Mouseover, parameters);
-
 	// Send out drag events.
 	if (drag && mouse_active)
 	{
 		drag_hover = GetElementAtPoint(position, drag);
 
-		ElementSet new_drag_hover_chain;
-		element = drag_hover;
-		while (element != nullptr)
+		if (drag_hover != (drag_hover_chain.empty() ? nullptr : drag_hover_chain.back()))
 		{
-			new_drag_hover_chain.insert(element);
-			element = element->GetParentNode();
-		}
+			PooledContainer<ElementList> old_drag_hover_chain(element_list_pool);
+			old_drag_hover_chain->swap(drag_hover_chain);
+			BuildElementPath(drag_hover, drag_hover_chain);
 
-		if (drag_started && drag_verbose)
-		{
-			// Send out ondragover and ondragout events as appropriate.
-			SendEvents(drag_hover_chain, new_drag_hover_chain, EventId::Dragout, drag_parameters);
-			SendEvents(new_drag_hover_chain, drag_hover_chain, EventId::Dragover, drag_parameters);
+			if (drag_started && drag_verbose)
+			{
+				// Send out ondragover and ondragout events as appropriate.
+				const size_t num_shared = GetNumSharedElements(*old_drag_hover_chain, drag_hover_chain);
+				SendEvents(*old_drag_hover_chain, num_shared, true, EventId::Dragout, drag_parameters);
+				SendEvents(drag_hover_chain, num_shared, false, EventId::Dragover, drag_parameters);
+			}
 		}
-
-		drag_hover_chain.swap(new_drag_hover_chain);
 	}
-
-	// Swap the new chain in.
-	hover_chain.swap(new_hover_chain);
 }
 
 Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_element, Element* element) const
@@ -1184,11 +1223,11 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 	// that is under the cursor.
 	if (element->local_stacking_context)
 	{
-		if (element->stacking_context_dirty)
-			element->BuildLocalStackingContext();
+		// Only visit the stacking children whose bounds may contain the point, as given by the hit test index.
+		element->UpdateHitTestIndex();
 
-		for (int i = (int)element->stacking_context.size() - 1; i >= 0; --i)
-		{
+		Element* child_element = nullptr;
+		element->hit_test_index->FindLast(point, [&](int i) {
 			Element* stacking_child = element->stacking_context[i];
 			if (ignore_element)
 			{
@@ -1203,20 +1242,22 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 				}
 
 				if (element_hierarchy)
-					continue;
+					return false;
 			}
 
 			if (is_modal)
 			{
 				ElementDocument* child_document = stacking_child->GetOwnerDocument();
 				if (!child_document || !(child_document == focus_document || child_document->IsFocusableFromModal()))
-					continue;
+					return false;
 			}
 
-			Element* child_element = GetElementAtPoint(point, ignore_element, stacking_child);
-			if (child_element)
-				return child_element;
-		}
+			child_element = GetElementAtPoint(point, ignore_element, stacking_child);
+			return child_element != nullptr;
+		});
+
+		if (child_element)
+			return child_element;
 	}
 
 	// Ignore elements whose pointer events are disabled.
@@ -1376,9 +1417,25 @@ private:
 void Context::SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters)
 {
 	// We put our elements in observer pointers in case some of them are deleted during dispatch.
-	ElementObserverList elements;
-	std::set_difference(old_items.begin(), old_items.end(), new_items.begin(), new_items.end(), ElementObserverListBackInserter(elements));
-	for (auto& element : elements)
+	PooledContainer<ElementObserverList> elements(element_observer_list_pool);
+	std::set_difference(old_items.begin(), old_items.end(), new_items.begin(), new_items.end(), ElementObserverListBackInserter(*elements));
+	for (auto& element : *elements)
+	{
+		if (element)
+			element->DispatchEvent(id, parameters);
+	}
+}
+
+void Context::SendEvents(const ElementList& path, size_t num_shared, bool leaf_first, EventId id, const Dictionary& parameters)
+{
+	// We put our elements in observer pointers in case some of them are deleted during dispatch.
+	PooledContainer<ElementObserverList> elements(element_observer_list_pool);
+	for (size_t i = num_shared; i < path.size(); i++)
+		elements->push_back(path[i]->GetObserverPtr());
+	if (leaf_first)
+		std::reverse(elements->begin(), elements->end());
+
+	for (auto& element : *elements)
 	{
 		if (element)
 			element->DispatchEvent(id, parameters);
@@ -1407,6 +1464,9 @@ void Context::RequestNextUpdate(double delay)
 {
 	RMLUI_ASSERT(delay >= 0.0);
 	next_update_timeout = Math::Min(next_update_timeout, delay);
+
+	// Elements request updates when their rendered output is changing over time, e.g. during animations.
+	DirtyRenderCache();
 }
 
 double Context::GetNextUpdateDelay() const
@@ -1414,4 +1474,25 @@ double Context::GetNextUpdateDelay() const
 	return next_update_timeout;
 }
 
+void Context::EnableRenderCache(bool enable)
+{
+	render_cache_enabled = enable;
+	render_cache_dirty = true;
+	if (enable && !render_cache)
+		render_cache = MakeUnique<RenderCommandList>();
+	else if (!enable)
+		render_cache.reset();
+}
+
+void Context::DirtyRenderCache()
+{
+	render_cache_dirty = true;
+}
+
+bool Context::IsRenderCacheValid() const
+{
+	return render_cache_enabled && !render_cache_dirty && !drag_clone &&
+		render_cache_resource_generation == RenderManagerAccess::GetResourceGeneration(render_manager);
+}
+
 } // namespace Rml
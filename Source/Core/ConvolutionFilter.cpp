@@ -28,13 +28,102 @@
 
 #include "../../Include/RmlUi/Core/ConvolutionFilter.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "Memory.h"
+#include <algorithm>
 #include <float.h>
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define RMLUI_CONVOLUTION_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#include <arm_neon.h>
+	#define RMLUI_CONVOLUTION_NEON
+#endif
+
 namespace Rml {
 
-ConvolutionFilter::ConvolutionFilter() {}
+// Kernel rows with a run of equal weights at least this long are dilated using a sliding window maximum.
+static constexpr int min_dilation_run_length = 4;
+
+struct KernelRun {
+	int begin = 0;
+	int length = 0;
+};
+
+// accumulator[i] += weight * source[i]
+static void MultiplyAdd(float* accumulator, const float* source, const float weight, const int count)
+{
+	int i = 0;
+#if defined(RMLUI_CONVOLUTION_SSE2)
+	const __m128 weight4 = _mm_set1_ps(weight);
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(accumulator + i, _mm_add_ps(_mm_loadu_ps(accumulator + i), _mm_mul_ps(_mm_loadu_ps(source + i), weight4)));
+#elif defined(RMLUI_CONVOLUTION_NEON)
+	const float32x4_t weight4 = vdupq_n_f32(weight);
+	for (; i + 4 <= count; i += 4)
+		vst1q_f32(accumulator + i, vaddq_f32(vld1q_f32(accumulator + i), vmulq_f32(vld1q_f32(source + i), weight4)));
+#endif
+	for (; i < count; i++)
+		accumulator[i] += source[i] * weight;
+}
+
+// accumulator[i] = max(accumulator[i], weight * source[i])
+static void MultiplyMax(float* accumulator, const float* source, const float weight, const int count)
+{
+	int i = 0;
+#if defined(RMLUI_CONVOLUTION_SSE2)
+	const __m128 weight4 = _mm_set1_ps(weight);
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(accumulator + i, _mm_max_ps(_mm_loadu_ps(accumulator + i), _mm_mul_ps(_mm_loadu_ps(source + i), weight4)));
+#elif defined(RMLUI_CONVOLUTION_NEON)
+	const float32x4_t weight4 = vdupq_n_f32(weight);
+	for (; i + 4 <= count; i += 4)
+		vst1q_f32(accumulator + i, vmaxq_f32(vld1q_f32(accumulator + i), vmulq_f32(vld1q_f32(source + i), weight4)));
+#endif
+	for (; i < count; i++)
+		accumulator[i] = Math::Max(accumulator[i], source[i] * weight);
+}
 
+// Sets result[i] to the maximum of source[i, i + window). Uses the van Herk/Gil-Werman algorithm, whose cost is independent of the window
+// size. The last (window - 1) values of the result are undefined.
+static void WindowMax(float* result, float* scratch, const float* source, const int count, const int window)
+{
+	for (int block_begin = 0; block_begin < count; block_begin += window)
+	{
+		const int block_end = Math::Min(block_begin + window, count);
+
+		scratch[block_begin] = source[block_begin];
+		for (int i = block_begin + 1; i < block_end; i++)
+			scratch[i] = Math::Max(scratch[i - 1], source[i]);
+
+		result[block_end - 1] = source[block_end - 1];
+		for (int i = block_end - 2; i >= block_begin; i--)
+			result[i] = Math::Max(result[i + 1], source[i]);
+	}
+
+	for (int i = 0; i + window <= count; i++)
+		result[i] = Math::Max(result[i], scratch[i + window - 1]);
+}
+
+// Finds the longest run of equal, positive weights in the kernel row.
+static KernelRun FindLongestRun(const float* weights, const int count)
+{
+	KernelRun longest;
+	for (int begin = 0; begin < count;)
+	{
+		int end = begin + 1;
+		while (end < count && weights[end] == weights[begin])
+			end++;
+
+		if (weights[begin] > 0.f && end - begin > longest.length)
+			longest = KernelRun{begin, end - begin};
+		begin = end;
+	}
+	return longest;
+}
+
+ConvolutionFilter::ConvolutionFilter() {}
 ConvolutionFilter::~ConvolutionFilter() {}
 
 bool ConvolutionFilter::Initialise(int _kernel_radius, FilterOperation _operation)
@@ -73,6 +162,9 @@ void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimens
 {
 	RMLUI_ZoneScopedNC("ConvFilter::Run", 0xd6bf49);
 
+	if (destination_dimensions.x <= 0 || destination_dimensions.y <= 0)
+		return;
+
 	const int destination_bytes_per_pixel = (destination_color_format == ColorFormat::RGBA8 ? 4 : 1);
 	const int destination_alpha_offset = (destination_color_format == ColorFormat::RGBA8 ? 3 : 0);
 	const int source_bytes_per_pixel = (source_color_format == ColorFormat::RGBA8 ? 4 : 1);
@@ -80,38 +172,90 @@ void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimens
 
 	const Vector2i kernel_radius = (kernel_size - Vector2i(1)) / 2;
 
+	// Copy the source opacity into a zero-padded buffer covering every pixel reachable by the kernel from the destination region. Then each
+	// kernel weight can be applied to a full destination row at once, without any bounds checks.
+	const Vector2i padded_dimensions = destination_dimensions + kernel_size - Vector2i(1);
+	const Vector2i padded_origin = -source_offset - kernel_radius;
+	const int source_x_begin = Math::Clamp(-padded_origin.x, 0, padded_dimensions.x);
+	const int source_x_end = Math::Clamp(source_dimensions.x - padded_origin.x, source_x_begin, padded_dimensions.x);
+
+	DynamicArray<float, GlobalStackAllocator<float>> padded(size_t(padded_dimensions.x * padded_dimensions.y));
+	for (int y = 0; y < padded_dimensions.y; y++)
+	{
+		float* padded_row = padded.data() + y * padded_dimensions.x;
+		const int source_y = y + padded_origin.y;
+		if (source_y < 0 || source_y >= source_dimensions.y)
+		{
+			std::fill(padded_row, padded_row + padded_dimensions.x, 0.f);
+			continue;
+		}
+
+		const byte* source_row = source + source_y * source_dimensions.x * source_bytes_per_pixel + source_alpha_offset;
+		std::fill(padded_row, padded_row + source_x_begin, 0.f);
+		for (int x = source_x_begin; x < source_x_end; x++)
+			padded_row[x] = float(source_row[(x + padded_origin.x) * source_bytes_per_pixel]);
+		std::fill(padded_row + source_x_end, padded_row + padded_dimensions.x, 0.f);
+	}
+
+	// The dilation of a run of equal weights is the weight times the maximum source value in the window, so wide kernels need only a few
+	// operations per pixel and kernel row, instead of one per weight.
+	DynamicArray<KernelRun, GlobalStackAllocator<KernelRun>> dilation_runs(operation == FilterOperation::Dilation ? size_t(kernel_size.y) : 0);
+	DynamicArray<float, GlobalStackAllocator<float>> window_max(operation == FilterOperation::Dilation ? size_t(padded_dimensions.x) * 2 : 0);
+	if (operation == FilterOperation::Dilation)
+	{
+		for (int kernel_y = 0; kernel_y < kernel_size.y; kernel_y++)
+		{
+			dilation_runs[kernel_y] = FindLongestRun(kernel.get() + kernel_y * kernel_size.x, kernel_size.x);
+			if (dilation_runs[kernel_y].length < min_dilation_run_length)
+				dilation_runs[kernel_y] = {};
+		}
+	}
+
+	DynamicArray<float, GlobalStackAllocator<float>> opacity(size_t(destination_dimensions.x));
+
 	for (int y = 0; y < destination_dimensions.y; ++y)
 	{
-		for (int x = 0; x < destination_dimensions.x; ++x)
+		std::fill(opacity.data(), opacity.data() + destination_dimensions.x, 0.f);
+
+		for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
 		{
-			float opacity = 0.f;
+			const float* padded_row = padded.data() + (y + kernel_y) * padded_dimensions.x;
+			const float* weights = kernel.get() + kernel_y * kernel_size.x;
 
-			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+			switch (operation)
+			{
+			case FilterOperation::Sum:
 			{
-				const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
-
 				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
 				{
-					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
-					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
-					{
-						const int source_index = (source_y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset;
-						const float pixel_opacity = float(source[source_index]) * kernel[kernel_y * kernel_size.x + kernel_x];
-
-						switch (operation)
-						{
-						case FilterOperation::Sum: opacity += pixel_opacity; break;
-						case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
-						}
-					}
+					if (weights[kernel_x] != 0.f)
+						MultiplyAdd(opacity.data(), padded_row + kernel_x, weights[kernel_x], destination_dimensions.x);
 				}
 			}
+			break;
+			case FilterOperation::Dilation:
+			{
+				// Non-positive weights can never increase the opacity beyond its initial value of zero, and are skipped.
+				const KernelRun run = dilation_runs[kernel_y];
+				if (run.length > 0)
+				{
+					WindowMax(window_max.data(), window_max.data() + padded_dimensions.x, padded_row, padded_dimensions.x, run.length);
+					MultiplyMax(opacity.data(), window_max.data() + run.begin, weights[run.begin], destination_dimensions.x);
+				}
 
-			opacity = Math::Min(255.f, opacity);
-
-			const int destination_index = y * destination_stride + x * destination_bytes_per_pixel + destination_alpha_offset;
-			destination[destination_index] = byte(opacity);
+				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+				{
+					if (weights[kernel_x] > 0.f && (kernel_x < run.begin || kernel_x >= run.begin + run.length))
+						MultiplyMax(opacity.data(), padded_row + kernel_x, weights[kernel_x], destination_dimensions.x);
+				}
+			}
+			break;
+			}
 		}
+
+		byte* destination_row = destination + y * destination_stride + destination_alpha_offset;
+		for (int x = 0; x < destination_dimensions.x; ++x)
+			destination_row[x * destination_bytes_per_pixel] = byte(Math::Min(255.f, opacity[x]));
 	}
 }
 
@@ -33,16 +33,22 @@
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/FontEngineInterface.h"
+#include "../../Include/RmlUi/Core/FontRunCache.h"
 #include "../../Include/RmlUi/Core/Plugin.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/RenderManager.h"
+#include "../../Include/RmlUi/Core/StyleSharing.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/TextInputHandler.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AncestorFilter.h"
+#include "AtomTable.h"
 #include "ComputeProperty.h"
 #include "ControlledLifetimeResource.h"
 #include "ElementMeta.h"
+#include "ElementStyle.h"
+#include "EventDispatcher.h"
 #include "EventSpecification.h"
 #include "FileInterfaceDefault.h"
 #include "Layout/LayoutPools.h"
@@ -54,6 +60,7 @@
 
 #ifdef RMLUI_FONT_ENGINE_FREETYPE
 	#include "FontEngineDefault/FontEngineInterfaceDefault.h"
+	#include "FontEngineDefault/FontRunCache.h"
 #endif
 
 #ifdef RMLUI_LOTTIE_PLUGIN
@@ -112,6 +119,8 @@ bool Initialise()
 
 	InitializeMemoryPools();
 	InitializeComputeProperty();
+	AtomTable::Initialize();
+	AncestorFilter::Initialize();
 
 	core_data.Initialize();
 
@@ -151,6 +160,7 @@ bool Initialise()
 	}
 
 	EventSpecificationInterface::Initialize();
+	EventDispatcher::Initialize();
 
 	Detail::InitializeObserverPtrPool();
 
@@ -215,8 +225,12 @@ void Shutdown()
 
 	core_data.Shutdown();
 
+	EventDispatcher::Shutdown();
 	EventSpecificationInterface::Shutdown();
 
+	AncestorFilter::Shutdown();
+	AtomTable::Shutdown();
+	ElementStyle::ResetStyleSharingStatistics();
 	ShutdownComputeProperty();
 	ReleaseMemoryPools();
 }
@@ -451,6 +465,20 @@ void ReleaseFontResources()
 		name_context.second->Update();
 }
 
+FontRunCacheStatistics GetFontRunCacheStatistics()
+{
+#ifdef RMLUI_FONT_ENGINE_FREETYPE
+	return FontRunCache::GetStatistics();
+#else
+	return {};
+#endif
+}
+
+StyleSharingStatistics GetStyleSharingStatistics()
+{
+	return ElementStyle::GetStyleSharingStatistics();
+}
+
 void ReleaseRenderManagers()
 {
 	auto& contexts = core_data->contexts;
@@ -89,6 +89,9 @@ enum class Instruction {
 	CastToInt       = 'I',     //       R = (int)R
 	Jump            = 'J',     //       Jumps to instruction index D
 	JumpIfZero      = 'Z',     //       If R is false, jumps to instruction index D
+	// Fused instructions, only emitted by the optimizer.
+	LiteralRight    = 'd',     //       L = R, R = D  (Replaces the sequence 'S+ = R; R = D; L = S-')
+	VariableRight   = 'v',     //       L = R, R = DataModel.GetVariable(D)  (Replaces the sequence 'S+ = R; R = Variable(D); L = S-')
 	// clang-format on
 };
 
@@ -112,6 +115,8 @@ namespace Parse {
 	static void Expression(DataParser& parser);
 } // namespace Parse
 
+static void OptimizeProgram(Program& program);
+
 class DataParser {
 public:
 	DataParser(String expression, DataExpressionInterface expression_interface) :
@@ -201,6 +206,9 @@ public:
 			Error(CreateString("Internal parser error, inconsistent stack operations. Stack size is %d at parse end.", program_stack_size));
 		}
 
+		if (!parse_error)
+			OptimizeProgram(program);
+
 		return !parse_error;
 	}
 
@@ -909,6 +917,298 @@ namespace Parse {
 
 } // namespace Parse
 
+// Returns true if the value is stored as a number, then retrieves it without going through the type converters.
+static bool GetNumber(const Variant& variant, double& out_number)
+{
+	switch (variant.GetType())
+	{
+	case Variant::DOUBLE: out_number = variant.GetReference<double>(); return true;
+	case Variant::FLOAT: out_number = double(variant.GetReference<float>()); return true;
+	case Variant::INT: out_number = double(variant.GetReference<int>()); return true;
+	case Variant::INT64: out_number = double(variant.GetReference<int64_t>()); return true;
+	case Variant::UINT: out_number = double(variant.GetReference<unsigned int>()); return true;
+	case Variant::UINT64: out_number = double(variant.GetReference<uint64_t>()); return true;
+	default: break;
+	}
+	return false;
+}
+
+static bool IsBinaryOperator(Instruction instruction)
+{
+	return instruction == Instruction::Add || instruction == Instruction::Subtract || instruction == Instruction::Multiply ||
+		instruction == Instruction::Divide || instruction == Instruction::And || instruction == Instruction::Or || instruction == Instruction::Less ||
+		instruction == Instruction::LessEq || instruction == Instruction::Greater || instruction == Instruction::GreaterEq ||
+		instruction == Instruction::Equal || instruction == Instruction::NotEqual;
+}
+
+// Evaluates the binary operator as 'R = L <op> R'.
+static void EvaluateBinaryOperator(Instruction instruction, const Variant& L, Variant& R)
+{
+	RMLUI_ASSERT(IsBinaryOperator(instruction));
+
+	// Fast path for numeric operands, avoids the type converters.
+	double l = 0, r = 0;
+	if (instruction != Instruction::And && instruction != Instruction::Or && GetNumber(L, l) && GetNumber(R, r))
+	{
+		if (instruction == Instruction::Add)
+			R = l + r;
+		else if (instruction == Instruction::Subtract)
+			R = l - r;
+		else if (instruction == Instruction::Multiply)
+			R = l * r;
+		else if (instruction == Instruction::Divide)
+			R = l / r;
+		else if (instruction == Instruction::Less)
+			R = (l < r);
+		else if (instruction == Instruction::LessEq)
+			R = (l <= r);
+		else if (instruction == Instruction::Greater)
+			R = (l > r);
+		else if (instruction == Instruction::GreaterEq)
+			R = (l >= r);
+		else if (instruction == Instruction::Equal)
+			R = (l == r);
+		else if (instruction == Instruction::NotEqual)
+			R = (l != r);
+		return;
+	}
+
+	const bool any_string = (L.GetType() == Variant::STRING || R.GetType() == Variant::STRING);
+
+	if (instruction == Instruction::Add)
+	{
+		if (any_string)
+			R = Variant(L.Get<String>() + R.Get<String>());
+		else
+			R = Variant(L.Get<double>() + R.Get<double>());
+	}
+	else if (instruction == Instruction::Equal)
+	{
+		if (any_string)
+			R = Variant(L.Get<String>() == R.Get<String>());
+		else
+			R = Variant(L.Get<double>() == R.Get<double>());
+	}
+	else if (instruction == Instruction::NotEqual)
+	{
+		if (any_string)
+			R = Variant(L.Get<String>() != R.Get<String>());
+		else
+			R = Variant(L.Get<double>() != R.Get<double>());
+	}
+	// clang-format off
+	else if (instruction == Instruction::Subtract)  R = Variant(L.Get<double>() - R.Get<double>());
+	else if (instruction == Instruction::Multiply)  R = Variant(L.Get<double>() * R.Get<double>());
+	else if (instruction == Instruction::Divide)    R = Variant(L.Get<double>() / R.Get<double>());
+	else if (instruction == Instruction::And)       R = Variant(L.Get<bool>() && R.Get<bool>());
+	else if (instruction == Instruction::Or)        R = Variant(L.Get<bool>() || R.Get<bool>());
+	else if (instruction == Instruction::Less)      R = Variant(L.Get<double>() < R.Get<double>());
+	else if (instruction == Instruction::LessEq)    R = Variant(L.Get<double>() <= R.Get<double>());
+	else if (instruction == Instruction::Greater)   R = Variant(L.Get<double>() > R.Get<double>());
+	else if (instruction == Instruction::GreaterEq) R = Variant(L.Get<double>() >= R.Get<double>());
+	// clang-format on
+}
+
+static bool IsJump(Instruction instruction)
+{
+	return instruction == Instruction::Jump || instruction == Instruction::JumpIfZero;
+}
+
+/*
+    Passes over the parsed program that rewrite instruction sequences into cheaper ones, without changing the result of
+    the program. Sequences are only rewritten when no jump targets any of their instructions other than the first one.
+*/
+class DataOptimizer {
+public:
+	DataOptimizer(Program& program) : program(program) {}
+
+	// Evaluates operators with literal operands, resolves jumps on literal conditions, and removes unreachable code.
+	bool FoldConstants()
+	{
+		BeginPass();
+
+		bool unreachable = false;
+		for (size_t i = 0; i < program.size();)
+		{
+			const size_t begin = i;
+			const size_t result_begin = result.size();
+			const InstructionData& instruction = program[i];
+			bool replaced = true;
+
+			if (is_jump_target[i])
+				unreachable = false;
+
+			if (unreachable)
+			{
+				i += 1;
+			}
+			else if (Match(i, {Instruction::Literal, Instruction::Push, Instruction::Literal, Instruction::Pop}) &&
+				Register(program[i + 3].data.Get<int>(-1)) == Register::L && i + 4 < program.size() && !is_jump_target[i + 4] &&
+				IsBinaryOperator(program[i + 4].instruction))
+			{
+				Variant R = program[i + 2].data;
+				EvaluateBinaryOperator(program[i + 4].instruction, instruction.data, R);
+				result.push_back(InstructionData{Instruction::Literal, std::move(R)});
+				i += 5;
+			}
+			else if (Match(i, {Instruction::Literal, Instruction::Not}))
+			{
+				result.push_back(InstructionData{Instruction::Literal, Variant(!instruction.data.Get<bool>())});
+				i += 2;
+			}
+			else if (int value = 0; Match(i, {Instruction::Literal, Instruction::CastToInt}) && instruction.data.GetInto(value))
+			{
+				result.push_back(InstructionData{Instruction::Literal, Variant(value)});
+				i += 2;
+			}
+			else if (Match(i, {Instruction::Literal, Instruction::JumpIfZero}))
+			{
+				if (!instruction.data.Get<bool>())
+					result.push_back(InstructionData{Instruction::Jump, program[i + 1].data});
+				i += 2;
+			}
+			else if (instruction.instruction == Instruction::Jump && instruction.data.Get<size_t>(0) == i + 1)
+			{
+				i += 1;
+			}
+			else
+			{
+				Keep(i);
+				i += 1;
+				replaced = false;
+			}
+
+			if (replaced)
+				Replaced(begin, i, result_begin);
+
+			// Code following an unconditional jump is unreachable, until the next jump target.
+			unreachable = (unreachable || (result.size() > result_begin && result.back().instruction == Instruction::Jump));
+		}
+
+		return EndPass();
+	}
+
+	// Loads literal and variable right-hand operands directly into the registers, instead of going through the stack.
+	bool FuseOperands()
+	{
+		BeginPass();
+
+		for (size_t i = 0; i < program.size();)
+		{
+			const size_t begin = i;
+			const size_t result_begin = result.size();
+			if (Match(i, {Instruction::Push, Instruction::Literal, Instruction::Pop}) && Register(program[i + 2].data.Get<int>(-1)) == Register::L)
+			{
+				result.push_back(InstructionData{Instruction::LiteralRight, program[i + 1].data});
+				i += 3;
+			}
+			else if (Match(i, {Instruction::Push, Instruction::Variable, Instruction::Pop}) &&
+				Register(program[i + 2].data.Get<int>(-1)) == Register::L)
+			{
+				result.push_back(InstructionData{Instruction::VariableRight, program[i + 1].data});
+				i += 3;
+			}
+			else
+			{
+				Keep(i);
+				i += 1;
+				continue;
+			}
+
+			Replaced(begin, i, result_begin);
+		}
+
+		return EndPass();
+	}
+
+private:
+	void BeginPass()
+	{
+		const size_t size = program.size();
+		is_jump_target.assign(size + 1, false);
+		for (const InstructionData& instruction : program)
+		{
+			if (IsJump(instruction.instruction))
+			{
+				const size_t target = instruction.data.Get<size_t>(0);
+				if (target <= size)
+					is_jump_target[target] = true;
+			}
+		}
+
+		result.clear();
+		result.reserve(size);
+		new_index.assign(size + 1, 0);
+		changed = false;
+	}
+
+	bool EndPass()
+	{
+		new_index.back() = result.size();
+		if (!changed)
+			return false;
+
+		for (InstructionData& instruction : result)
+		{
+			if (IsJump(instruction.instruction))
+			{
+				const size_t target = instruction.data.Get<size_t>(0);
+				if (target < new_index.size())
+					instruction.data = Variant(uint64_t(new_index[target]));
+			}
+		}
+
+		program = std::move(result);
+		result = {};
+		return true;
+	}
+
+	// Returns true if the instructions starting at 'index' match the sequence, and only the first one may be a jump target.
+	bool Match(size_t index, std::initializer_list<Instruction> sequence) const
+	{
+		if (index + sequence.size() > program.size())
+			return false;
+
+		size_t k = 0;
+		for (Instruction instruction : sequence)
+		{
+			if (program[index + k].instruction != instruction || (k != 0 && is_jump_target[index + k]))
+				return false;
+			k += 1;
+		}
+		return true;
+	}
+
+	void Keep(size_t index)
+	{
+		new_index[index] = result.size();
+		result.push_back(program[index]);
+	}
+
+	// The instructions in the range [begin, end) were replaced by the result instructions starting at 'result_begin'.
+	void Replaced(size_t begin, size_t end, size_t result_begin)
+	{
+		changed = true;
+		for (size_t i = begin; i < end; i++)
+			new_index[i] = result_begin;
+	}
+
+	Program& program;
+	Program result;
+	Vector<bool> is_jump_target;
+	Vector<size_t> new_index;
+	bool changed = false;
+};
+
+static void OptimizeProgram(Program& program)
+{
+	DataOptimizer optimizer(program);
+	while (optimizer.FoldConstants())
+	{
+	}
+	optimizer.FuseOperands();
+}
+
 static String DumpProgram(const Program& program)
 {
 	String str;
@@ -974,8 +1274,6 @@ private:
 
 	bool Execute(const Instruction instruction, const Variant& data, size_t& next_instruction)
 	{
-		auto AnyString = [](const Variant& v1, const Variant& v2) { return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING; };
-
 		switch (instruction)
 		{
 		case Instruction::Push:
@@ -1023,40 +1321,40 @@ private:
 				return Error("Variable address not found.");
 		}
 		break;
-		case Instruction::Add:
+		case Instruction::LiteralRight:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() + R.Get<String>());
-			else
-				R = Variant(L.Get<double>() + R.Get<double>());
+			L = std::move(R);
+			R = data;
 		}
 		break;
-			// clang-format off
-		case Instruction::Subtract:  R = Variant(L.Get<double>() - R.Get<double>());  break;
-		case Instruction::Multiply:  R = Variant(L.Get<double>() * R.Get<double>());  break;
-		case Instruction::Divide:    R = Variant(L.Get<double>() / R.Get<double>());  break;
-		case Instruction::Not:       R = Variant(!R.Get<bool>());                     break;
-		case Instruction::And:       R = Variant(L.Get<bool>() && R.Get<bool>());     break;
-		case Instruction::Or:        R = Variant(L.Get<bool>() || R.Get<bool>());     break;
-		case Instruction::Less:      R = Variant(L.Get<double>() < R.Get<double>());  break;
-		case Instruction::LessEq:    R = Variant(L.Get<double>() <= R.Get<double>()); break;
-		case Instruction::Greater:   R = Variant(L.Get<double>() > R.Get<double>());  break;
-		case Instruction::GreaterEq: R = Variant(L.Get<double>() >= R.Get<double>()); break;
-			// clang-format on
-		case Instruction::Equal:
+		case Instruction::VariableRight:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() == R.Get<String>());
-			else
-				R = Variant(L.Get<double>() == R.Get<double>());
+			size_t variable_index = size_t(data.Get<int>(-1));
+			if (variable_index >= addresses.size())
+				return Error("Variable address not found.");
+			L = std::move(R);
+			R = expression_interface.GetValue(addresses[variable_index]);
 		}
 		break;
+		case Instruction::Add:
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide:
+		case Instruction::And:
+		case Instruction::Or:
+		case Instruction::Less:
+		case Instruction::LessEq:
+		case Instruction::Greater:
+		case Instruction::GreaterEq:
+		case Instruction::Equal:
 		case Instruction::NotEqual:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() != R.Get<String>());
-			else
-				R = Variant(L.Get<double>() != R.Get<double>());
+			EvaluateBinaryOperator(instruction, L, R);
+		}
+		break;
+		case Instruction::Not:
+		{
+			R = Variant(!R.Get<bool>());
 		}
 		break;
 		case Instruction::NumArguments:
@@ -1170,16 +1468,9 @@ bool DataExpression::Run(const DataExpressionInterface& expression_interface, Va
 	return true;
 }
 
-StringList DataExpression::GetVariableNameList() const
+const AddressList& DataExpression::GetVariableAddressList() const
 {
-	StringList list;
-	list.reserve(addresses.size());
-	for (const DataAddress& address : addresses)
-	{
-		if (!address.empty())
-			list.push_back(address[0].name);
-	}
-	return list;
+	return addresses;
 }
 
 DataExpressionInterface::DataExpressionInterface(DataModel* data_model, Element* element, Event* event) :
@@ -68,7 +68,7 @@ public:
 	bool Run(const DataExpressionInterface& expression_interface, Variant& out_value);
 
 	// Available after Parse()
-	StringList GetVariableNameList() const;
+	const AddressList& GetVariableAddressList() const;
 
 private:
 	String expression;
@@ -31,6 +31,7 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "DataController.h"
 #include "DataView.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -353,10 +354,24 @@ void DataModel::DirtyVariable(const String& variable_name)
 	dirty_variables.emplace(variable_name);
 }
 
+void DataModel::DirtyAddress(const DataAddress& address)
+{
+	RMLUI_ASSERTMSG(!address.empty() && variables.count(address.front().name) == 1,
+		"In DirtyAddress: Variable name not found among added variables.");
+	if (address.size() == 1)
+		dirty_variables.emplace(address.front().name);
+	else if (!address.empty())
+		dirty_addresses.push_back(address);
+}
+
 bool DataModel::IsVariableDirty(const String& variable_name) const
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
-	return dirty_variables.count(variable_name) == 1;
+	if (dirty_variables.count(variable_name) == 1)
+		return true;
+
+	return std::any_of(dirty_addresses.begin(), dirty_addresses.end(),
+		[&](const DataAddress& address) { return address.front().name == variable_name; });
 }
 
 void DataModel::DirtyAllVariables()
@@ -395,10 +410,13 @@ void DataModel::OnElementRemove(Element* element)
 
 bool DataModel::Update(bool clear_dirty_variables)
 {
-	const bool result = views->Update(*this, dirty_variables);
+	const bool result = views->Update(*this, dirty_variables, dirty_addresses);
 
 	if (clear_dirty_variables)
+	{
 		dirty_variables.clear();
+		dirty_addresses.clear();
+	}
 
 	return result;
 }
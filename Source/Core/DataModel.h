@@ -67,6 +67,7 @@ public:
 	bool GetVariableInto(const DataAddress& address, Variant& out_value) const;
 
 	void DirtyVariable(const String& variable_name);
+	void DirtyAddress(const DataAddress& address);
 	bool IsVariableDirty(const String& variable_name) const;
 	void DirtyAllVariables();
 
@@ -88,6 +89,7 @@ private:
 
 	UnorderedMap<String, DataVariable> variables;
 	DirtyVariables dirty_variables;
+	Vector<DataAddress> dirty_addresses;
 
 	UnorderedMap<String, UniquePtr<FuncDefinition>> function_variable_definitions;
 	UnorderedMap<String, DataEventFunc> event_callbacks;
@@ -43,6 +43,18 @@ void DataModelHandle::DirtyVariable(const String& variable_name)
 	model->DirtyVariable(variable_name);
 }
 
+void DataModelHandle::DirtyAddress(const String& address_str)
+{
+	DataAddress address = model->ResolveAddress(address_str, nullptr);
+	if (!address.empty())
+		model->DirtyAddress(address);
+}
+
+void DataModelHandle::DirtyAddress(const DataAddress& address)
+{
+	model->DirtyAddress(address);
+}
+
 void DataModelHandle::DirtyAllVariables()
 {
 	model->DirtyAllVariables();
@@ -87,17 +87,90 @@ void DataViews::OnElementRemove(Element* element)
 	}
 }
 
-bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
+// Calls the function with the key of each parent of the given address, followed by the key of the address itself.
+template <typename Func>
+static void ForEachAddressKey(const DataAddress& address, Func&& func)
+{
+	String key;
+	for (size_t i = 0; i < address.size(); i++)
+	{
+		const DataAddressEntry& entry = address[i];
+		if (entry.index >= 0)
+		{
+			key += '[';
+			key += ToString(entry.index);
+			key += ']';
+		}
+		else
+		{
+			if (i > 0)
+				key += '.';
+			key += entry.name;
+		}
+
+		func(key, i + 1 == address.size());
+	}
+}
+
+static void FindViews(const UnorderedMultimap<String, DataView*>& map, const String& key, Vector<DataView*>& out_views)
+{
+	auto pair = map.equal_range(key);
+	for (auto it = pair.first; it != pair.second; ++it)
+		out_views.push_back(it->second);
+}
+
+static void EraseView(UnorderedMultimap<String, DataView*>& map, const String& key, DataView* view)
+{
+	auto pair = map.equal_range(key);
+	for (auto it = pair.first; it != pair.second;)
+	{
+		if (it->second == view)
+			it = map.erase(it);
+		else
+			++it;
+	}
+}
+
+void DataViews::AddToAddressMaps(DataView* view)
+{
+	for (const DataAddress& address : view->GetVariableAddressList())
+	{
+		ForEachAddressKey(address, [&](const String& key, bool is_full_address) {
+			if (is_full_address)
+				address_view_map.emplace(key, view);
+			subtree_view_map.emplace(key, view);
+		});
+	}
+}
+
+void DataViews::RemoveFromAddressMaps(DataView* view)
+{
+	for (const DataAddress& address : view->GetVariableAddressList())
+	{
+		ForEachAddressKey(address, [&](const String& key, bool is_full_address) {
+			if (is_full_address)
+				EraseView(address_view_map, key, view);
+			EraseView(subtree_view_map, key, view);
+		});
+	}
+}
+
+bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables, const Vector<DataAddress>& dirty_addresses)
 {
 	bool result = false;
 	size_t num_dirty_variables_prev = 0;
+	size_t num_dirty_addresses_prev = 0;
+	auto NewDirtyVariables = [&]() {
+		return num_dirty_variables_prev != dirty_variables.size() || num_dirty_addresses_prev != dirty_addresses.size();
+	};
 
 	// View updates may result in newly added views, or even new dirty variables. Thus, we do the
 	// update recursively but with an upper limit. Without the loop, newly added views won't be
 	// updated until the next Update() call.
-	for (int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size()) && i < 10; i++)
+	for (int i = 0; (i == 0 || !views_to_add.empty() || NewDirtyVariables()) && i < 10; i++)
 	{
 		num_dirty_variables_prev = dirty_variables.size();
+		num_dirty_addresses_prev = dirty_addresses.size();
 
 		Vector<DataView*> dirty_views;
 
@@ -107,19 +180,24 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 			for (auto&& view : views_to_add)
 			{
 				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
+				AddToAddressMaps(view.get());
 
 				views.push_back(std::move(view));
 			}
 			views_to_add.clear();
 		}
 
+		// A dirty variable affects all views reading from it or any of its children.
 		for (const String& variable_name : dirty_variables)
+			FindViews(subtree_view_map, variable_name, dirty_views);
+
+		// A dirty address affects the views reading from the address itself or any of its children, and the views
+		// reading from any of its parents.
+		for (const DataAddress& address : dirty_addresses)
 		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
+			ForEachAddressKey(address, [&](const String& key, bool is_full_address) {
+				FindViews(is_full_address ? subtree_view_map : address_view_map, key, dirty_views);
+			});
 		}
 
 		// Remove duplicate entries
@@ -142,19 +220,10 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 		}
 
 		// Destroy views marked for destruction
-		// @performance: Horrible...
 		if (!views_to_remove.empty())
 		{
 			for (const auto& view : views_to_remove)
-			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end();)
-				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
-					else
-						++it;
-				}
-			}
+				RemoveFromAddressMaps(view.get());
 
 			views_to_remove.clear();
 		}
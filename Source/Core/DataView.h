@@ -79,8 +79,9 @@ public:
 	// Returns true if the update resulted in a document change.
 	virtual bool Update(DataModel& model) = 0;
 
-	// Returns the list of data variable name(s) which can modify this view.
-	virtual StringList GetVariableNameList() const = 0;
+	// Returns the list of data variable addresses read by this view. The view is modified by changes to any of these
+	// addresses, including changes to their parent or child addresses.
+	virtual Vector<DataAddress> GetVariableAddressList() const = 0;
 
 	// Returns the attached element if it still exists.
 	Element* GetElement() const;
@@ -112,9 +113,12 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
+	bool Update(DataModel& model, const DirtyVariables& dirty_variables, const Vector<DataAddress>& dirty_addresses);
 
 private:
+	void AddToAddressMaps(DataView* view);
+	void RemoveFromAddressMaps(DataView* view);
+
 	using DataViewList = Vector<DataViewPtr>;
 
 	DataViewList views;
@@ -122,8 +126,11 @@ private:
 	DataViewList views_to_add;
 	DataViewList views_to_remove;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
-	NameViewMap name_view_map;
+	using AddressViewMap = UnorderedMultimap<String, DataView*>;
+	// Views keyed by each address they read.
+	AddressViewMap address_view_map;
+	// Views keyed by each address they read, and by all the parents of those addresses.
+	AddressViewMap subtree_view_map;
 };
 
 } // namespace Rml
@@ -27,11 +27,16 @@
  */
 
 #include "DataViewDefault.h"
+#include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/ElementInstancer.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataExpression.h"
@@ -46,6 +51,11 @@ static constexpr int SortOffset_DataValue = 100;
 //  'data-checked' may need a value attribute already set.
 static constexpr int SortOffset_DataChecked = 110;
 
+// Number of rows instantiated on each side of the viewport in virtualized 'data-for' views.
+static constexpr int VirtualFor_OverscanRows = 4;
+// Number of rows instantiated in virtualized 'data-for' views until the layout of the rows is known.
+static constexpr int VirtualFor_InitialRows = 32;
+
 DataViewCommon::DataViewCommon(Element* element, String override_modifier, int sort_offset) :
 	DataView(element, sort_offset), modifier(std::move(override_modifier))
 {}
@@ -63,10 +73,10 @@ bool DataViewCommon::Initialize(DataModel& model, Element* element, const String
 	return result;
 }
 
-StringList DataViewCommon::GetVariableNameList() const
+Vector<DataAddress> DataViewCommon::GetVariableAddressList() const
 {
 	RMLUI_ASSERT(expression);
-	return expression->GetVariableNameList();
+	return expression->GetVariableAddressList();
 }
 
 const String& DataViewCommon::GetModifier() const
@@ -430,17 +440,17 @@ bool DataViewText::Update(DataModel& model)
 	return entries_modified;
 }
 
-StringList DataViewText::GetVariableNameList() const
+Vector<DataAddress> DataViewText::GetVariableAddressList() const
 {
-	StringList full_list;
+	Vector<DataAddress> full_list;
 	full_list.reserve(data_entries.size());
 
 	for (const DataEntry& entry : data_entries)
 	{
 		RMLUI_ASSERT(entry.data_expression);
 
-		StringList entry_list = entry.data_expression->GetVariableNameList();
-		full_list.insert(full_list.end(), MakeMoveIterator(entry_list.begin()), MakeMoveIterator(entry_list.end()));
+		const AddressList& entry_list = entry.data_expression->GetVariableAddressList();
+		full_list.insert(full_list.end(), entry_list.begin(), entry_list.end());
 	}
 
 	return full_list;
@@ -475,8 +485,83 @@ String DataViewText::BuildText() const
 	return result;
 }
 
+// Placeholder for the rows outside the visible range of virtualized 'data-for' views.
+class DataViewForSpacer final : public Element {
+public:
+	DataViewForSpacer(const String& tag) : Element(tag) {}
+
+	void SetView(DataViewFor* in_view) { view = in_view; }
+
+protected:
+	void OnLayout() override
+	{
+		// The final position of the rows, including any scroll offset, is only known after layout. Thus, notify the view
+		// during the next update.
+		if (view)
+		{
+			is_formatted = true;
+			SetNeedsUpdate(true);
+		}
+	}
+
+	void OnUpdate() override
+	{
+		if (!is_formatted)
+			return;
+
+		is_formatted = false;
+		SetNeedsUpdate(false);
+		if (view)
+			view->OnSpacerLayout();
+	}
+
+private:
+	DataViewFor* view = nullptr;
+	bool is_formatted = false;
+};
+
+static ElementInstancerGeneric<DataViewForSpacer> data_view_for_spacer_instancer;
+
+static Element* CreateVirtualForSpacer(Element* data_for_element, Element* insert_before)
+{
+	// Use an internal tag so that selectors targeting the rows do not match the spacers, which are also ignored by structural selectors.
+	ElementPtr spacer = data_view_for_spacer_instancer.InstanceElement(nullptr, "#data-for-spacer", XMLAttributes());
+	spacer->SetInstancer(&data_view_for_spacer_instancer);
+
+	// Only the height of the spacer should contribute to the layout.
+	spacer->SetProperty(PropertyId::Display, Property(Style::Display::Block));
+	for (PropertyId id : {PropertyId::Height, PropertyId::MinHeight, PropertyId::MarginTop, PropertyId::MarginBottom, PropertyId::PaddingTop,
+			 PropertyId::PaddingBottom, PropertyId::BorderTopWidth, PropertyId::BorderBottomWidth})
+		spacer->SetProperty(id, Property(0.f, Unit::PX));
+
+	return data_for_element->GetParentNode()->InsertBefore(std::move(spacer), insert_before);
+}
+
+static void SetVirtualForSpacerHeight(Element* spacer, float height)
+{
+	const Property* property = spacer->GetLocalProperty(PropertyId::Height);
+	if (!property || property->Get<float>() != height)
+		spacer->SetProperty(PropertyId::Height, Property(height, Unit::PX));
+}
+
 DataViewFor::DataViewFor(Element* element) : DataView(element, 0) {}
 
+DataViewFor::~DataViewFor()
+{
+	if (Element* target = scroll_listener_target.get())
+		target->RemoveEventListener(EventId::Scroll, this);
+
+	// Remove the spacers, they are owned by this view and would otherwise be left behind in the parent element.
+	for (Element* spacer : {top_spacer.get(), bottom_spacer.get()})
+	{
+		if (!spacer)
+			continue;
+		rmlui_static_cast<DataViewForSpacer*>(spacer)->SetView(nullptr);
+		if (Element* parent = spacer->GetParentNode())
+			parent->RemoveChild(spacer);
+	}
+}
+
 bool DataViewFor::Initialize(DataModel& model, Element* element, const String& in_expression, const String& in_rml_content)
 {
 	rml_contents = in_rml_content;
@@ -526,17 +611,17 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 
 	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
 
-	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
-	attributes = element->GetAttributes();
-	for (auto it = attributes.begin(); it != attributes.end(); ++it)
+	if (const Variant* virtual_attribute = element->GetAttribute("virtual"))
 	{
-		if (it->first == "data-for")
-		{
-			attributes.erase(it);
-			break;
-		}
+		is_virtual = true;
+		fixed_row_height = Math::Max(virtual_attribute->Get<float>(0.f), 0.f);
 	}
 
+	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
+	attributes = element->GetAttributes();
+	attributes.erase("data-for");
+	attributes.erase("virtual");
+
 	return true;
 }
 
@@ -546,52 +631,242 @@ bool DataViewFor::Update(DataModel& model)
 	if (!variable)
 		return false;
 
-	bool result = false;
 	const int size = variable.Size();
+	if (is_virtual)
+		return UpdateVirtual(model, size);
+
 	const int num_elements = (int)elements.size();
 	Element* element = GetElement();
 
-	for (int i = 0; i < Math::Max(size, num_elements); i++)
+	for (int i = num_elements; i < size; i++)
+		elements.push_back(CreateRow(model, i, element));
+
+	for (int i = size; i < num_elements; i++)
+		RemoveRow(model, elements[i]);
+
+	if (num_elements > size)
+		elements.resize(size);
+
+	return false;
+}
+
+Element* DataViewFor::CreateRow(DataModel& model, int index, Element* insert_before)
+{
+	Element* element = GetElement();
+	ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+
+	DataAddress iterator_address;
+	iterator_address.reserve(container_address.size() + 1);
+	iterator_address = container_address;
+	iterator_address.push_back(DataAddressEntry(index));
+
+	DataAddress iterator_index_address = {{"literal"}, {"int"}, {index}};
+
+	model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
+	model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
+
+	Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), insert_before);
+	new_element->SetInnerRML(rml_contents);
+
+	return new_element;
+}
+
+void DataViewFor::RemoveRow(DataModel& model, Element* row)
+{
+	model.EraseAliases(row);
+	row->GetParentNode()->RemoveChild(row).reset();
+}
+
+bool DataViewFor::UpdateVirtual(DataModel& model, const int size)
+{
+	Element* element = GetElement();
+	if (!element || !element->GetParentNode())
+		return false;
+
+	if (!top_spacer || !bottom_spacer)
+	{
+		// The rows are placed between the spacers, which take up the space of all the rows outside the visible range.
+		if (!top_spacer)
+			top_spacer = CreateVirtualForSpacer(element, elements.empty() ? element : elements.front())->GetObserverPtr();
+		if (!bottom_spacer)
+			bottom_spacer = CreateVirtualForSpacer(element, element)->GetObserverPtr();
+
+		rmlui_static_cast<DataViewForSpacer*>(bottom_spacer.get())->SetView(this);
+		is_layout_valid = false;
+	}
+
+	if (!scroll_listener_target)
 	{
-		if (i >= num_elements)
+		if (ElementDocument* document = element->GetOwnerDocument())
 		{
-			ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+			document->AddEventListener(EventId::Scroll, this);
+			scroll_listener_target = document->GetObserverPtr();
+		}
+	}
 
-			DataAddress iterator_address;
-			iterator_address.reserve(container_address.size() + 1);
-			iterator_address = container_address;
-			iterator_address.push_back(DataAddressEntry(i));
+	int begin = 0, end = 0;
+	if (!GetVisibleRange(size, begin, end, row_height))
+	{
+		// Without a valid layout, keep the current rows and fill up to an initial set of rows. The visible range is
+		// determined once the rows have been formatted.
+		begin = Math::Min(first_index, size);
+		end = Math::Min(begin + Math::Max((int)elements.size(), VirtualFor_InitialRows), size);
+	}
 
-			DataAddress iterator_index_address = {{"literal"}, {"int"}, {i}};
+	const int num_rows = (int)elements.size();
+	const int current_end = first_index + num_rows;
+	bool rows_changed = false;
 
-			model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
-			model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
+	// Remove rows which are no longer within the visible range.
+	if (begin >= current_end || end <= first_index)
+	{
+		for (Element* row : elements)
+			RemoveRow(model, row);
+		elements.clear();
+		first_index = begin;
+		rows_changed = (num_rows > 0);
+	}
+	else
+	{
+		const int num_remove_back = Math::Max(current_end - end, 0);
+		for (int i = num_rows - num_remove_back; i < num_rows; i++)
+			RemoveRow(model, elements[i]);
+		elements.resize(num_rows - num_remove_back);
+
+		const int num_remove_front = Math::Max(begin - first_index, 0);
+		for (int i = 0; i < num_remove_front; i++)
+			RemoveRow(model, elements[i]);
+		elements.erase(elements.begin(), elements.begin() + num_remove_front);
+		first_index += num_remove_front;
+
+		rows_changed = (num_remove_back > 0 || num_remove_front > 0);
+	}
 
-			Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
-			elements.push_back(new_element);
+	// Add rows which have entered the visible range, in front of and behind the current rows.
+	if (begin < first_index)
+	{
+		Element* insert_before = (elements.empty() ? bottom_spacer.get() : elements.front());
+		ElementList new_rows;
+		new_rows.reserve(first_index - begin);
+		for (int i = begin; i < first_index; i++)
+			new_rows.push_back(CreateRow(model, i, insert_before));
+
+		elements.insert(elements.begin(), new_rows.begin(), new_rows.end());
+		first_index = begin;
+		rows_changed = true;
+	}
 
-			elements[i]->SetInnerRML(rml_contents);
+	for (int i = first_index + (int)elements.size(); i < end; i++)
+	{
+		elements.push_back(CreateRow(model, i, bottom_spacer.get()));
+		rows_changed = true;
+	}
 
-			RMLUI_ASSERT(i < (int)elements.size());
-		}
-		if (i >= size)
+	if (rows_changed)
+		is_layout_valid = false;
+
+	SetVirtualForSpacerHeight(top_spacer.get(), float(first_index) * row_height);
+	SetVirtualForSpacerHeight(bottom_spacer.get(), float(size - first_index - (int)elements.size()) * row_height);
+
+	return rows_changed;
+}
+
+bool DataViewFor::GetVisibleRange(const int size, int& out_begin, int& out_end, float& out_row_height)
+{
+	Element* top = top_spacer.get();
+	Element* bottom = bottom_spacer.get();
+	if (!is_layout_valid || !top || !bottom)
+		return false;
+
+	float height = fixed_row_height;
+	if (height <= 0.f)
+	{
+		// Estimate the row height from the currently instantiated rows, which are located between the spacers.
+		if (elements.empty())
+			height = row_height;
+		else
 		{
-			model.EraseAliases(elements[i]);
-			elements[i]->GetParentNode()->RemoveChild(elements[i]).reset();
-			elements[i] = nullptr;
+			const float rows_top = top->GetAbsoluteTop() + top->GetBox().GetSize(BoxArea::Border).y;
+			height = (bottom->GetAbsoluteTop() - rows_top) / float(elements.size());
 		}
 	}
+	if (height <= 0.f)
+		return false;
 
-	if (num_elements > size)
-		elements.resize(size);
+	// The viewport is given by the closest clipping ancestor, or otherwise the context.
+	float viewport_top = 0.f;
+	float viewport_bottom = 0.f;
 
-	return result;
+	Element* clipping_element = top->GetParentNode();
+	while (clipping_element && clipping_element->GetComputedValues().overflow_y() == Style::Overflow::Visible)
+		clipping_element = clipping_element->GetParentNode();
+
+	if (clipping_element)
+	{
+		viewport_top = clipping_element->GetAbsoluteTop() + clipping_element->GetClientTop();
+		viewport_bottom = viewport_top + clipping_element->GetClientHeight();
+	}
+	else if (Context* context = top->GetContext())
+	{
+		viewport_bottom = float(context->GetDimensions().y);
+	}
+
+	const float list_top = top->GetAbsoluteTop();
+	const int begin = Math::RoundDownToInteger((viewport_top - list_top) / height) - VirtualFor_OverscanRows;
+	const int end = Math::RoundUpToInteger((viewport_bottom - list_top) / height) + VirtualFor_OverscanRows;
+
+	// Always start at an even row, so that structural selectors like ':nth-child(odd)' match the same rows while scrolling.
+	out_begin = Math::Clamp(begin, 0, size);
+	out_begin -= out_begin % 2;
+	out_end = Math::Clamp(end, out_begin, size);
+	out_row_height = height;
+
+	return true;
+}
+
+void DataViewFor::OnSpacerLayout()
+{
+	is_layout_valid = true;
+
+	// Dirty the container so that the rows are updated during the next data model update.
+	DirtyIfVisibleRangeChanged();
+}
+
+void DataViewFor::ProcessEvent(Event& /*event*/)
+{
+	DirtyIfVisibleRangeChanged();
+}
+
+void DataViewFor::DirtyIfVisibleRangeChanged()
+{
+	if (!IsValid())
+		return;
+
+	DataModel* model = GetElement()->GetDataModel();
+	if (!model)
+		return;
+
+	DataVariable variable = model->GetVariable(container_address);
+	if (!variable)
+		return;
+
+	// The spacer heights also need to be updated when the row height has changed, even if the range stays the same.
+	int begin = 0, end = 0;
+	float height = 0.f;
+	if (GetVisibleRange(variable.Size(), begin, end, height) &&
+		(begin != first_index || end != first_index + (int)elements.size() || height != row_height))
+		model->DirtyAddress(container_address);
+}
+
+void DataViewFor::OnDetach(Element* /*element*/)
+{
+	scroll_listener_target.reset();
 }
 
-StringList DataViewFor::GetVariableNameList() const
+Vector<DataAddress> DataViewFor::GetVariableAddressList() const
 {
 	RMLUI_ASSERT(!container_address.empty());
-	return StringList{container_address.front().name};
+	return Vector<DataAddress>{container_address};
 }
 
 void DataViewFor::Release()
@@ -601,9 +876,13 @@ void DataViewFor::Release()
 
 DataViewAlias::DataViewAlias(Element* element) : DataView(element, 0) {}
 
-StringList DataViewAlias::GetVariableNameList() const
+Vector<DataAddress> DataViewAlias::GetVariableAddressList() const
 {
-	return variables;
+	Vector<DataAddress> list;
+	list.reserve(variables.size());
+	for (const String& variable : variables)
+		list.push_back(DataAddress{DataAddressEntry(variable)});
+	return list;
 }
 
 bool DataViewAlias::Update(DataModel&)
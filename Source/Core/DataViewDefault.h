@@ -29,6 +29,7 @@
 #ifndef RMLUI_CORE_DATAVIEWDEFAULT_H
 #define RMLUI_CORE_DATAVIEWDEFAULT_H
 
+#include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Variant.h"
@@ -46,7 +47,7 @@ public:
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
 
 protected:
 	const String& GetModifier() const;
@@ -139,7 +140,7 @@ public:
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
 	bool Update(DataModel& model) override;
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
 
 protected:
 	void Release() override;
@@ -157,20 +158,52 @@ private:
 	Vector<DataEntry> data_entries;
 };
 
-class DataViewFor final : public DataView {
+/**
+    The 'data-for' view instantiates one element for each entry in a data container.
+
+    Adding the 'virtual' attribute enables a virtualized mode, intended for long lists inside a scroll container. Then,
+    only the rows intersecting the viewport of the closest clipping ancestor are instantiated, and spacer elements
+    take the place of the remaining rows. The attribute value can specify a fixed row height in pixels, otherwise the
+    row height is estimated from the instantiated rows.
+
+        <div data-for="item : items" virtual="30">{{ item.name }}</div>
+
+    The spacers are block-level elements with an internal tag, they are not matched by any selectors and are ignored by
+    structural selectors. The rows should thus be block-level boxes stacked vertically, tables are not supported. Since
+    only the instantiated rows are counted, ':nth-child(odd)' and ':nth-child(even)' match the same rows as without
+    virtualization, other structural selectors like ':nth-child(3n)' and ':last-child' may match different rows while
+    scrolling.
+ */
+class DataViewFor final : public DataView, public EventListener {
 public:
 	DataViewFor(Element* element);
+	~DataViewFor();
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& inner_rml) override;
 
 	bool Update(DataModel& model) override;
 
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
+
+	// Called by the spacer elements of virtualized views during the update following their layout.
+	void OnSpacerLayout();
+
+	void ProcessEvent(Event& event) override;
+	void OnDetach(Element* element) override;
 
 protected:
 	void Release() override;
 
 private:
+	Element* CreateRow(DataModel& model, int index, Element* insert_before);
+	void RemoveRow(DataModel& model, Element* row);
+
+	bool UpdateVirtual(DataModel& model, int size);
+	// Finds the range of rows intersecting the viewport, returns false if the current layout is not yet known.
+	bool GetVisibleRange(int size, int& out_begin, int& out_end, float& out_row_height);
+	// Dirties the container if the instantiated rows or spacers no longer match the visible range.
+	void DirtyIfVisibleRangeChanged();
+
 	DataAddress container_address;
 	String iterator_name;
 	String iterator_index_name;
@@ -178,12 +211,22 @@ private:
 	ElementAttributes attributes;
 
 	ElementList elements;
+
+	// Virtualized mode, the instantiated elements start at 'first_index' in the container.
+	bool is_virtual = false;
+	bool is_layout_valid = false;
+	float fixed_row_height = 0;
+	float row_height = 0;
+	int first_index = 0;
+	ObserverPtr<Element> top_spacer;
+	ObserverPtr<Element> bottom_spacer;
+	ObserverPtr<Element> scroll_listener_target;
 };
 
 class DataViewAlias final : public DataView {
 public:
 	DataViewAlias(Element* element);
-	virtual StringList GetVariableNameList() const override;
+	virtual Vector<DataAddress> GetVariableAddressList() const override;
 	bool Update(DataModel& model) override;
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
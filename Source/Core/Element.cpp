@@ -40,9 +40,11 @@
 #include "../../Include/RmlUi/Core/PropertiesIteratorView.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
+#include "../../Include/RmlUi/Core/RenderManager.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "AncestorFilter.h"
 #include "Clock.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
@@ -54,6 +56,7 @@
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
+#include "HitTestIndex.h"
 #include "Layout/LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "Pool.h"
@@ -92,10 +95,51 @@ static float GetScrollOffsetDelta(ScrollAlignment alignment, float begin_offset,
 	return 0.f;
 }
 
+// Returns which elements may need their definition updated when the given selector feature changes on the element.
+static int GetInvalidationFlags(const Element* element, StyleSheetIndex::SelectorFeature feature, const String& name)
+{
+	if (const StyleSheet* style_sheet = element->GetStyleSheet())
+		return style_sheet->GetInvalidationFlags(element, feature, name);
+	return 0;
+}
+
+// Invalidates any render commands recorded by the element's context, called whenever the element's rendered output may change.
+static void DirtyRenderCache(Element* element)
+{
+	if (Context* context = element->GetContext())
+		context->DirtyRenderCache();
+}
+
+// Conservatively tests whether anything the element renders by itself may be visible, by testing its bounding box against
+// the current scissor region, or the viewport when scissoring is disabled.
+static bool IsInScissorRegion(Element* element)
+{
+	RenderManager* render_manager = element->GetRenderManager();
+	if (!render_manager)
+		return true;
+
+	// Inline elements split across multiple lines have additional boxes, don't bother testing those.
+	if (element->GetNumBoxes() > 1)
+		return true;
+
+	Rectanglef bounding_box;
+	if (!ElementUtilities::GetBoundingBox(bounding_box, element, BoxArea::Auto))
+		return true;
+	Math::ExpandToPixelGrid(bounding_box);
+
+	Rectanglei scissor_region = render_manager->GetScissorRegion();
+	if (!scissor_region.Valid())
+		scissor_region = Rectanglei::FromSize(render_manager->GetViewport());
+
+	return scissor_region.Intersects(Rectanglei(bounding_box));
+}
+
 Element::Element(const String& tag) :
-	local_stacking_context(false), local_stacking_context_forced(false), stacking_context_dirty(false), computed_values_are_default_initialized(true),
-	visible(true), offset_fixed(false), absolute_offset_dirty(true), rounded_main_padding_size_dirty(true), dirty_definition(false),
-	dirty_child_definitions(false), dirty_animation(false), dirty_transition(false), dirty_transform(false), dirty_perspective(false), tag(tag),
+	local_stacking_context(false), local_stacking_context_forced(false), stacking_context_dirty(false), hit_test_index_dirty(true),
+	computed_values_are_default_initialized(true), visible(true), offset_fixed(false), absolute_offset_dirty(true),
+	rounded_main_padding_size_dirty(true), dirty_definition(false), dirty_child_definitions(false),
+	dirty_own_definition(false), dirty_animation(false), dirty_transition(false), dirty_transform(false), dirty_perspective(false), dirty_update(true),
+	needs_update(false), needs_update_explicit(false), dirty_layout(false), dirty_child_layout(false), cull_decoration(true), cull_on_render(false), tag(tag),
 	relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
@@ -140,6 +184,11 @@ Element::~Element()
 }
 
 void Element::Update(float dp_ratio, Vector2f vp_dimensions)
+{
+	Update(dp_ratio, vp_dimensions, -1);
+}
+
+void Element::Update(float dp_ratio, Vector2f vp_dimensions, int child_index)
 {
 #ifdef RMLUI_TRACY_PROFILING
 	auto name = GetAddress(false, false);
@@ -147,6 +196,9 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 	RMLUI_ZoneText(name.c_str(), name.size());
 #endif
 
+	// Clear the flag before doing any work, so that any changes made during this update are visited during the next one.
+	dirty_update = false;
+
 	OnUpdate();
 
 	HandleTransitionProperty();
@@ -155,7 +207,7 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 
 	meta->scroll.Update();
 
-	UpdateProperties(dp_ratio, vp_dimensions);
+	UpdateProperties(dp_ratio, vp_dimensions, child_index);
 
 	// Do en extra pass over the animations and properties if the 'animation' property was just changed.
 	if (dirty_animation)
@@ -167,17 +219,41 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 
 	meta->effects.InstanceEffects();
 
+	// Make our names available to the style definition lookup of our descendants.
+	bool ancestor_filter_pushed = false;
+
 	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio, vp_dimensions);
+	{
+		if (children[i]->dirty_update)
+		{
+			if (!ancestor_filter_pushed)
+			{
+				AncestorFilter::PushParent(this);
+				ancestor_filter_pushed = true;
+			}
+			children[i]->Update(dp_ratio, vp_dimensions, (int)i);
+		}
+	}
+
+	if (ancestor_filter_pushed)
+		AncestorFilter::PopParent(this);
 
 	if (!animations.empty() && IsVisible(true))
 	{
 		if (Context* ctx = GetContext())
 			ctx->RequestNextUpdate(0);
 	}
+
+	if (needs_update || !animations.empty())
+		DirtyUpdate();
 }
 
 void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimensions)
+{
+	UpdateProperties(dp_ratio, vp_dimensions, -1);
+}
+
+void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimensions, const int child_index)
 {
 	UpdateDefinition();
 
@@ -185,9 +261,10 @@ void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimension
 	{
 		const ComputedValues* parent_values = parent ? &parent->GetComputedValues() : nullptr;
 		const ComputedValues* document_values = owner_document ? &owner_document->GetComputedValues() : nullptr;
+		const ComputedValues* shared_values = FindSharedComputedValues(child_index);
 
 		// Compute values and clear dirty properties
-		PropertyIdSet dirty_properties = meta->style.ComputeValues(meta->computed_values, parent_values, document_values,
+		PropertyIdSet dirty_properties = meta->style.ComputeValues(meta->computed_values, parent_values, document_values, shared_values,
 			computed_values_are_default_initialized, dp_ratio, vp_dimensions);
 
 		computed_values_are_default_initialized = false;
@@ -195,10 +272,34 @@ void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimension
 		// Computed values are just calculated and can safely be used in OnPropertyChange.
 		// However, new properties set during this call will not be available until the next update loop.
 		if (!dirty_properties.Empty())
+		{
+			DirtyRenderCache(this);
 			OnPropertyChange(dirty_properties);
+		}
 	}
 }
 
+const ComputedValues* Element::FindSharedComputedValues(const int child_index) const
+{
+	// Only look at a few of the closest siblings, this is enough to catch alternating styles such as in striped table rows.
+	constexpr int max_candidates = 4;
+
+	// The index may be stale if our parent's children were modified during the update.
+	if (!parent || child_index <= 0 || child_index >= (int)parent->children.size() || parent->children[child_index].get() != this)
+		return nullptr;
+
+	for (int i = child_index - 1; i >= Math::Max(child_index - max_candidates, 0); i--)
+	{
+		// The preceding siblings are updated before us, so their values are up to date unless they have since been dirtied again.
+		const Element* sibling = parent->children[i].get();
+		if (!sibling->computed_values_are_default_initialized && !sibling->meta->style.AnyPropertiesDirty() &&
+			meta->style.CanShareComputedValues(sibling->meta->style))
+			return &sibling->meta->computed_values;
+	}
+
+	return nullptr;
+}
+
 void Element::Render()
 {
 #ifdef RMLUI_TRACY_PROFILING
@@ -220,12 +321,18 @@ void Element::Render()
 
 	meta->effects.RenderEffects(RenderStage::Enter);
 
-	// Set up the clipping region for this element.
+	// Set up the clipping region for this element, and skip rendering ourself if we are entirely outside of it.
 	if (ElementUtilities::SetClippingRegion(this))
 	{
-		meta->background_border.Render(this);
-		meta->effects.RenderEffects(RenderStage::Decoration);
+		const bool culled = (cull_decoration || cull_on_render) && !IsInScissorRegion(this);
+
+		if (!culled || !cull_decoration)
+		{
+			meta->background_border.Render(this);
+			meta->effects.RenderEffects(RenderStage::Decoration);
+		}
 
+		if (!culled || !cull_on_render)
 		{
 			RMLUI_ZoneScopedNC("OnRender", 0x228B22);
 
@@ -255,6 +362,13 @@ ElementPtr Element::Clone() const
 
 	if (clone)
 	{
+		// Elements from custom instancers are visited during every update loop by default, carry this over to the clone.
+		if (!clone->needs_update_explicit && needs_update && !needs_update_explicit)
+		{
+			clone->needs_update = true;
+			clone->DirtyUpdate();
+		}
+
 		// Copy over the attributes. The 'style' and 'class' attributes are skipped because inline styles and class names are copied manually below.
 		// This is necessary in case any properties or classes have been set manually, in which case the 'style' and 'class' attributes are out of
 		// sync with the used style and active classes.
@@ -283,7 +397,7 @@ ElementPtr Element::Clone() const
 void Element::SetClass(const String& class_name, bool activate)
 {
 	if (meta->style.SetClass(class_name, activate))
-		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+		DirtySelectorDefinitions(GetInvalidationFlags(this, StyleSheetIndex::SelectorFeature::Class, class_name));
 }
 
 bool Element::IsClassSet(const String& class_name) const
@@ -465,6 +579,8 @@ void Element::SetBox(const Box& box)
 
 		main_box = box;
 		additional_boxes.clear();
+		DirtyRenderCache(this);
+		DirtyHitTestIndex();
 
 		OnResize();
 		rounded_main_padding_size_dirty = true;
@@ -477,6 +593,8 @@ void Element::SetBox(const Box& box)
 void Element::AddBox(const Box& box, Vector2f offset)
 {
 	additional_boxes.emplace_back(PositionedBox{box, offset});
+	DirtyRenderCache(this);
+	DirtyHitTestIndex();
 	OnResize();
 	meta->background_border.DirtyBackground();
 	meta->background_border.DirtyBorder();
@@ -835,8 +953,7 @@ void Element::SetPseudoClass(const String& pseudo_class, bool activate)
 {
 	if (meta->style.SetPseudoClass(pseudo_class, activate, false))
 	{
-		// Include siblings in case of RCSS presence of sibling combinators '+', '~'.
-		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+		DirtySelectorDefinitions(GetInvalidationFlags(this, StyleSheetIndex::SelectorFeature::PseudoClass, pseudo_class));
 		OnPseudoClassChange(pseudo_class, activate);
 	}
 }
@@ -1033,6 +1150,7 @@ void Element::SetScrollLeft(float scroll_left)
 		scroll_offset.x = new_offset;
 		meta->scroll.UpdateScrollbar(ElementScroll::HORIZONTAL);
 		DirtyAbsoluteOffset();
+		DirtyUpdate();
 
 		DispatchEvent(EventId::Scroll, Dictionary());
 	}
@@ -1051,6 +1169,7 @@ void Element::SetScrollTop(float scroll_top)
 		scroll_offset.y = new_offset;
 		meta->scroll.UpdateScrollbar(ElementScroll::VERTICAL);
 		DirtyAbsoluteOffset();
+		DirtyUpdate();
 
 		DispatchEvent(EventId::Scroll, Dictionary());
 	}
@@ -1716,6 +1835,20 @@ void Element::ForceLocalStackingContext()
 	DirtyStackingContext();
 }
 
+void Element::SetNeedsUpdate(bool _needs_update)
+{
+	needs_update = _needs_update;
+	needs_update_explicit = true;
+	if (needs_update)
+		DirtyUpdate();
+}
+
+void Element::SetRenderCulling(bool _cull_decoration, bool _cull_on_render)
+{
+	cull_decoration = _cull_decoration;
+	cull_on_render = _cull_on_render;
+}
+
 void Element::OnUpdate() {}
 
 void Element::OnRender() {}
@@ -1730,17 +1863,31 @@ void Element::OnStyleSheetChange() {}
 
 void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
+	DirtyRenderCache(this);
+
+	int invalidation_flags = 0;
+
 	for (const auto& element_attribute : changed_attributes)
 	{
 		const auto& attribute = element_attribute.first;
 		const auto& value = element_attribute.second;
+
+		invalidation_flags |= GetInvalidationFlags(this, StyleSheetIndex::SelectorFeature::Attribute, attribute);
+
 		if (attribute == "id")
 		{
+			invalidation_flags |= GetInvalidationFlags(this, StyleSheetIndex::SelectorFeature::Id, id);
 			id = value.Get<String>();
+			meta->style.SetId(id);
+			invalidation_flags |= GetInvalidationFlags(this, StyleSheetIndex::SelectorFeature::Id, id);
 		}
 		else if (attribute == "class")
 		{
+			for (const String& class_name : meta->style.GetClassNameList())
+				invalidation_flags |= GetInvalidationFlags(this, StyleSheetIndex::SelectorFeature::Class, class_name);
 			meta->style.SetClassNames(value.Get<String>());
+			for (const String& class_name : meta->style.GetClassNameList())
+				invalidation_flags |= GetInvalidationFlags(this, StyleSheetIndex::SelectorFeature::Class, class_name);
 		}
 		else if (((attribute == "colspan" || attribute == "rowspan") && meta->computed_values.display() == Style::Display::TableCell) ||
 			(attribute == "span" &&
@@ -1821,7 +1968,7 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 
 	// Any change to the attributes may affect which styles apply to the current element, in particular due to attribute selectors, ID selectors, and
 	// class selectors. This can further affect all siblings or descendants due to sibling or descendant combinators.
-	DirtyDefinition(DirtyNodes::SelfAndSiblings);
+	DirtySelectorDefinitions(invalidation_flags);
 }
 
 void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
@@ -1834,8 +1981,8 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::Left)      //
 	);
 
-	// See if the document layout needs to be updated.
-	if (!IsLayoutDirty())
+	// See if the layout needs to be updated. Only our own flag matters here, dirty descendants alone do not cause us to be formatted.
+	if (!dirty_layout)
 	{
 		// Force a relayout if any of the changed properties require it.
 		const PropertyIdSet changed_properties_forcing_layout =
@@ -1955,6 +2102,7 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (border_radius_changed || filter_or_mask_changed || changed_properties.Contains(PropertyId::Decorator))
 	{
 		meta->effects.DirtyEffects();
+		DirtyUpdate();
 	}
 
 	// Dirty the effects data when their visual looks may have changed.
@@ -1986,11 +2134,13 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (changed_properties.Contains(PropertyId::Animation))
 	{
 		dirty_animation = true;
+		DirtyUpdate();
 	}
 	// Check for `transition' changes
 	if (changed_properties.Contains(PropertyId::Transition))
 	{
 		dirty_transition = true;
+		DirtyUpdate();
 	}
 }
 
@@ -2002,15 +2152,27 @@ void Element::OnChildRemove(Element* /*child*/) {}
 
 void Element::DirtyLayout()
 {
-	if (Element* document = GetOwnerDocument())
-		document->DirtyLayout();
+	// Only mark ourself here, the document finds the nearest layout boundary to restart formatting from during its next layout update.
+	if (GetOwnerDocument())
+	{
+		dirty_layout = true;
+		DirtyChildLayoutOfAncestors();
+	}
+}
+
+void Element::DirtyChildLayoutOfAncestors()
+{
+	// Ancestors of an element with dirty layout always have their child layout flag set, so we can stop at the first one already set.
+	for (Element* ancestor = parent; ancestor && ancestor->owner_document == owner_document && !ancestor->dirty_child_layout;
+		 ancestor = ancestor->parent)
+	{
+		ancestor->dirty_child_layout = true;
+	}
 }
 
 bool Element::IsLayoutDirty()
 {
-	if (Element* document = GetOwnerDocument())
-		return document->IsLayoutDirty();
-	return false;
+	return dirty_layout || dirty_child_layout;
 }
 
 Element* Element::GetClosestScrollableContainer()
@@ -2188,6 +2350,9 @@ void Element::SetParent(Element* _parent)
 		// We need to update our definition and make sure we inherit the properties of our new parent.
 		DirtyDefinition(DirtyNodes::Self);
 		meta->style.DirtyInheritedProperties();
+
+		// We may already be dirty from before we were attached, make sure the update loop can reach us.
+		parent->DirtyUpdate();
 	}
 
 	// The transform state may require recalculation.
@@ -2196,6 +2361,10 @@ void Element::SetParent(Element* _parent)
 
 	SetOwnerDocument(parent ? parent->GetOwnerDocument() : nullptr);
 
+	// We may have kept dirty layout flags from our previous parent, make sure they can still be reached from our new ancestors.
+	if (parent && (dirty_layout || dirty_child_layout))
+		DirtyChildLayoutOfAncestors();
+
 	if (!parent)
 	{
 		if (data_model)
@@ -2225,12 +2394,17 @@ void Element::SetParent(Element* _parent)
 
 void Element::DirtyAbsoluteOffset()
 {
+	DirtyRenderCache(this);
+	DirtyHitTestIndex();
 	if (!absolute_offset_dirty)
 		DirtyAbsoluteOffsetRecursive();
 }
 
 void Element::DirtyAbsoluteOffsetRecursive()
 {
+	// Any stacking contexts within the moved subtree must re-index their children.
+	hit_test_index_dirty = true;
+
 	if (!absolute_offset_dirty)
 	{
 		absolute_offset_dirty = true;
@@ -2373,6 +2547,8 @@ void Element::BuildLocalStackingContext()
 	stacking_context.resize(stacking_children.size());
 	for (size_t i = 0; i < stacking_children.size(); i++)
 		stacking_context[i] = stacking_children[i].element;
+
+	hit_test_index_dirty = true;
 }
 
 void Element::AddChildrenToStackingContext(Vector<StackingContextChild>& stacking_children)
@@ -2484,6 +2660,8 @@ void Element::AddToStackingContext(Vector<StackingContextChild>& stacking_childr
 
 void Element::DirtyStackingContext()
 {
+	DirtyRenderCache(this);
+
 	// Find the first ancestor that has a local stacking context, that is our stacking context parent.
 	Element* stacking_context_parent = this;
 	while (stacking_context_parent && !stacking_context_parent->local_stacking_context)
@@ -2492,7 +2670,73 @@ void Element::DirtyStackingContext()
 	}
 
 	if (stacking_context_parent)
+	{
 		stacking_context_parent->stacking_context_dirty = true;
+		stacking_context_parent->DirtyHitTestIndex();
+	}
+}
+
+void Element::UpdateHitTestIndex()
+{
+	RMLUI_ASSERT(local_stacking_context);
+
+	if (stacking_context_dirty)
+		BuildLocalStackingContext();
+
+	if (!hit_test_index_dirty && hit_test_index)
+		return;
+
+	if (!hit_test_index)
+		hit_test_index = MakeUnique<HitTestIndex>();
+
+	hit_test_index->Clear();
+	for (Element* child : stacking_context)
+		hit_test_index->AddItem(child->GetHitTestBounds());
+	hit_test_index->Build();
+
+	hit_test_index_dirty = false;
+}
+
+Rectanglef Element::GetHitTestBounds()
+{
+	// Always update our index so that it is never left dirty while the index of our stacking context parent is clean.
+	Rectanglef descendant_bounds = Rectanglef::MakeInvalid();
+	if (local_stacking_context)
+	{
+		UpdateHitTestIndex();
+		if (hit_test_index->IsUnbounded())
+			return Rectanglef::MakeInvalid();
+		descendant_bounds = hit_test_index->GetBounds();
+	}
+
+	// Transformed elements may be projected anywhere, don't try to bound them.
+	if (transform_state && transform_state->GetTransform())
+		return Rectanglef::MakeInvalid();
+
+	const Vector2f position = GetAbsoluteOffset(BoxArea::Border);
+	Rectanglef bounds = Rectanglef::FromPositionSize(position, main_box.GetSize(BoxArea::Border));
+	for (const PositionedBox& additional_box : additional_boxes)
+		bounds = bounds.Join(Rectanglef::FromPositionSize(position + additional_box.offset, additional_box.box.GetSize(BoxArea::Border)));
+
+	if (descendant_bounds.Valid())
+		bounds = bounds.Join(descendant_bounds);
+
+	return bounds;
+}
+
+void Element::DirtyHitTestIndex()
+{
+	// Our bounds are part of the index of our stacking context parent, and so on for each ancestor stacking context. A dirty index implies
+	// that the ones above it are dirty too, so we can stop there.
+	for (Element* element = this; element; element = element->parent)
+	{
+		if (element->local_stacking_context)
+		{
+			if (element->hit_test_index_dirty)
+				break;
+			element->hit_test_index_dirty = true;
+		}
+	}
 }
 
 void Element::DirtyDefinition(DirtyNodes dirty_nodes)
@@ -2506,6 +2750,25 @@ void Element::DirtyDefinition(DirtyNodes dirty_nodes)
 			parent->dirty_child_definitions = true;
 		break;
 	}
+
+	DirtyUpdate();
+}
+
+void Element::DirtySelectorDefinitions(int invalidation_flags)
+{
+	if (invalidation_flags & StyleSheetIndex::InvalidateSiblings)
+	{
+		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+	}
+	else if (invalidation_flags & StyleSheetIndex::InvalidateDescendants)
+	{
+		DirtyDefinition(DirtyNodes::Self);
+	}
+	else if (invalidation_flags & StyleSheetIndex::InvalidateSelf)
+	{
+		dirty_own_definition = true;
+		DirtyUpdate();
+	}
 }
 
 void Element::UpdateDefinition()
@@ -2513,6 +2776,7 @@ void Element::UpdateDefinition()
 	if (dirty_definition)
 	{
 		dirty_definition = false;
+		dirty_own_definition = false;
 
 		// Dirty definition implies all our descendent elements. Anything that can change the definition of this element can also change the
 		// definition of any descendants due to the presence of RCSS descendant or child combinators. In principle this also applies to sibling
@@ -2521,15 +2785,32 @@ void Element::UpdateDefinition()
 
 		GetStyle()->UpdateDefinition();
 	}
+	else if (dirty_own_definition)
+	{
+		// Only selectors matching this element itself were affected, thus our descendants can keep their definitions.
+		dirty_own_definition = false;
+		GetStyle()->UpdateDefinition();
+	}
 
 	if (dirty_child_definitions)
 	{
 		dirty_child_definitions = false;
 		for (const ElementPtr& child : children)
+		{
+			// The children are visited right after us in the update loop, thus there is no need to dirty our ancestors.
 			child->dirty_definition = true;
+			child->dirty_update = true;
+		}
 	}
 }
 
+void Element::DirtyUpdate()
+{
+	// Ancestors of a dirty element are always dirty, except when they are being updated, so we can stop at the first dirty one.
+	for (Element* element = this; element && !element->dirty_update; element = element->parent)
+		element->dirty_update = true;
+}
+
 bool Element::Animate(const String& property_name, const Property& target_value, float duration, Tween tween, int num_iterations,
 	bool alternate_direction, float delay, const Property* start_value)
 {
@@ -2620,6 +2901,10 @@ ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, c
 		animations.erase(it);
 		it = animations.end();
 	}
+	else
+	{
+		DirtyUpdate();
+	}
 
 	return it;
 }
@@ -2994,6 +3279,8 @@ void Element::UpdateTransformState()
 	// A change in perspective or transform will require an update to children transforms as well.
 	if (perspective_or_transform_changed)
 	{
+		DirtyHitTestIndex();
+
 		for (size_t i = 0; i < children.size(); i++)
 			children[i]->DirtyTransformState(false, true);
 	}
@@ -3008,6 +3295,7 @@ void Element::UpdateTransformState()
 void Element::OnStyleSheetChangeRecursive()
 {
 	meta->effects.DirtyEffects();
+	DirtyUpdate();
 
 	OnStyleSheetChange();
 
@@ -3020,6 +3308,7 @@ void Element::OnStyleSheetChangeRecursive()
 void Element::OnDpRatioChangeRecursive()
 {
 	meta->effects.DirtyEffects();
+	DirtyUpdate();
 	GetStyle()->DirtyPropertiesWithUnits(Unit::DP_SCALABLE_LENGTH);
 
 	OnDpRatioChange();
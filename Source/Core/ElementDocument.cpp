@@ -518,6 +518,12 @@ void ElementDocument::UpdateLayout()
 {
 	// Note: Carefully consider when to call this function for performance reasons.
 	// Ideally, only called once per update loop.
+	if (!layout_dirty)
+	{
+		// Try to only format the parts of the document that have changed, otherwise fall back to formatting the whole document.
+		layout_dirty = !LayoutEngine::FormatDirtyLayoutBoundaries(this);
+	}
+
 	if (layout_dirty)
 	{
 		RMLUI_ZoneScoped;
@@ -588,7 +594,7 @@ void ElementDocument::DirtyLayout()
 
 bool ElementDocument::IsLayoutDirty()
 {
-	return layout_dirty;
+	return layout_dirty || Element::IsLayoutDirty();
 }
 
 void ElementDocument::DirtyVwAndVhProperties()
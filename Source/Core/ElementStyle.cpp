@@ -50,6 +50,8 @@
 
 namespace Rml {
 
+static StyleSharingStatistics style_sharing_statistics;
+
 inline PseudoClassState operator|(PseudoClassState lhs, PseudoClassState rhs)
 {
 	return PseudoClassState(int(lhs) | int(rhs));
@@ -62,6 +64,49 @@ inline PseudoClassState operator&(PseudoClassState lhs, PseudoClassState rhs)
 ElementStyle::ElementStyle(Element* _element)
 {
 	element = _element;
+	tag_atom = FindAtom(element->GetTagName());
+}
+
+Atom ElementStyle::FindAtom(const String& name) const
+{
+	const Atom atom = AtomTable::Find(name);
+	if (atom == AtomTable::Unknown && !has_unknown_atoms)
+	{
+		has_unknown_atoms = true;
+		atom_generation = AtomTable::GetGeneration();
+	}
+	return atom;
+}
+
+void ElementStyle::UpdateUnknownAtoms() const
+{
+	if (!has_unknown_atoms || atom_generation == AtomTable::GetGeneration())
+		return;
+
+	has_unknown_atoms = false;
+
+	if (tag_atom == AtomTable::Unknown)
+		tag_atom = FindAtom(element->GetTagName());
+	if (id_atom == AtomTable::Unknown)
+		id_atom = FindAtom(element->GetId());
+
+	for (size_t i = 0; i < class_atoms.size(); i++)
+	{
+		if (class_atoms[i] == AtomTable::Unknown)
+			class_atoms[i] = FindAtom(classes[i]);
+	}
+
+	if (std::find(pseudo_class_atoms.begin(), pseudo_class_atoms.end(), AtomTable::Unknown) != pseudo_class_atoms.end())
+	{
+		pseudo_class_atoms.clear();
+		pseudo_class_mask = 0;
+		for (const auto& pair : pseudo_classes)
+		{
+			const Atom atom = FindAtom(pair.first);
+			pseudo_class_atoms.push_back(atom);
+			pseudo_class_mask |= AtomTable::GetPseudoClassBit(atom);
+		}
+	}
 }
 
 const Property* ElementStyle::GetLocalProperty(PropertyId id, const PropertyDictionary& inline_properties, const ElementDefinition* definition)
@@ -301,7 +346,7 @@ void ElementStyle::UpdateDefinition()
 			if (!var || var->unit == Unit::PROPERTYVARIABLETERM)
 			{
 				inline_properties.RemovePropertyVariable(it.first);
-				dirty_variables.insert(it.first);
+				DirtyPropertyVariable(it.first);
 			}
 		}
 	}
@@ -309,6 +354,9 @@ void ElementStyle::UpdateDefinition()
 
 bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, bool override_class)
 {
+	// Ensure that the atoms of the active pseudo-classes are up to date before they are looked up below.
+	UpdateUnknownAtoms();
+
 	bool changed = false;
 
 	if (activate)
@@ -316,6 +364,12 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 		PseudoClassState& state = pseudo_classes[pseudo_class];
 		changed = (state == PseudoClassState::Clear);
 		state = (state | (override_class ? PseudoClassState::Override : PseudoClassState::Set));
+		if (changed)
+		{
+			const Atom atom = FindAtom(pseudo_class);
+			pseudo_class_atoms.push_back(atom);
+			pseudo_class_mask |= AtomTable::GetPseudoClassBit(atom);
+		}
 	}
 	else
 	{
@@ -327,6 +381,9 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 			if (state == PseudoClassState::Clear)
 			{
 				pseudo_classes.erase(it);
+				const Atom atom = AtomTable::Find(pseudo_class);
+				pseudo_class_atoms.erase(std::find(pseudo_class_atoms.begin(), pseudo_class_atoms.end(), atom));
+				pseudo_class_mask &= ~AtomTable::GetPseudoClassBit(atom);
 				changed = true;
 			}
 		}
@@ -355,6 +412,7 @@ bool ElementStyle::SetClass(const String& class_name, bool activate)
 		if (class_location == classes.end())
 		{
 			classes.push_back(class_name);
+			class_atoms.push_back(FindAtom(class_name));
 			changed = true;
 		}
 	}
@@ -362,6 +420,7 @@ bool ElementStyle::SetClass(const String& class_name, bool activate)
 	{
 		if (class_location != classes.end())
 		{
+			class_atoms.erase(class_atoms.begin() + (class_location - classes.begin()));
 			classes.erase(class_location);
 			changed = true;
 		}
@@ -379,6 +438,10 @@ void ElementStyle::SetClassNames(const String& class_names)
 {
 	classes.clear();
 	StringUtilities::ExpandString(classes, class_names, ' ');
+
+	class_atoms.clear();
+	for (const String& class_name : classes)
+		class_atoms.push_back(FindAtom(class_name));
 }
 
 String ElementStyle::GetClassNames() const
@@ -401,6 +464,53 @@ const StringList& ElementStyle::GetClassNameList() const
 	return classes;
 }
 
+void ElementStyle::SetId(const String& id)
+{
+	id_atom = FindAtom(id);
+}
+
+Atom ElementStyle::GetTagAtom() const
+{
+	UpdateUnknownAtoms();
+	return tag_atom;
+}
+
+Atom ElementStyle::GetIdAtom() const
+{
+	UpdateUnknownAtoms();
+	return id_atom;
+}
+
+const Vector<Atom>& ElementStyle::GetClassAtomList() const
+{
+	UpdateUnknownAtoms();
+	return class_atoms;
+}
+
+bool ElementStyle::IsClassSet(Atom class_atom) const
+{
+	UpdateUnknownAtoms();
+	return std::find(class_atoms.begin(), class_atoms.end(), class_atom) != class_atoms.end();
+}
+
+const Vector<Atom>& ElementStyle::GetPseudoClassAtomList() const
+{
+	UpdateUnknownAtoms();
+	return pseudo_class_atoms;
+}
+
+bool ElementStyle::IsPseudoClassSet(Atom pseudo_class_atom) const
+{
+	UpdateUnknownAtoms();
+	return std::find(pseudo_class_atoms.begin(), pseudo_class_atoms.end(), pseudo_class_atom) != pseudo_class_atoms.end();
+}
+
+uint32_t ElementStyle::GetPseudoClassMask() const
+{
+	UpdateUnknownAtoms();
+	return pseudo_class_mask;
+}
+
 bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 {
 	Property new_property = property;
@@ -589,6 +699,7 @@ float ElementStyle::ResolveRelativeLength(NumericValue value, RelativeTarget rel
 void ElementStyle::DirtyInheritedProperties()
 {
 	dirty_properties |= StyleSheetSpecification::GetRegisteredInheritedProperties();
+	element->DirtyUpdate();
 }
 
 void ElementStyle::DirtyPropertiesWithUnits(Units units)
@@ -617,6 +728,7 @@ void ElementStyle::DirtyPropertiesWithUnitsRecursive(Units units)
 void ElementStyle::DirtyPropertyVariable(String const& name)
 {
 	dirty_variables.insert(name);
+	element->DirtyUpdate();
 }
 
 bool ElementStyle::AnyPropertiesDirty() const
@@ -624,6 +736,30 @@ bool ElementStyle::AnyPropertiesDirty() const
 	return !dirty_properties.Empty() || !dirty_variables.empty();
 }
 
+bool ElementStyle::IsSharable() const
+{
+	// Variable-dependent properties are resolved into the inline properties, thus an empty dictionary also implies that no variables are
+	// in use. We still check the dependencies, since the dictionary is only populated during the next computation of values.
+	return definition && source_inline_properties.Empty() && source_inline_properties.GetDependentShorthands().empty() &&
+		inline_properties.Empty() && dirty_variables.empty() && dirty_shorthands.empty() && property_dependencies.empty() &&
+		shorthand_dependencies.empty();
+}
+
+bool ElementStyle::CanShareComputedValues(const ElementStyle& other) const
+{
+	return definition == other.definition && IsSharable() && other.IsSharable();
+}
+
+StyleSharingStatistics ElementStyle::GetStyleSharingStatistics()
+{
+	return style_sharing_statistics;
+}
+
+void ElementStyle::ResetStyleSharingStatistics()
+{
+	style_sharing_statistics = {};
+}
+
 PropertiesIterator ElementStyle::Iterate() const
 {
 	// Note: Value initialized iterators are only guaranteed to compare equal in C++14, and only for iterators
@@ -657,11 +793,15 @@ UnorderedSet<String> ElementStyle::GetDirtyPropertyVariables() const
 void ElementStyle::DirtyProperty(PropertyId id)
 {
 	dirty_properties.Insert(id);
+	element->DirtyUpdate();
 }
 
 void ElementStyle::DirtyProperties(const PropertyIdSet& properties)
 {
+	if (properties.Empty())
+		return;
 	dirty_properties |= properties;
+	element->DirtyUpdate();
 }
 
 void ElementStyle::ResolveProperty(PropertyDictionary& output, PropertyId id, const Element* element, const PropertyDictionary& inline_properties,
@@ -820,7 +960,8 @@ void ElementStyle::UpdateShorthandDependencies(ShorthandId id)
 }
 
 PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values,
-	const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions)
+	const Style::ComputedValues* document_values, const Style::ComputedValues* shared_values, bool values_are_default_initialized,
+	float dp_ratio, Vector2f vp_dimensions)
 {
 	// update variables and dirty relevant properties
 	if (!dirty_variables.empty())
@@ -848,10 +989,36 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		dirty_shorthands.clear();
 	}
 
-	if (!dirty_properties.Empty())
+	if (!dirty_properties.Empty() && shared_values)
+	{
+		// The sibling's values were computed from the same properties and parent, copy them and only find the properties affected by the change.
+		style_sharing_statistics.num_hits += 1;
+
+		const float font_size_before = values.font_size();
+		const Style::LineHeight line_height_before = values.line_height();
+
+		values.CopyNonInherited(*shared_values);
+		values.CopyInherited(*shared_values);
+
+		if (font_size_before != values.font_size())
+		{
+			dirty_properties.Insert(PropertyId::LineHeight);
+			for (auto it = Iterate(); !it.AtEnd(); ++it)
+			{
+				if ((*it).second.unit == Unit::EM)
+					dirty_properties.Insert((*it).first);
+			}
+		}
+
+		if (line_height_before.value != values.line_height().value || line_height_before.inherit_value != values.line_height().inherit_value)
+			dirty_properties.Insert(PropertyId::VerticalAlign);
+	}
+	else if (!dirty_properties.Empty())
 	{
 		RMLUI_ZoneScopedC(0xFF7F50);
 
+		style_sharing_statistics.num_misses += 1;
+
 		// resolve potentially variable-dependent properties
 		for (auto const& id : dirty_properties)
 			ResolveProperty(inline_properties, id, element, source_inline_properties, definition.get());
@@ -1268,6 +1435,8 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 			auto child = element->GetChild(i);
 			child->GetStyle()->dirty_properties |= dirty_inherited_properties;
 			child->GetStyle()->dirty_variables.insert(dirty_variables.begin(), dirty_variables.end());
+			// The children are updated right after us, no need to dirty our ancestors.
+			child->dirty_update = true;
 		}
 	}
 
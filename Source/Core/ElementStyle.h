@@ -32,7 +32,9 @@
 #include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
+#include "../../Include/RmlUi/Core/StyleSharing.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AtomTable.h"
 
 namespace Rml {
 
@@ -89,6 +91,25 @@ public:
 	/// Return the active class list.
 	const StringList& GetClassNameList() const;
 
+	/// Sets the element's id to be used for selector matching.
+	/// @param[in] id The new id of the element.
+	void SetId(const String& id);
+
+	/// Returns the atom of the element's tag name.
+	Atom GetTagAtom() const;
+	/// Returns the atom of the element's id.
+	Atom GetIdAtom() const;
+	/// Returns the atoms of the active classes, in the same order as the class list.
+	const Vector<Atom>& GetClassAtomList() const;
+	/// Checks if the class represented by the given atom is set on the element.
+	bool IsClassSet(Atom class_atom) const;
+	/// Returns the atoms of the active pseudo-classes.
+	const Vector<Atom>& GetPseudoClassAtomList() const;
+	/// Checks if the pseudo-class represented by the given atom is set on the element.
+	bool IsPseudoClassSet(Atom pseudo_class_atom) const;
+	/// Returns the bitmask of active pseudo-classes, only pseudo-classes with a bit from AtomTable::GetPseudoClassBit() are represented.
+	uint32_t GetPseudoClassMask() const;
+
 	/// Sets a local property override on the element to a pre-parsed value.
 	/// @param[in] id The ID  of the new property.
 	/// @param[in] property The parsed property to set.
@@ -161,10 +182,23 @@ public:
 	/// Returns true if any properties are dirty such that computed values need to be recomputed
 	bool AnyPropertiesDirty() const;
 
+	/// Returns true if the computed values of the given style can be copied to this style. This is the case when both elements share the same
+	/// definition and have no inline properties or variables, so that their values are fully determined by the definition and the parent.
+	/// @note The caller must ensure that both elements have the same parent, and that the values of the other element are up to date.
+	bool CanShareComputedValues(const ElementStyle& other) const;
+
 	/// Turns the local and inherited properties into computed values for this element. These values can in turn be used during the layout procedure.
 	/// Must be called in correct order, always parent before its children.
+	/// @param[in] shared_values The computed values of a sibling for which CanShareComputedValues() holds. If set, these values are copied
+	/// instead of being resolved from the properties.
 	PropertyIdSet ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values,
-		const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions);
+		const Style::ComputedValues* document_values, const Style::ComputedValues* shared_values, bool values_are_default_initialized,
+		float dp_ratio, Vector2f vp_dimensions);
+
+	/// Returns the number of shared and resolved computed values since initialization.
+	static StyleSharingStatistics GetStyleSharingStatistics();
+	/// Resets the style sharing statistics, called during shutdown.
+	static void ResetStyleSharingStatistics();
 
 	/// Returns an iterator for iterating the local properties of this element.
 	/// Note: Modifying the element's style invalidates its iterator.
@@ -173,6 +207,14 @@ public:
 	UnorderedSet<String> GetDirtyPropertyVariables() const;
 
 private:
+	// Returns true if the computed values only depend on the definition and the parent values.
+	bool IsSharable() const;
+
+	// Returns the atom of the given name, or AtomTable::Unknown if it is not used by any selector.
+	Atom FindAtom(const String& name) const;
+	// Looks up unknown atoms again if new names have been interned since they were last looked up.
+	void UpdateUnknownAtoms() const;
+
 	// Sets a list of properties as dirty.
 	void DirtyProperties(const PropertyIdSet& properties);
 
@@ -207,6 +249,16 @@ private:
 	// This element's current pseudo-classes.
 	PseudoClassMap pseudo_classes;
 
+	// Atoms of the element's tag, id, classes, and pseudo-classes, and the mask of its pseudo-classes, for fast selector matching. Names not
+	// used by any selector are represented by AtomTable::Unknown, these are looked up again when new names have been interned since.
+	mutable Atom tag_atom = 0;
+	mutable Atom id_atom = 0;
+	mutable Vector<Atom> class_atoms;
+	mutable Vector<Atom> pseudo_class_atoms;
+	mutable uint32_t pseudo_class_mask = 0;
+	mutable uint32_t atom_generation = 0;
+	mutable bool has_unknown_atoms = false;
+
 	// Any properties that have been manually overridden in this element.
 	PropertyDictionary source_inline_properties;
 	// All manually overridden properties and resolved variable-depdendent values.
@@ -42,6 +42,8 @@
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
 #include "TransformState.h"
+#include <algorithm>
+#include <iterator>
 
 namespace Rml {
 
@@ -70,9 +72,13 @@ void LogMissingFontFace(Element* element)
 
 ElementText::ElementText(const String& tag) :
 	Element(tag), colour(255, 255, 255), opacity(1), font_handle_version(0), geometry_dirty(true), dirty_layout_on_change(true),
+	geometry_per_line(false), line_geometry_dirty(false),
 	generated_decoration(Style::TextDecoration::None), decoration_property(Style::TextDecoration::None), font_effects_dirty(true),
 	font_effects_handle(0)
-{}
+{
+	// Text has no decoration of its own, and culls each of its lines when rendering.
+	SetRenderCulling(false, false);
+}
 
 ElementText::~ElementText() {}
 
@@ -82,6 +88,9 @@ void ElementText::SetText(const String& _text)
 	{
 		text = _text;
 
+		if (Context* context = GetContext())
+			context->DirtyRenderCache();
+
 		if (dirty_layout_on_change)
 			DirtyLayout();
 	}
@@ -114,8 +123,8 @@ void ElementText::OnRender()
 		geometry_dirty = true;
 	}
 
-	// Regenerate the geometry if the colour or font configuration has altered.
-	if (geometry_dirty)
+	// Regenerate the geometry if the colour or font configuration has altered, or if any lines are new.
+	if (geometry_dirty || line_geometry_dirty)
 		GenerateGeometry(render_manager, font_face_handle);
 
 	// Regenerate text decoration if necessary.
@@ -142,35 +151,40 @@ void ElementText::OnRender()
 
 	const Vector2f translation = GetAbsoluteOffset();
 
-	bool render = true;
-
 	// Do a visibility test against the scissor region to avoid unnecessary render calls. Instead of handling
 	// culling in complicated transform cases, for simplicity we always proceed to render if one is detected.
 	Rectanglei scissor_region = render_manager.GetScissorRegion();
 	if (!scissor_region.Valid())
 		scissor_region = Rectanglei::FromSize(render_manager.GetViewport());
 
-	if (!GetTransformState() || !GetTransformState()->GetTransform())
-	{
-		const FontMetrics& font_metrics = GetFontEngineInterface()->GetFontMetrics(GetFontFaceHandle());
-		const int ascent = Math::RoundUpToInteger(font_metrics.ascent);
-		const int descent = Math::RoundUpToInteger(font_metrics.descent);
+	const bool cull_lines = (!GetTransformState() || !GetTransformState()->GetTransform());
+	const FontMetrics& font_metrics = GetFontEngineInterface()->GetFontMetrics(font_face_handle);
+	const int ascent = Math::RoundUpToInteger(font_metrics.ascent);
+	const int descent = Math::RoundUpToInteger(font_metrics.descent);
 
-		render = false;
-		for (const Line& line : lines)
-		{
-			const Vector2i baseline = Vector2i(translation + line.position);
-			const Rectanglei line_region = Rectanglei::FromCorners(baseline - Vector2i(0, ascent), baseline + Vector2i(line.width, descent));
+	auto IsLineVisible = [&](const Line& line) {
+		if (!cull_lines)
+			return true;
+		const Vector2i baseline = Vector2i(translation + line.position);
+		const Rectanglei line_region = Rectanglei::FromCorners(baseline - Vector2i(0, ascent), baseline + Vector2i(line.width, descent));
+		return line_region.Valid() && scissor_region.Intersects(line_region);
+	};
 
-			if (line_region.Valid() && scissor_region.Intersects(line_region))
+	if (geometry_per_line)
+	{
+		// Render the lines one layer at a time, the same order as for combined geometry, so that the font effects of one line never cover the
+		// text of another line. All lines have the same layout of geometry layers.
+		const size_t num_geometries = (lines.empty() ? 0 : lines[0].geometry.size());
+		for (size_t i = 0; i < num_geometries; i++)
+		{
+			for (Line& line : lines)
 			{
-				render = true;
-				break;
+				if (IsLineVisible(line))
+					line.geometry[i].geometry.Render(translation + line.geometry_offset, line.geometry[i].texture);
 			}
 		}
 	}
-
-	if (render)
+	else if (!cull_lines || std::any_of(lines.begin(), lines.end(), IsLineVisible))
 	{
 		for (size_t i = 0; i < geometry.size(); ++i)
 			geometry[i].geometry.Render(translation, geometry[i].texture);
@@ -319,7 +333,76 @@ void ElementText::AddLine(Vector2f line_position, String line)
 
 	lines.emplace_back(std::move(line), line_position);
 
-	geometry_dirty = true;
+	if (geometry_per_line)
+		line_geometry_dirty = true;
+	else
+		geometry_dirty = true;
+}
+
+void ElementText::ReplaceLines(int begin, int end, Vector<String>&& new_lines, const Vector<Vector2f>& new_line_positions)
+{
+	RMLUI_ASSERT(begin >= 0 && begin <= end && end <= (int)lines.size());
+	RMLUI_ASSERT(new_lines.size() == new_line_positions.size());
+
+	if (font_effects_dirty)
+		UpdateFontEffects();
+
+	// Reuse the existing line entries where possible, to avoid moving all the following lines more than necessary.
+	const int num_reused = Math::Min(end - begin, (int)new_lines.size());
+	for (int i = 0; i < num_reused; i++)
+	{
+		Line& line = lines[begin + i];
+		line.text = std::move(new_lines[i]);
+		line.position = new_line_positions[i];
+		line.geometry_dirty = true;
+	}
+
+	if (num_reused < end - begin)
+	{
+		lines.erase(lines.begin() + begin + num_reused, lines.begin() + end);
+	}
+	else if (num_reused < (int)new_lines.size())
+	{
+		LineList inserted_lines;
+		inserted_lines.reserve(new_lines.size() - num_reused);
+		for (size_t i = num_reused; i < new_lines.size(); i++)
+			inserted_lines.emplace_back(std::move(new_lines[i]), new_line_positions[i]);
+
+		lines.insert(lines.begin() + begin + num_reused, std::make_move_iterator(inserted_lines.begin()),
+			std::make_move_iterator(inserted_lines.end()));
+	}
+
+	if (geometry_per_line)
+	{
+		line_geometry_dirty = true;
+		generated_decoration = Style::TextDecoration::None;
+	}
+	else
+	{
+		geometry_dirty = true;
+	}
+
+	if (Context* context = GetContext())
+		context->DirtyRenderCache();
+}
+
+void ElementText::TranslateLines(int begin, Vector2f offset)
+{
+	RMLUI_ASSERT(begin >= 0 && begin <= (int)lines.size());
+
+	for (int i = begin; i < (int)lines.size(); i++)
+	{
+		lines[i].position += offset;
+		lines[i].geometry_offset += offset;
+	}
+
+	if (geometry_per_line)
+		generated_decoration = Style::TextDecoration::None;
+	else
+		geometry_dirty = true;
+
+	if (Context* context = GetContext())
+		context->DirtyRenderCache();
 }
 
 void ElementText::SuppressAutoLayout()
@@ -327,6 +410,16 @@ void ElementText::SuppressAutoLayout()
 	dirty_layout_on_change = false;
 }
 
+void ElementText::EnableGeometryPerLine()
+{
+	if (!geometry_per_line)
+	{
+		geometry_per_line = true;
+		geometry.clear();
+		geometry_dirty = true;
+	}
+}
+
 void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
@@ -368,6 +461,8 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 		font_face_changed = true;
 
 		geometry.clear();
+		for (Line& line : lines)
+			line.geometry.clear();
 		geometry_dirty = true;
 
 		font_effects_handle = 0;
@@ -455,6 +550,50 @@ void ElementText::GenerateGeometry(RenderManager& render_manager, const FontFace
 	const auto& computed = GetComputedValues();
 	const TextShapingContext text_shaping_context{computed.language(), computed.direction(), computed.letter_spacing()};
 
+	if (geometry_per_line)
+	{
+		auto GenerateLineGeometry = [&](Line& line) {
+			TexturedMeshList mesh_list(line.geometry.size());
+			for (size_t i = 0; i < line.geometry.size(); i++)
+				mesh_list[i].mesh = line.geometry[i].geometry.Release(Geometry::ReleaseMode::ClearMesh);
+
+			line.width = GetFontEngineInterface()->GenerateString(render_manager, font_face_handle, font_effects_handle, line.text, line.position,
+				colour, opacity, text_shaping_context, mesh_list);
+
+			line.geometry.resize(mesh_list.size());
+			for (size_t i = 0; i < line.geometry.size(); i++)
+			{
+				line.geometry[i].geometry = render_manager.MakeGeometry(std::move(mesh_list[i].mesh));
+				line.geometry[i].texture = mesh_list[i].texture;
+			}
+
+			line.geometry_offset = {};
+			line.geometry_dirty = false;
+		};
+
+		// Only generate geometry for new lines, unless everything needs to be regenerated.
+		for (Line& line : lines)
+		{
+			if (geometry_dirty || line.geometry_dirty)
+				GenerateLineGeometry(line);
+		}
+
+		// The font may have gained new textures since the other lines were generated, in which case their geometry layers no longer line up.
+		// Regenerate all lines so that they can be rendered together layer by layer.
+		const bool uniform_layers = std::all_of(lines.begin(), lines.end(),
+			[this](const Line& line) { return line.geometry.size() == lines.front().geometry.size(); });
+		if (!uniform_layers)
+		{
+			for (Line& line : lines)
+				GenerateLineGeometry(line);
+		}
+
+		generated_decoration = Style::TextDecoration::None;
+		geometry_dirty = false;
+		line_geometry_dirty = false;
+		return;
+	}
+
 	// Release the old geometry, and reuse the mesh buffers.
 	TexturedMeshList mesh_list(geometry.size());
 	for (size_t i = 0; i < geometry.size(); i++)
@@ -42,6 +42,9 @@ ElementFormControlInput::ElementFormControlInput(const String& tag) : ElementFor
 	// OnAttributeChange will be called right after this, possible with a non-default type. Thus,
 	// creating the default InputTypeText here may result in it being destroyed in just a few moments.
 	// Instead, we create the InputTypeText in OnAttributeChange in the case where the type attribute has not been set.
+
+	// The input types poll their widgets during OnUpdate(), such as for the blinking cursor and range slider.
+	SetNeedsUpdate(true);
 }
 
 ElementFormControlInput::~ElementFormControlInput() {}
@@ -37,6 +37,7 @@ namespace Rml {
 ElementFormControlSelect::ElementFormControlSelect(const String& tag) : ElementFormControl(tag), widget(nullptr)
 {
 	widget = new WidgetDropDown(this);
+	SetNeedsUpdate(true);
 }
 
 ElementFormControlSelect::~ElementFormControlSelect()
@@ -131,8 +132,6 @@ bool ElementFormControlSelect::IsSelectBoxVisible()
 
 void ElementFormControlSelect::OnUpdate()
 {
-	ElementFormControl::OnUpdate();
-
 	MoveChildren();
 
 	widget->OnUpdate();
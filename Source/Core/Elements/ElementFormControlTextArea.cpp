@@ -40,6 +40,7 @@ ElementFormControlTextArea::ElementFormControlTextArea(const String& tag) : Elem
 {
 	widget = MakeUnique<WidgetTextInputMultiLine>(this);
 	SetWordWrapProperties();
+	SetNeedsUpdate(true);
 }
 
 ElementFormControlTextArea::~ElementFormControlTextArea() {}
@@ -44,6 +44,9 @@ ElementImage::ElementImage(const String& tag) : Element(tag), dimensions(-1, -1)
 	dimensions_scale = 1.0f;
 	geometry_dirty = false;
 	texture_dirty = true;
+
+	// The image is rendered within the content box, thus it can be culled along with the rest of the element.
+	SetRenderCulling(true, true);
 }
 
 ElementImage::~ElementImage() {}
@@ -210,9 +210,11 @@ WidgetTextInput::WidgetTextInput(ElementFormControl* _parent)
 	if (text_element)
 	{
 		text_element->SuppressAutoLayout();
+		text_element->EnableGeometryPerLine();
 		parent->AppendChild(std::move(unique_text), false);
 
 		selected_text_element->SuppressAutoLayout();
+		selected_text_element->EnableGeometryPerLine();
 		parent->AppendChild(std::move(unique_selected_text), false);
 	}
 
@@ -287,6 +289,7 @@ void WidgetTextInput::SetValue(String value)
 	{
 		TransformValue(value);
 
+		RecordValueChange(value);
 		text_element->SetText(value);
 
 		// Reset the IME composition range when the value changes.
@@ -1190,34 +1193,63 @@ void WidgetTextInput::FormatElement()
 	const Overflow y_overflow_property = parent->GetComputedValues().overflow_y();
 	const bool word_wrap = (parent->GetComputedValues().white_space() == WhiteSpace::Prewrap);
 
-	if (x_overflow_property == Overflow::Scroll)
-		scroll->EnableScrollbar(ElementScroll::HORIZONTAL, width);
-	else
-		scroll->DisableScrollbar(ElementScroll::HORIZONTAL);
-
-	if (y_overflow_property == Overflow::Scroll)
-		scroll->EnableScrollbar(ElementScroll::VERTICAL, width);
-	else
-		scroll->DisableScrollbar(ElementScroll::VERTICAL);
+	// If the vertical scrollbar was needed during the previous formatting, then the text is likely to still overflow. In this case, format the text
+	// with the scrollbar enabled right away, so that we avoid formatting twice and can reuse lines from the previous formatting.
+	bool keep_vertical_scrollbar = (y_overflow_property == Overflow::Auto && scroll->GetScrollbarSize(ElementScroll::VERTICAL) > 0.f);
 
-	// If the formatting produces scrollbars we need to format again later, this constraint enables early exit for the first formatting round.
-	const float formatting_height_constraint = (y_overflow_property == Overflow::Auto ? GetAvailableHeight() : FLT_MAX);
+	auto ResetScrollbars = [&]() {
+		if (x_overflow_property == Overflow::Scroll)
+			scroll->EnableScrollbar(ElementScroll::HORIZONTAL, width);
+		else
+			scroll->DisableScrollbar(ElementScroll::HORIZONTAL);
 
-	// Format the text and determine its total area.
-	Vector2f content_area = FormatText(formatting_height_constraint);
+		if (y_overflow_property == Overflow::Scroll || keep_vertical_scrollbar)
+			scroll->EnableScrollbar(ElementScroll::VERTICAL, width);
+		else
+			scroll->DisableScrollbar(ElementScroll::VERTICAL);
+	};
 
-	// If we're set to automatically generate horizontal scrollbars, check for that now.
-	if (!word_wrap && x_overflow_property == Overflow::Auto && content_area.x > GetAvailableWidth() + OVERFLOW_TOLERANCE)
-		scroll->EnableScrollbar(ElementScroll::HORIZONTAL, width);
+	ResetScrollbars();
 
-	// Now check for vertical overflow. If we do turn on the scrollbar, this will cause a reflow.
-	if (y_overflow_property == Overflow::Auto && content_area.y > GetAvailableHeight() + OVERFLOW_TOLERANCE)
+	Vector2f content_area;
+	if (keep_vertical_scrollbar)
 	{
-		scroll->EnableScrollbar(ElementScroll::VERTICAL, width);
 		content_area = FormatText();
 
 		if (!word_wrap && x_overflow_property == Overflow::Auto && content_area.x > GetAvailableWidth() + OVERFLOW_TOLERANCE)
 			scroll->EnableScrollbar(ElementScroll::HORIZONTAL, width);
+
+		// Formatting without the scrollbar results in at least one line per paragraph. Keep the scrollbar only if those lines would overflow, as
+		// otherwise the text may fit without the scrollbar.
+		const int num_paragraphs = 1 + (int)std::count_if(lines.begin(), lines.end(), [](const Line& line) { return line.size > line.editable_length; });
+		if (float(num_paragraphs) * GetLineHeight() <= GetAvailableHeight() + OVERFLOW_TOLERANCE)
+		{
+			keep_vertical_scrollbar = false;
+			ResetScrollbars();
+		}
+	}
+
+	if (!keep_vertical_scrollbar)
+	{
+		// If the formatting produces scrollbars we need to format again later, this constraint enables early exit for the first formatting round.
+		const float formatting_height_constraint = (y_overflow_property == Overflow::Auto ? GetAvailableHeight() : FLT_MAX);
+
+		// Format the text and determine its total area.
+		content_area = FormatText(formatting_height_constraint);
+
+		// If we're set to automatically generate horizontal scrollbars, check for that now.
+		if (!word_wrap && x_overflow_property == Overflow::Auto && content_area.x > GetAvailableWidth() + OVERFLOW_TOLERANCE)
+			scroll->EnableScrollbar(ElementScroll::HORIZONTAL, width);
+
+		// Now check for vertical overflow. If we do turn on the scrollbar, this will cause a reflow.
+		if (y_overflow_property == Overflow::Auto && content_area.y > GetAvailableHeight() + OVERFLOW_TOLERANCE)
+		{
+			scroll->EnableScrollbar(ElementScroll::VERTICAL, width);
+			content_area = FormatText();
+
+			if (!word_wrap && x_overflow_property == Overflow::Auto && content_area.x > GetAvailableWidth() + OVERFLOW_TOLERANCE)
+				scroll->EnableScrollbar(ElementScroll::HORIZONTAL, width);
+		}
 	}
 
 	// For text elements, make the content and padding on all sides reachable by scrolling.
@@ -1236,11 +1268,6 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 
 	const FontMetrics& font_metrics = GetFontEngineInterface()->GetFontMetrics(font_handle);
 
-	// Clear the old lines, and all the lines in the text elements.
-	lines.clear();
-	text_element->ClearLines();
-	selected_text_element->ClearLines();
-
 	// Determine the line-height of the text element.
 	const float line_height = GetLineHeight();
 
@@ -1251,21 +1278,92 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 	const int endline_font_width = int(0.4f * parent->GetComputedValues().font_size());
 
 	const float available_width = GetAvailableWidth();
-	int line_begin = 0;
-	Vector2f line_position = {0, top_to_baseline};
-	bool last_line = false;
+
+	auto IsHardWrapped = [](const Line& line) { return line.size > line.editable_length; };
+
+	// The previous lines can be reused as long as nothing that affects the layout of every line has changed.
+	FormattingState& state = formatting_state;
+	const bool reuse_lines = (state.valid && !lines.empty() && state.font_handle == font_handle && state.available_width == available_width &&
+		state.cursor_width == cursor_size.x && state.line_height == line_height);
+
+	// Only the lines in the range [first_line, reuse_line) need to be formatted again, the other lines are kept.
+	int first_line = 0;
+	int reuse_line = (int)lines.size();
+
+	if (reuse_lines)
+	{
+		const int size_delta = state.changed_size_delta;
+		int dirty_begin = state.changed_begin;
+		int dirty_end = state.changed_end;
+
+		// Convert an end index of the current value to the formatted value, conservatively moving any index before the changed end to that end.
+		auto ToFormattedEndIndex = [&state](int index) {
+			if (state.changed_begin == INT_MAX)
+				return index;
+			return Math::Max(index - state.changed_size_delta, state.changed_end);
+		};
+		auto AddDirtyRange = [&](int begin, int end) {
+			dirty_begin = Math::Min(dirty_begin, begin);
+			dirty_end = Math::Max(dirty_end, end);
+		};
+
+		// Any lines covered by the previous or the current selection and composition need to be formatted again. Begin indices of the current
+		// ranges only take effect when located before the changed text, where they are identical to the indices of the formatted value.
+		if (state.selection_end > state.selection_begin)
+			AddDirtyRange(state.selection_begin, state.selection_end);
+		if (state.composition_end > state.composition_begin)
+			AddDirtyRange(state.composition_begin, state.composition_end);
+		if (selection_length > 0)
+			AddDirtyRange(selection_begin_index, ToFormattedEndIndex(selection_begin_index + selection_length));
+		if (ime_composition_end_index > ime_composition_begin_index)
+			AddDirtyRange(ime_composition_begin_index, ToFormattedEndIndex(ime_composition_end_index));
+
+		if (dirty_begin == INT_MAX)
+		{
+			first_line = (int)lines.size();
+		}
+		else
+		{
+			// Start from the beginning of the paragraph where the changes begin, since they may affect word wrapping anywhere in the paragraph.
+			auto it_line = std::upper_bound(lines.begin(), lines.end(), dirty_begin, [](int index, const Line& line) { return index < line.value_offset; });
+			first_line = Math::Max(int(it_line - lines.begin()) - 1, 0);
+			while (first_line > 0 && !IsHardWrapped(lines[first_line - 1]))
+				first_line -= 1;
+
+			// Lines can be reused starting from the first paragraph after the changes, from there on only their offsets change.
+			reuse_line = first_line + 1;
+			while (reuse_line < (int)lines.size() && !(lines[reuse_line].value_offset > dirty_end && IsHardWrapped(lines[reuse_line - 1])))
+				reuse_line += 1;
+		}
+
+		for (int i = reuse_line; i < (int)lines.size(); i++)
+			lines[i].value_offset += size_delta;
+	}
+
+	const int reuse_value_offset = (reuse_line < (int)lines.size() ? lines[reuse_line].value_offset : INT_MAX);
+
+	LineList new_lines;
+	Vector<String> new_text_lines, new_selected_text_lines;
+	Vector<Vector2f> new_text_line_positions, new_selected_text_line_positions;
 
 	float max_selection_right_edge = 0;
 
 	// Clear the selection background and IME composition geometry, and get the vertices and indices so the new geometry can be generated.
 	Mesh selection_composition_mesh = selection_composition_geometry.Release(Geometry::ReleaseMode::ClearMesh);
 
-	// Keep generating lines until all the text content is placed.
-	do
+	const String& text = GetValue();
+	int line_begin = (first_line < (int)lines.size() ? lines[first_line].value_offset : 0);
+	Vector2f line_position = {0, top_to_baseline + float(first_line) * line_height};
+	bool last_line = false;
+	bool formatting_complete = true;
+
+	// Keep generating lines until all the text content is placed, or until we reach lines that can be reused.
+	while (!reuse_lines || first_line < reuse_line)
 	{
 		if (available_width <= 0.f)
 		{
-			lines.push_back(Line{});
+			new_lines.push_back(Line{});
+			formatting_complete = false;
 			break;
 		}
 
@@ -1286,7 +1384,6 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 		// Include all spaces at the end of this line, if they were not included due to soft-wrapping in `GenerateLine`.
 		// This helps prevent sudden shifts when whitespace wraps down to the next line.
 		{
-			const String& text = GetValue();
 			size_t i_space_begin = size_t(line_begin + line.editable_length);
 			size_t i_space_end = Math::Min(text.find_first_not_of(' ', i_space_begin), text.size());
 			size_t count = i_space_end - i_space_begin;
@@ -1305,6 +1402,8 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 			}
 		}
 
+		line.width = line_width;
+
 		// Now that we have the string of characters appearing on the new line, we split it into
 		// three parts; the unselected text appearing before any selected text on the line, the
 		// selected text on the line, and any unselected text after the selection.
@@ -1316,7 +1415,9 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 		if (!pre_selection.empty())
 		{
 			const int width = ElementUtilities::GetStringWidth(text_element, pre_selection);
-			text_element->AddLine(line_position + Vector2f{GetAlignmentSpecificTextOffset(line), 0}, String(pre_selection));
+			new_text_lines.emplace_back(pre_selection);
+			new_text_line_positions.push_back(line_position + Vector2f{GetAlignmentSpecificTextOffset(line), 0});
+			line.num_text_lines += 1;
 			line_position.x += width;
 		}
 
@@ -1346,7 +1447,9 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 
 			MeshUtilities::GenerateQuad(selection_composition_mesh, aligned_position - Vector2f(0, top_to_baseline), selection_size,
 				selection_colour);
-			selected_text_element->AddLine(aligned_position, String(selection));
+			new_selected_text_lines.emplace_back(selection);
+			new_selected_text_line_positions.push_back(aligned_position);
+			line.num_selected_text_lines += 1;
 
 			max_selection_right_edge = Math::Max(max_selection_right_edge, aligned_position.x + selection_size.x);
 			line_position.x += selection_width;
@@ -1357,7 +1460,9 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 		if (!post_selection.empty())
 		{
 			line_position.x += GetKerningBetween(selection, post_selection);
-			text_element->AddLine(line_position + Vector2f{GetAlignmentSpecificTextOffset(line), 0}, String(post_selection));
+			new_text_lines.emplace_back(post_selection);
+			new_text_line_positions.push_back(line_position + Vector2f{GetAlignmentSpecificTextOffset(line), 0});
+			line.num_text_lines += 1;
 		}
 
 		// We fetch the IME composition on the new line to highlight it.
@@ -1384,14 +1489,61 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 		line_position.x = 0;
 		line_position.y += line_height;
 
-		// Grow the content area width-wise if this line is the longest so far, and push the height out.
-		content_area.x = Math::Max(content_area.x, line_width + cursor_size.x);
-		content_area.y = line_position.y - top_to_baseline;
-
 		// Finally, push the new line into our array of lines.
-		lines.push_back(std::move(line));
+		new_lines.push_back(std::move(line));
+
+		if (last_line || line_begin == reuse_value_offset)
+			break;
+
+		if (line_position.y - top_to_baseline > height_constraint + OVERFLOW_TOLERANCE)
+		{
+			formatting_complete = false;
+			break;
+		}
+	}
+
+	// Drop all the following lines if we did not end up at the beginning of the reused lines.
+	if (line_begin != reuse_value_offset)
+		reuse_line = (int)lines.size();
+
+	// Replace the formatted range of lines, and their lines in the text elements.
+	int text_lines_begin = 0, selected_text_lines_begin = 0;
+	for (int i = 0; i < first_line; i++)
+	{
+		text_lines_begin += lines[i].num_text_lines;
+		selected_text_lines_begin += lines[i].num_selected_text_lines;
+	}
+	int text_lines_end = text_lines_begin, selected_text_lines_end = selected_text_lines_begin;
+	for (int i = first_line; i < reuse_line; i++)
+	{
+		text_lines_end += lines[i].num_text_lines;
+		selected_text_lines_end += lines[i].num_selected_text_lines;
+	}
+
+	const int num_new_text_lines = (int)new_text_lines.size();
+	const int num_new_selected_text_lines = (int)new_selected_text_lines.size();
+	text_element->ReplaceLines(text_lines_begin, text_lines_end, std::move(new_text_lines), new_text_line_positions);
+	selected_text_element->ReplaceLines(selected_text_lines_begin, selected_text_lines_end, std::move(new_selected_text_lines),
+		new_selected_text_line_positions);
+
+	// Move the reused lines to their new vertical position.
+	const float reused_lines_offset = float(first_line + (int)new_lines.size() - reuse_line) * line_height;
+	if (reused_lines_offset != 0.f)
+	{
+		text_element->TranslateLines(text_lines_begin + num_new_text_lines, Vector2f(0, reused_lines_offset));
+		selected_text_element->TranslateLines(selected_text_lines_begin + num_new_selected_text_lines, Vector2f(0, reused_lines_offset));
+	}
+
+	lines.erase(lines.begin() + first_line, lines.begin() + reuse_line);
+	lines.insert(lines.begin() + first_line, new_lines.begin(), new_lines.end());
 
-	} while (!last_line && content_area.y <= height_constraint + OVERFLOW_TOLERANCE);
+	if (available_width > 0.f)
+	{
+		// Grow the content area width-wise to the longest line, and push the height out.
+		for (const Line& line : lines)
+			content_area.x = Math::Max(content_area.x, line.width + cursor_size.x);
+		content_area.y = float(lines.size()) * line_height;
+	}
 
 	// Clamp the cursor to a valid range.
 	absolute_cursor_index = Math::Min(absolute_cursor_index, (int)GetValue().size());
@@ -1412,9 +1564,56 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 		parent->SetProperty(PropertyId::Clip, Property(ink_overflow ? Style::Clip::Type::Always : Style::Clip::Type::Auto));
 	}
 
+	// Store the current state so that the next formatting can determine which lines to reuse.
+	state.valid = formatting_complete;
+	state.font_handle = font_handle;
+	state.available_width = available_width;
+	state.cursor_width = cursor_size.x;
+	state.line_height = line_height;
+	state.selection_begin = selection_begin_index;
+	state.selection_end = selection_begin_index + selection_length;
+	state.composition_begin = ime_composition_begin_index;
+	state.composition_end = ime_composition_end_index;
+	state.changed_begin = INT_MAX;
+	state.changed_end = 0;
+	state.changed_size_delta = 0;
+
 	return content_area;
 }
 
+void WidgetTextInput::RecordValueChange(const String& new_value)
+{
+	const String& value = GetValue();
+	const size_t common_size = Math::Min(value.size(), new_value.size());
+
+	// Everything between the common prefix and suffix of the two values is considered changed.
+	const size_t prefix_size = size_t(std::mismatch(value.begin(), value.begin() + common_size, new_value.begin()).first - value.begin());
+	const size_t suffix_size =
+		size_t(std::mismatch(value.rbegin(), value.rbegin() + (common_size - prefix_size), new_value.rbegin()).first - value.rbegin());
+
+	if (prefix_size == value.size() && prefix_size == new_value.size())
+		return;
+
+	const int change_begin = (int)prefix_size;
+	const int change_end = int(value.size() - suffix_size);
+	const int size_delta = int(new_value.size()) - int(value.size());
+
+	FormattingState& state = formatting_state;
+	if (state.changed_begin == INT_MAX)
+	{
+		state.changed_begin = change_begin;
+		state.changed_end = change_end;
+		state.changed_size_delta = size_delta;
+	}
+	else
+	{
+		// Merge with the changes since the last formatting. The change end index refers to the value after those changes, so convert it back.
+		state.changed_begin = Math::Min(state.changed_begin, change_begin);
+		state.changed_end = Math::Max(state.changed_end, change_end - state.changed_size_delta);
+		state.changed_size_delta += size_delta;
+	}
+}
+
 void WidgetTextInput::GenerateCursor()
 {
 	cursor_size.x = Math::Round(ElementUtilities::GetDensityIndependentPixelRatio(text_element));
@@ -1436,6 +1635,7 @@ void WidgetTextInput::GenerateCursor()
 void WidgetTextInput::ForceFormattingOnNextLayout()
 {
 	force_formatting_on_next_layout = true;
+	formatting_state.valid = false;
 }
 
 void WidgetTextInput::UpdateCursorPosition(bool update_ideal_cursor_position)
@@ -33,6 +33,7 @@
 #include "../../../Include/RmlUi/Core/Geometry.h"
 #include "../../../Include/RmlUi/Core/Vertex.h"
 #include <float.h>
+#include <limits.h>
 
 namespace Rml {
 
@@ -160,6 +161,26 @@ private:
 		int size;
 		// The length of the editable characters on the line (excluding any trailing endline).
 		int editable_length;
+		// The width of the contents of the line.
+		float width;
+		// The number of lines added to the text element and to the selected text element to render this line.
+		int num_text_lines;
+		int num_selected_text_lines;
+	};
+
+	// The state of the most recent text formatting, used to determine which lines need to be formatted again.
+	struct FormattingState {
+		// True if the lines and their text element lines can be reused for the next formatting.
+		bool valid = false;
+		// The parameters that affect the layout of all lines.
+		FontFaceHandle font_handle = 0;
+		float available_width = 0, cursor_width = 0, line_height = 0;
+		// The selection and IME composition ranges during the formatting.
+		int selection_begin = 0, selection_end = 0;
+		int composition_begin = 0, composition_end = 0;
+		// The range of the value changed since the formatting. The begin and end indices refer to the formatted value, any text after the end
+		// index has been moved by the size delta. A begin index of INT_MAX means that there are no changes.
+		int changed_begin = INT_MAX, changed_end = 0, changed_size_delta = 0;
 	};
 
 	/// Returns the displayed value of the text field.
@@ -209,7 +230,10 @@ private:
 	/// Formats the input element's text field.
 	/// @param[in] height_constraint Abort formatting when the formatted size grows larger than this height.
 	/// @return The content area of the element.
+	/// @note Only the paragraphs affected by changes to the value, selection, and IME composition since the previous formatting are laid out again.
 	Vector2f FormatText(float height_constraint = FLT_MAX);
+	/// Records the range of the displayed value that differs between the current and the new value, to be reformatted on the next formatting.
+	void RecordValueChange(const String& new_value);
 
 	/// Updates the position to render the cursor.
 	/// @param[in] update_ideal_cursor_position Generally should be true on horizontal movement and false on vertical movement.
@@ -263,6 +287,8 @@ private:
 	using LineList = Vector<Line>;
 	LineList lines;
 
+	FormattingState formatting_state;
+
 	// Length in number of characters.
 	int max_length;
 
@@ -37,14 +37,7 @@ Event::Event() {}
 Event::Event(Element* _target_element, EventId id, const String& type, const Dictionary& _parameters, bool interruptible) :
 	parameters(_parameters), target_element(_target_element), type(type), id(id), interruptible(interruptible)
 {
-	const Variant* mouse_x = GetIf(parameters, "mouse_x");
-	const Variant* mouse_y = GetIf(parameters, "mouse_y");
-	if (mouse_x && mouse_y)
-	{
-		has_mouse_position = true;
-		mouse_x->GetInto(mouse_screen_position.x);
-		mouse_y->GetInto(mouse_screen_position.y);
-	}
+	InitializeMousePosition();
 }
 
 Event::~Event() {}
@@ -148,6 +141,36 @@ EventId Event::GetId() const
 	return id;
 }
 
+void Event::Reset(Element* _target_element, EventId _id, const String& _type, const Dictionary& _parameters, bool _interruptible)
+{
+	// Assign the members in place, so that the parameters and type can reuse their existing storage.
+	parameters = _parameters;
+	target_element = _target_element;
+	current_element = nullptr;
+	type = _type;
+	id = _id;
+	interruptible = _interruptible;
+	interrupted = false;
+	interrupted_immediate = false;
+	has_mouse_position = false;
+	mouse_screen_position = Vector2f(0, 0);
+	phase = EventPhase::None;
+
+	InitializeMousePosition();
+}
+
+void Event::InitializeMousePosition()
+{
+	const Variant* mouse_x = GetIf(parameters, "mouse_x");
+	const Variant* mouse_y = GetIf(parameters, "mouse_y");
+	if (mouse_x && mouse_y)
+	{
+		has_mouse_position = true;
+		mouse_x->GetInto(mouse_screen_position.x);
+		mouse_y->GetInto(mouse_screen_position.y);
+	}
+}
+
 void Event::ProjectMouse(Element* element)
 {
 	if (!element)
@@ -31,7 +31,9 @@
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "ControlledLifetimeResource.h"
 #include "EventSpecification.h"
+#include "PooledContainer.h"
 #include <algorithm>
 #include <limits>
 
@@ -107,8 +109,8 @@ void EventDispatcher::DetachAllEvents()
     They are stored in observer pointers, so that we can safely check if they have been destroyed since the previous listener execution.
 */
 struct CollectedListener {
-	CollectedListener(Element* _element, EventListener* _listener, int dom_distance_from_target, bool in_capture_phase) :
-		element(_element->GetObserverPtr()), listener(_listener->GetObserverPtr())
+	CollectedListener(Element* _element, EventListener* _listener, int dom_distance_from_target, bool in_capture_phase, int order) :
+		order(order), element(_element->GetObserverPtr()), listener(_listener->GetObserverPtr())
 	{
 		sort = dom_distance_from_target * (in_capture_phase ? -1 : 1);
 	}
@@ -116,6 +118,8 @@ struct CollectedListener {
 	// The sort value is determined by the distance of the element to the target element in the DOM.
 	// Capture phase is given negative values.
 	int sort = 0;
+	// The order in which the listener was collected, used to keep the order of the listeners in a given element.
+	int order = 0;
 
 	ObserverPtr<Element> element;
 	ObserverPtr<EventListener> listener;
@@ -123,17 +127,37 @@ struct CollectedListener {
 	// Default actions are returned by EventPhase::None.
 	EventPhase GetPhase() const { return sort < 0 ? EventPhase::Capture : (sort == 0 ? EventPhase::Target : EventPhase::Bubble); }
 
-	bool operator<(const CollectedListener& other) const { return sort < other.sort; }
+	bool operator<(const CollectedListener& other) const { return std::tie(sort, order) < std::tie(other.sort, other.order); }
 };
 
+struct EventDispatcherData {
+	// Reusable containers for collecting the listeners and default action elements during dispatch.
+	Vector<Vector<CollectedListener>> listener_lists;
+	Vector<Vector<ObserverPtr<Element>>> element_lists;
+};
+
+static ControlledLifetimeResource<EventDispatcherData> event_dispatcher_data;
+
+void EventDispatcher::Initialize()
+{
+	event_dispatcher_data.Initialize();
+}
+
+void EventDispatcher::Shutdown()
+{
+	event_dispatcher_data.Shutdown();
+}
+
 bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, const String& type, const Dictionary& parameters,
 	const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
 {
 	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture),
 		"We assume here that the default action phases cannot include capture phase.");
 
-	Vector<CollectedListener> listeners;
-	Vector<ObserverPtr<Element>> default_action_elements;
+	PooledContainer<Vector<CollectedListener>> pooled_listeners(event_dispatcher_data->listener_lists);
+	PooledContainer<Vector<ObserverPtr<Element>>> pooled_default_action_elements(event_dispatcher_data->element_lists);
+	Vector<CollectedListener>& listeners = *pooled_listeners;
+	Vector<ObserverPtr<Element>>& default_action_elements = *pooled_default_action_elements;
 
 	const EventPhase phases_to_execute = EventPhase((int)EventPhase::Capture | (int)EventPhase::Target | (bubbles ? (int)EventPhase::Bubble : 0));
 
@@ -162,8 +186,9 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 	if (listeners.empty() && default_action_elements.empty())
 		return true;
 
-	// Use stable_sort so that the order of the listeners in a given element is maintained.
-	std::stable_sort(listeners.begin(), listeners.end());
+	// The collection order breaks ties so that the order of the listeners in a given element is maintained. Unlike stable_sort, this
+	// doesn't need to allocate a temporary buffer.
+	std::sort(listeners.begin(), listeners.end());
 
 	// Instance event
 	EventPtr event = Factory::InstanceEvent(target_element, id, type, parameters, interruptible);
@@ -232,7 +257,7 @@ void EventDispatcher::CollectListeners(int dom_distance_from_target, const Event
 		if ((int)event_executes_in_phases & (int)EventPhase::Target)
 		{
 			for (auto it = begin; it != end; ++it)
-				collect_listeners.emplace_back(element, it->listener, dom_distance_from_target, false);
+				collect_listeners.emplace_back(element, it->listener, dom_distance_from_target, false, (int)collect_listeners.size());
 		}
 	}
 	else
@@ -243,7 +268,7 @@ void EventDispatcher::CollectListeners(int dom_distance_from_target, const Event
 			// Listeners will either attach to capture or bubble phase, make sure the event can execute in the same phase.
 			const EventPhase listener_executes_in_phase = (it->in_capture_phase ? EventPhase::Capture : EventPhase::Bubble);
 			if ((int)event_executes_in_phases & (int)listener_executes_in_phase)
-				collect_listeners.emplace_back(element, it->listener, dom_distance_from_target, it->in_capture_phase);
+				collect_listeners.emplace_back(element, it->listener, dom_distance_from_target, it->in_capture_phase, (int)collect_listeners.size());
 		}
 	}
 }
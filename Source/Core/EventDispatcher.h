@@ -57,6 +57,9 @@ struct EventListenerEntry {
 
 class EventDispatcher {
 public:
+	static void Initialize();
+	static void Shutdown();
+
 	/// Constructor
 	/// @param element Element this dispatcher acts on
 	EventDispatcher(Element* element);
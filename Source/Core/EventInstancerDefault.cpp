@@ -33,16 +33,28 @@ namespace Rml {
 
 EventInstancerDefault::EventInstancerDefault() {}
 
-EventInstancerDefault::~EventInstancerDefault() {}
+EventInstancerDefault::~EventInstancerDefault()
+{
+	for (Event* event : released_events)
+		delete event;
+}
 
 EventPtr EventInstancerDefault::InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible)
 {
+	if (!released_events.empty())
+	{
+		Event* event = released_events.back();
+		released_events.pop_back();
+		event->Reset(target, id, type, parameters, interruptible);
+		return EventPtr(event);
+	}
+
 	return EventPtr(new Event(target, id, type, parameters, interruptible));
 }
 
 void EventInstancerDefault::ReleaseEvent(Event* event)
 {
-	delete event;
+	released_events.push_back(event);
 }
 
 void EventInstancerDefault::Release()
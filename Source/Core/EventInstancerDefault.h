@@ -59,6 +59,10 @@ public:
 
 	/// Releases this event instancer.
 	void Release() override;
+
+private:
+	// Released events kept for reuse, so that dispatching events does not allocate them in steady state.
+	Vector<Event*> released_events;
 };
 
 } // namespace Rml
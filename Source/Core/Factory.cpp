@@ -76,6 +76,7 @@
 #include "StreamFile.h"
 #include "StyleSheetFactory.h"
 #include "TemplateCache.h"
+#include "XMLFragment.h"
 #include "XMLNodeHandlerBody.h"
 #include "XMLNodeHandlerDefault.h"
 #include "XMLNodeHandlerHead.h"
@@ -166,8 +167,17 @@ struct FactoryData {
 	UnorderedMap<String, DataControllerInstancer*> data_controller_instancers;
 	SmallUnorderedMap<String, DataViewInstancer*> structural_data_view_instancers;
 	StringList structural_data_view_attribute_names;
+
+	// Pre-parsed RML fragments, by their source.
+	UnorderedMap<String, SharedPtr<XMLFragment>> xml_fragments;
+	size_t xml_fragments_source_size = 0;
 };
 
+// Sources larger than this are parsed directly, instead of being cached as a pre-parsed fragment.
+static constexpr size_t MaxFragmentSourceSize = 16 * 1024;
+// The fragment cache is cleared when the total size of the cached sources exceeds this limit.
+static constexpr size_t MaxFragmentCacheSourceSize = 1024 * 1024;
+
 static ControlledLifetimeResource<FactoryData> factory_data;
 
 static ContextInstancer* context_instancer = nullptr;
@@ -337,12 +347,28 @@ ElementInstancer* Factory::GetElementInstancer(const String& tag)
 	return instancer_iterator->second;
 }
 
+static bool IsDefaultElementInstancer(const ElementInstancer* instancer)
+{
+	const DefaultInstancers& d = factory_data->default_instancers;
+	const ElementInstancer* default_instancers[] = {&d.element_default, &d.element_text, &d.element_img, &d.element_handle, &d.element_body,
+		&d.form, &d.input, &d.select, &d.element_label, &d.textarea, &d.selection, &d.tabset, &d.progress};
+	return std::find(std::begin(default_instancers), std::end(default_instancers), instancer) != std::end(default_instancers);
+}
+
 ElementPtr Factory::InstanceElement(Element* parent, const String& instancer_name, const String& tag, const XMLAttributes& attributes)
 {
 	if (ElementInstancer* instancer = GetElementInstancer(instancer_name))
 	{
 		if (ElementPtr element = instancer->InstanceElement(parent, tag, attributes))
 		{
+			// Custom elements may rely on OnUpdate() being called every update, thus visit them during every update loop unless they have
+			// specified otherwise. The default elements enable this themselves when needed.
+			if (!element->needs_update_explicit && !IsDefaultElementInstancer(instancer))
+			{
+				element->needs_update = true;
+				element->DirtyUpdate();
+			}
+
 			element->SetInstancer(instancer);
 			element->SetAttributes(attributes);
 
@@ -395,17 +421,52 @@ bool Factory::InstanceElementText(Element* parent, const String& in_text)
 	if (parse_as_rml)
 	{
 		RMLUI_ZoneScopedNC("InstanceStream", 0xDC143C);
-		auto stream = MakeUnique<StreamMemory>(text.size() + 32);
 		Context* context = parent->GetContext();
-		String tag = context ? context->GetDocumentsBaseTag() : "body";
-		String open_tag = "<" + tag + ">";
-		String close_tag = "</" + tag + ">";
-		stream->Write(open_tag.c_str(), open_tag.size());
-		stream->Write(text);
-		stream->Write(close_tag.c_str(), close_tag.size());
-		stream->Seek(0, SEEK_SET);
-
-		InstanceElementStream(parent, stream.get());
+		const String tag = context ? context->GetDocumentsBaseTag() : "body";
+
+		String source;
+		source.reserve(text.size() + 2 * tag.size() + 5);
+		source += '<';
+		source += tag;
+		source += '>';
+		source += text;
+		source += "</";
+		source += tag;
+		source += '>';
+
+		// Identical contents are often instanced repeatedly, such as the rows of 'data-for' views, so keep them pre-parsed.
+		// The fragment is held locally, as the cache may be modified while instancing its contents.
+		SharedPtr<XMLFragment> fragment;
+		const bool use_fragment_cache = (source.size() <= MaxFragmentSourceSize);
+		if (use_fragment_cache)
+		{
+			auto it = factory_data->xml_fragments.find(source);
+			if (it != factory_data->xml_fragments.end())
+				fragment = it->second;
+		}
+
+		if (fragment && fragment->IsWellFormed())
+		{
+			fragment->Instance(parent);
+		}
+		else if (fragment || !use_fragment_cache)
+		{
+			StreamMemory stream(reinterpret_cast<const byte*>(source.data()), source.size());
+			InstanceElementStream(parent, &stream);
+		}
+		else
+		{
+			fragment = MakeShared<XMLFragment>();
+			fragment->Parse(parent, source);
+
+			factory_data->xml_fragments_source_size += source.size();
+			if (factory_data->xml_fragments_source_size > MaxFragmentCacheSourceSize)
+			{
+				factory_data->xml_fragments.clear();
+				factory_data->xml_fragments_source_size = source.size();
+			}
+			factory_data->xml_fragments.emplace(std::move(source), std::move(fragment));
+		}
 	}
 	else
 	{
@@ -592,7 +653,13 @@ void Factory::RegisterDataViewInstancer(DataViewInstancer* instancer, const Stri
 	{
 		inserted = factory_data->structural_data_view_instancers.emplace(name, instancer).second;
 		if (inserted)
+		{
 			factory_data->structural_data_view_attribute_names.push_back(String("data-") + name);
+
+			// Pre-parsed fragments need to submit the inner RML of the new view as data.
+			factory_data->xml_fragments.clear();
+			factory_data->xml_fragments_source_size = 0;
+		}
 	}
 	else
 	{
@@ -30,27 +30,33 @@
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
 #include "FontFaceHandleDefault.h"
 #include "FontProvider.h"
+#include "FontRunCache.h"
 
 namespace Rml {
 
 void FontEngineInterfaceDefault::Initialize()
 {
 	FontProvider::Initialise();
+	FontRunCache::Initialize();
 }
 
 void FontEngineInterfaceDefault::Shutdown()
 {
+	FontRunCache::Shutdown();
 	FontProvider::Shutdown();
 }
 
 bool FontEngineInterfaceDefault::LoadFontFace(const String& file_name, int face_index, bool fallback_face, Style::FontWeight weight)
 {
+	// New fallback faces may provide glyphs for characters missing from the cached runs.
+	FontRunCache::Clear();
 	return FontProvider::LoadFontFace(file_name, face_index, fallback_face, weight);
 }
 
 bool FontEngineInterfaceDefault::LoadFontFace(Span<const byte> data, int face_index, const String& font_family, Style::FontStyle style, Style::FontWeight weight,
 	bool fallback_face)
 {
+	FontRunCache::Clear();
 	return FontProvider::LoadFontFace(data, face_index, font_family, style, weight, fallback_face);
 }
 
@@ -88,14 +94,9 @@ int FontEngineInterfaceDefault::GenerateString(RenderManager& render_manager, Fo
 		(int)font_effects_handle);
 }
 
-int FontEngineInterfaceDefault::GetVersion(FontFaceHandle handle)
-{
-	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
-	return handle_default->GetVersion();
-}
-
 void FontEngineInterfaceDefault::ReleaseFontResources()
 {
+	FontRunCache::Clear();
 	FontProvider::ReleaseFontResources();
 }
 
@@ -66,9 +66,6 @@ public:
 		Vector2f position, ColourbPremultiplied colour, float opacity, const TextShapingContext& text_shaping_context,
 		TexturedMeshList& mesh_list) override;
 
-	/// Returns the current version of the font face.
-	int GetVersion(FontFaceHandle handle) override;
-
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources() override;
 };
@@ -27,11 +27,12 @@
  */
 
 #include "FontFaceHandleDefault.h"
+#include "../../../Include/RmlUi/Core/MeshUtilities.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
-#include "../TextureLayout.h"
 #include "FontFaceLayer.h"
 #include "FontProvider.h"
+#include "FontRunCache.h"
 #include "FreeTypeInterface.h"
 #include <algorithm>
 #include <numeric>
@@ -40,6 +41,10 @@ namespace Rml {
 
 static constexpr char32_t KerningCache_AsciiSubsetBegin = 32;
 static constexpr char32_t KerningCache_AsciiSubsetLast = 126;
+static constexpr int KerningCache_AsciiSubsetSize = int(KerningCache_AsciiSubsetLast - KerningCache_AsciiSubsetBegin + 1);
+
+// Code points below this value use the glyph table, covering the Basic Latin, Latin-1 Supplement, and Latin Extended-A and -B blocks.
+static constexpr char32_t GlyphTable_End = 0x250;
 
 FontFaceHandleDefault::FontFaceHandleDefault()
 {
@@ -63,8 +68,13 @@ bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_siz
 	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs))
 		return false;
 
+	glyph_table.assign(GlyphTable_End, nullptr);
+	for (const auto& pair : glyphs)
+		OnGlyphInserted(pair.first);
+	UpdateGlyphTable();
+
 	has_kerning = FreeType::HasKerning(ft_face);
-	FillKerningPairCache();
+	FillKerningPairTable();
 
 	// Generate the default layer and layer configuration.
 	base_layer = GetOrCreateLayer(nullptr);
@@ -173,38 +183,34 @@ int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font
 	return (int)(layer_configurations.size() - 1);
 }
 
-bool FontFaceHandleDefault::GenerateLayerTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect,
-	int texture_id, int handle_version) const
-{
-	if (handle_version != version)
-	{
-		RMLUI_ERRORMSG("While generating font layer texture: Handle version mismatch in texture vs font-face.");
-		return false;
-	}
-
-	auto it = std::find_if(layers.begin(), layers.end(), [font_effect](const EffectLayerPair& pair) { return pair.font_effect == font_effect; });
-
-	if (it == layers.end())
-	{
-		RMLUI_ERRORMSG("While generating font layer texture: Layer id not found.");
-		return false;
-	}
-
-	return it->layer->GenerateTexture(texture_data, texture_dimensions, texture_id, glyphs);
-}
-
 int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, TexturedMeshList& mesh_list, StringView string, const Vector2f position,
 	const ColourbPremultiplied colour, const float opacity, const float letter_spacing, const int layer_configuration_index)
 {
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int)layer_configurations.size());
 
-	int geometry_index = 0;
-	int line_width = 0;
-	bool has_set_size = false;
+	const bool use_run_cache = FontRunCache::IsCacheable(string);
+	const FontRun* run = (use_run_cache ? FontRunCache::Find(this, layer_configuration_index, letter_spacing, string) : nullptr);
+
+	// Make sure all the glyphs in the string are part of the layers before generating any geometry.
+	if (!run)
+	{
+		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+		{
+			Character character = *it_string;
+			GetOrAppendGlyph(character);
+		}
+	}
 
 	UpdateLayersOnDirty();
 
+	FontRun new_run;
+	if (!run)
+	{
+		new_run = GenerateRun(string, letter_spacing, layer_configuration_index);
+		run = &new_run;
+	}
+
 	// Fetch the requested configuration and generate the geometry for each one.
 	const LayerConfiguration& layer_configuration = layer_configurations[layer_configuration_index];
 
@@ -212,9 +218,37 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 	const int num_geometries = std::accumulate(layer_configuration.begin(), layer_configuration.end(), 0,
 		[](int sum, const FontFaceLayer* layer) { return sum + layer->GetNumTextures(); });
 
+	if (!mesh_list.empty() && (int)mesh_list.size() != num_geometries)
+	{
+		// The mesh list contains geometry from previous strings, and the layers have since gained new textures. Move
+		// each existing mesh to the new position of its texture. Layers may share textures, so match them in order.
+		TexturedMeshList previous_mesh_list = std::move(mesh_list);
+		mesh_list.clear();
+		mesh_list.resize(num_geometries);
+
+		int mesh_index = 0;
+		for (FontFaceLayer* layer : layer_configuration)
+		{
+			for (int tex_index = 0; tex_index < layer->GetNumTextures(); ++tex_index, ++mesh_index)
+			{
+				const Texture texture = layer->GetTexture(render_manager, tex_index);
+				auto it = std::find_if(previous_mesh_list.begin(), previous_mesh_list.end(),
+					[&texture](const TexturedMesh& previous_mesh) { return previous_mesh.texture == texture; });
+				if (it != previous_mesh_list.end())
+				{
+					mesh_list[mesh_index] = std::move(*it);
+					it->texture = {};
+				}
+			}
+		}
+	}
+
 	mesh_list.resize(num_geometries);
 
-	for (size_t layer_index = 0; layer_index < layer_configuration.size(); ++layer_index)
+	int geometry_index = 0;
+	auto it_quad = run->quads.begin();
+
+	for (int layer_index = 0; layer_index < (int)layer_configuration.size(); ++layer_index)
 	{
 		FontFaceLayer* layer = layer_configuration[layer_index];
 
@@ -230,9 +264,6 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 
 		RMLUI_ASSERT(geometry_index + num_textures <= (int)mesh_list.size());
 
-		line_width = 0;
-		Character prior_character = Character::Null;
-
 		// Set the mesh and textures to the geometries.
 		for (int tex_index = 0; tex_index < num_textures; ++tex_index)
 			mesh_list[geometry_index + tex_index].texture = layer->GetTexture(render_manager, tex_index);
@@ -240,6 +271,52 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 		mesh_list[geometry_index].mesh.indices.reserve(string.size() * 6);
 		mesh_list[geometry_index].mesh.vertices.reserve(string.size() * 4);
 
+		// Generate the geometry for each character in this layer.
+		for (; it_quad != run->quads.end() && it_quad->layer_index == layer_index; ++it_quad)
+		{
+			const FontRunQuad& quad = *it_quad;
+			RMLUI_ASSERT(quad.texture_index < num_textures);
+
+			// Use white vertex colors on RGB glyphs.
+			const ColourbPremultiplied quad_colour = (quad.white_colour ? ColourbPremultiplied(layer_colour.alpha, layer_colour.alpha) : layer_colour);
+
+			MeshUtilities::GenerateQuad(mesh_list[geometry_index + quad.texture_index].mesh,
+				(Vector2f(position.x + quad.cursor, position.y) + quad.origin).Round(), quad.dimensions, quad_colour, quad.texcoords[0],
+				quad.texcoords[1]);
+		}
+
+		geometry_index += num_textures;
+	}
+
+	RMLUI_ASSERT(it_quad == run->quads.end());
+
+	const int width = run->width;
+
+	if (use_run_cache && run == &new_run)
+		FontRunCache::Insert(this, layer_configuration_index, letter_spacing, string, std::move(new_run));
+
+	return width;
+}
+
+FontRun FontFaceHandleDefault::GenerateRun(StringView string, const float letter_spacing, const int layer_configuration_index)
+{
+	const LayerConfiguration& layer_configuration = layer_configurations[layer_configuration_index];
+
+	FontRun run;
+	run.quads.reserve(string.size() * layer_configuration.size());
+
+	int line_width = 0;
+	bool has_set_size = false;
+
+	for (int layer_index = 0; layer_index < (int)layer_configuration.size(); ++layer_index)
+	{
+		const FontFaceLayer* layer = layer_configuration[layer_index];
+		if (layer->GetNumTextures() == 0)
+			continue;
+
+		line_width = 0;
+		Character prior_character = Character::Null;
+
 		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
 		{
 			Character character = *it_string;
@@ -251,51 +328,45 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 			// Adjust the cursor for the kerning between this character and the previous one.
 			line_width += GetKerning(prior_character, character, has_set_size);
 
-			ColourbPremultiplied glyph_color = layer_colour;
-			// Use white vertex colors on RGB glyphs.
-			if (layer == base_layer && glyph->color_format == ColorFormat::RGBA8)
-				glyph_color = ColourbPremultiplied(layer_colour.alpha, layer_colour.alpha);
-
-			layer->GenerateGeometry(&mesh_list[geometry_index], character, Vector2f(position.x + line_width, position.y), glyph_color);
+			if (const FontFaceLayer::TextureBox* box = layer->GetTextureBox(character))
+			{
+				FontRunQuad quad;
+				quad.cursor = line_width;
+				quad.layer_index = layer_index;
+				quad.texture_index = box->texture_index;
+				quad.white_colour = (layer == base_layer && glyph->color_format == ColorFormat::RGBA8);
+				quad.origin = box->origin;
+				quad.dimensions = box->dimensions;
+				quad.texcoords[0] = box->texcoords[0];
+				quad.texcoords[1] = box->texcoords[1];
+				run.quads.push_back(quad);
+			}
 
 			line_width += glyph->advance;
 			line_width += (int)letter_spacing;
 			prior_character = character;
 		}
-
-		geometry_index += num_textures;
 	}
 
-	return Math::Max(line_width, 0);
+	run.width = Math::Max(line_width, 0);
+	return run;
 }
 
 bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
-	bool result = false;
-
-	// If we are dirty, regenerate all the layers and increment the version
-	if (is_layers_dirty && base_layer)
-	{
-		is_layers_dirty = false;
-		++version;
-
-		// Regenerate all the layers.
-		// Note: The layer regeneration needs to happen in the order in which the layers were created,
-		// otherwise we may end up cloning a layer which has not yet been regenerated. This means trouble!
-		for (auto& pair : layers)
-		{
-			GenerateLayer(pair.layer.get());
-		}
+	if (new_glyphs.empty() || !base_layer)
+		return false;
 
-		result = true;
-	}
+	// Add the new glyphs to all the layers. Existing glyphs and their geometry are unaffected, so there is no need to
+	// regenerate any strings.
+	// Note: The layers need to be updated in the order in which they were created, otherwise we may end up cloning
+	// from a layer which has not yet received the new glyphs.
+	for (auto& pair : layers)
+		pair.layer->AddGlyphs(this, new_glyphs);
 
-	return result;
-}
+	new_glyphs.clear();
 
-int FontFaceHandleDefault::GetVersion() const
-{
-	return version;
+	return true;
 }
 
 bool FontFaceHandleDefault::AppendGlyph(Character character)
@@ -304,11 +375,13 @@ bool FontFaceHandleDefault::AppendGlyph(Character character)
 	return result;
 }
 
-void FontFaceHandleDefault::FillKerningPairCache()
+void FontFaceHandleDefault::FillKerningPairTable()
 {
 	if (!has_kerning)
 		return;
 
+	kerning_pair_table.assign(KerningCache_AsciiSubsetSize * KerningCache_AsciiSubsetSize, 0);
+
 	for (char32_t i = KerningCache_AsciiSubsetBegin; i <= KerningCache_AsciiSubsetLast; i++)
 	{
 		for (char32_t j = KerningCache_AsciiSubsetBegin; j <= KerningCache_AsciiSubsetLast; j++)
@@ -317,10 +390,8 @@ void FontFaceHandleDefault::FillKerningPairCache()
 
 			// Fetch the kerning from the font face. Submit zero font size on subsequent iterations for performance reasons.
 			const int kerning = FreeType::GetKerning(ft_face, first_iteration ? metrics.size : 0, Character(i), Character(j));
-			if (kerning != 0)
-			{
-				kerning_pair_cache.emplace(AsciiPair((i << 8) | j), KerningIntType(kerning));
-			}
+			const int index = int(i - KerningCache_AsciiSubsetBegin) * KerningCache_AsciiSubsetSize + int(j - KerningCache_AsciiSubsetBegin);
+			kerning_pair_table[index] = KerningIntType(kerning);
 		}
 	}
 }
@@ -339,14 +410,9 @@ int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs, bool& has_se
 
 	if (lhs_in_cache && rhs_in_cache)
 	{
-		const auto it = kerning_pair_cache.find(AsciiPair((int(lhs) << 8) | int(rhs)));
-
-		if (it != kerning_pair_cache.end())
-		{
-			return it->second;
-		}
-
-		return 0;
+		const int index = int(char32_t(lhs) - KerningCache_AsciiSubsetBegin) * KerningCache_AsciiSubsetSize +
+			int(char32_t(rhs) - KerningCache_AsciiSubsetBegin);
+		return kerning_pair_table[index];
 	}
 
 	// Fetch it from the font face instead.
@@ -358,12 +424,37 @@ int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs, bool& has_se
 	return result;
 }
 
+void FontFaceHandleDefault::OnGlyphInserted(Character character)
+{
+	if (char32_t(character) < GlyphTable_End)
+		glyph_table_characters.push_back(character);
+	glyph_table_dirty = true;
+}
+
+void FontFaceHandleDefault::UpdateGlyphTable()
+{
+	for (Character character : glyph_table_characters)
+	{
+		auto it_glyph = glyphs.find(character);
+		glyph_table[char32_t(character)] = (it_glyph != glyphs.end() ? &it_glyph->second : nullptr);
+	}
+	glyph_table_dirty = false;
+}
+
 const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts)
 {
 	// Don't try to render control characters
 	if ((char32_t)character < (char32_t)' ')
 		return nullptr;
 
+	if ((char32_t)character < GlyphTable_End)
+	{
+		if (glyph_table_dirty)
+			UpdateGlyphTable();
+		if (const FontGlyph* glyph = glyph_table[(char32_t)character])
+			return glyph;
+	}
+
 	auto it_glyph = glyphs.find(character);
 	if (it_glyph == glyphs.end())
 	{
@@ -378,7 +469,8 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 				return nullptr;
 			}
 
-			is_layers_dirty = true;
+			new_glyphs.push_back(character);
+			OnGlyphInserted(character);
 		}
 		else if (look_in_fallback_fonts)
 		{
@@ -396,7 +488,10 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 					auto pair = glyphs.emplace(character, glyph->WeakCopy());
 					it_glyph = pair.first;
 					if (pair.second)
-						is_layers_dirty = true;
+					{
+						new_glyphs.push_back(character);
+						OnGlyphInserted(character);
+					}
 					break;
 				}
 			}
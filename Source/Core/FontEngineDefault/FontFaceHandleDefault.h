@@ -35,6 +35,7 @@
 #include "../../../Include/RmlUi/Core/Geometry.h"
 #include "../../../Include/RmlUi/Core/Texture.h"
 #include "../../../Include/RmlUi/Core/Traits.h"
+#include "FontRunCache.h"
 #include "FontTypes.h"
 
 namespace Rml {
@@ -67,14 +68,6 @@ public:
 	/// @param[in] font_effects The list of font effects to generate the configuration for.
 	/// @return The index to use when generating geometry using this configuration.
 	int GenerateLayerConfiguration(const FontEffectList& font_effects);
-	/// Generates the texture data for a layer (for the texture database).
-	/// @param[out] texture_data The generated texture data.
-	/// @param[out] texture_dimensions The dimensions of the texture.
-	/// @param[in] font_effect The font effect used for the layer.
-	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] handle_version The version of the handle data. Function returns false if out of date.
-	bool GenerateLayerTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id,
-		int handle_version) const;
 
 	/// Generates the geometry required to render a single line of text.
 	/// @param[in] render_manager The render manager responsible for rendering the string.
@@ -89,26 +82,31 @@ public:
 	int GenerateString(RenderManager& render_manager, TexturedMeshList& mesh_list, StringView string, Vector2f position, ColourbPremultiplied colour,
 		float opacity, float letter_spacing, int layer_configuration);
 
-	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
-	int GetVersion() const;
-
 private:
+	// Generate the glyph quads of the string for each layer in the given layer configuration, relative to the string's origin.
+	FontRun GenerateRun(StringView string, float letter_spacing, int layer_configuration_index);
+
 	// Build and append glyph to 'glyphs'
 	bool AppendGlyph(Character character);
 
-	// Build a kerning cache for common characters.
-	void FillKerningPairCache();
+	// Build a kerning table for the ASCII subset of characters.
+	void FillKerningPairTable();
 
 	// Return the kerning for a character pair.
 	int GetKerning(Character lhs, Character rhs, bool& has_set_size) const;
 
+	// Register a character newly inserted into 'glyphs', and mark the glyph table for update.
+	void OnGlyphInserted(Character character);
+	// Look up the glyphs of the glyph table again, after glyphs have been inserted.
+	void UpdateGlyphTable();
+
 	/// Retrieve a glyph from the given code point, building and appending a new glyph if not already built.
 	/// @param[in-out] character  The character, can be changed e.g. to the replacement character if no glyph is found.
 	/// @param[in] look_in_fallback_fonts  Look for the glyph in fallback fonts if not found locally, adding it to our glyphs.
 	/// @return The font glyph for the returned code point.
 	const FontGlyph* GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts = true);
 
-	// Regenerate layers if dirty, such as after adding new glyphs.
+	// Add any new glyphs to the layers.
 	bool UpdateLayersOnDirty();
 
 	// Create a new layer from the given font effect if it does not already exist.
@@ -134,15 +132,20 @@ private:
 	// Each font layer that generated geometry or textures, indexed by the font-effect's fingerprint key.
 	FontLayerCache layer_cache;
 
-	// Pre-cache kerning pairs for some ascii subset of all characters.
-	using AsciiPair = uint16_t;
+	// Direct lookup of the glyphs of the lowest code points, to avoid hashing the most common characters. The entries point into 'glyphs',
+	// whose elements may move when new glyphs are inserted, thus the entries are looked up again when the table is marked as dirty.
+	Vector<const FontGlyph*> glyph_table;
+	Vector<Character> glyph_table_characters;
+	bool glyph_table_dirty = false;
+
+	// Pre-cache kerning pairs for some ascii subset of all characters, indexed by the pair's position in the subset.
 	using KerningIntType = int16_t;
-	using KerningPairs = UnorderedMap<AsciiPair, KerningIntType>;
-	KerningPairs kerning_pair_cache;
+	Vector<KerningIntType> kerning_pair_table;
 
 	bool has_kerning = false;
-	bool is_layers_dirty = false;
-	int version = 0;
+
+	// Glyphs added since the layers were last updated.
+	Vector<Character> new_glyphs;
 
 	// All configurations currently in use on this handle. New configurations will be generated as required.
 	LayerConfigurationList layer_configurations;
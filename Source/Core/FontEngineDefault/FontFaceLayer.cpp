@@ -29,6 +29,7 @@
 #include "FontFaceLayer.h"
 #include "../../../Include/RmlUi/Core/RenderManager.h"
 #include "FontFaceHandleDefault.h"
+#include <algorithm>
 #include <string.h>
 #include <type_traits>
 
@@ -43,209 +44,223 @@ FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colou
 
 FontFaceLayer::~FontFaceLayer() {}
 
-bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
+bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool _clone_glyph_origins)
 {
-	// Clear the old layout if it exists.
-	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
-		texture_layout = TextureLayout{};
-		character_boxes.clear();
-		textures_owned.clear();
-		textures_ptr = &textures_owned;
-	}
+	RMLUI_ASSERTMSG(character_boxes.empty() && textures_owned.empty(), "Layers are only generated once, new glyphs should be added to them instead.");
+
+	clone_layer = clone;
+	clone_glyph_origins = _clone_glyph_origins;
+
+	// Point our textures to the cloned layer's textures.
+	if (clone_layer)
+		textures_ptr = clone_layer->textures_ptr;
 
 	const FontGlyphMap& glyphs = handle->GetGlyphs();
 
-	// Generate the new layout.
-	if (clone)
-	{
-		// Clone the geometry and textures from the clone layer.
-		character_boxes = clone->character_boxes;
+	Vector<Character> characters;
+	characters.reserve(glyphs.size());
+	for (auto& pair : glyphs)
+		characters.push_back(pair.first);
 
-		// Point our textures to the cloned layer's textures.
-		textures_ptr = clone->textures_ptr;
+	character_boxes.reserve(glyphs.size());
 
-		// Request the effect (if we have one) and adjust the origins as appropriate.
-		if (effect && !clone_glyph_origins)
-		{
-			for (auto& pair : glyphs)
-			{
-				Character character = pair.first;
-				const FontGlyph& glyph = pair.second;
+	return GenerateCharacters(glyphs, characters);
+}
 
-				auto it = character_boxes.find(character);
-				if (it == character_boxes.end())
-				{
-					// This can happen if the layers have been dirtied in FontHandleDefault. We will
-					// probably be regenerated soon, just skip the character for now.
-					continue;
-				}
+bool FontFaceLayer::AddGlyphs(const FontFaceHandleDefault* handle, const Vector<Character>& characters)
+{
+	return GenerateCharacters(handle->GetGlyphs(), characters);
+}
+
+bool FontFaceLayer::GenerateCharacters(const FontGlyphMap& glyphs, const Vector<Character>& characters)
+{
+	if (clone_layer)
+	{
+		// Clone the geometry of the new characters from the clone layer, the textures are already shared with it.
+		for (Character character : characters)
+		{
+			auto it_glyph = glyphs.find(character);
+			auto it_clone_box = clone_layer->character_boxes.find(character);
+			if (it_glyph == glyphs.end() || it_clone_box == clone_layer->character_boxes.end() || character_boxes.count(character))
+				continue;
 
-				TextureBox& box = it->second;
+			TextureBox box = it_clone_box->second;
 
+			// Request the effect (if we have one) and adjust the origins as appropriate.
+			if (effect && !clone_glyph_origins)
+			{
 				Vector2i glyph_origin = Vector2i(box.origin);
 				Vector2i glyph_dimensions = Vector2i(box.dimensions);
 
-				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, it_glyph->second))
 					box.origin = Vector2f(glyph_origin);
 				else
 					box.texture_index = -1;
 			}
+
+			character_boxes[character] = box;
 		}
+
+		return true;
 	}
-	else
-	{
-		// Initialise the texture layout for the glyphs.
-		character_boxes.reserve(glyphs.size());
-		for (auto& pair : glyphs)
-		{
-			Character character = pair.first;
-			const FontGlyph& glyph = pair.second;
 
-			Vector2i glyph_origin(0, 0);
-			Vector2i glyph_dimensions = glyph.bitmap_dimensions;
+	struct NewCharacter {
+		Character character;
+		const FontGlyph* glyph;
+		Vector2i dimensions;
+		ColorFormat format;
+	};
+	Vector<NewCharacter> new_characters;
+	new_characters.reserve(characters.size());
+	int square_pixels[2] = {};
+
+	for (Character character : characters)
+	{
+		auto it_glyph = glyphs.find(character);
+		if (it_glyph == glyphs.end() || character_boxes.count(character))
+			continue;
 
-			// Adjust glyph origin / dimensions for the font effect.
-			if (effect)
-			{
-				if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					continue;
-			}
+		const FontGlyph& glyph = it_glyph->second;
 
-			TextureBox box;
-			box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
-			box.dimensions = Vector2f(glyph_dimensions);
+		Vector2i glyph_origin(0, 0);
+		Vector2i glyph_dimensions = glyph.bitmap_dimensions;
 
-			RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
+		// Adjust glyph origin / dimensions for the font effect.
+		if (effect)
+		{
+			if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+				continue;
+		}
 
-			character_boxes[character] = box;
+		TextureBox box;
+		box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
+		box.dimensions = Vector2f(glyph_dimensions);
 
-			// Add the character's dimensions into the texture layout engine.
-			texture_layout.AddRectangle((int)character, glyph_dimensions);
-		}
+		RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
 
-		constexpr int max_texture_dimensions = 1024;
+		// Font effects generate their textures in RGBA, and so do colour glyphs. Only plain coverage glyphs can use single-channel textures.
+		const ColorFormat format = (!effect && glyph.color_format == ColorFormat::A8 ? ColorFormat::A8 : ColorFormat::RGBA8);
 
-		// Generate the texture layout; this will position the glyph rectangles efficiently and
-		// allocate the texture data ready for writing.
-		if (!texture_layout.GenerateLayout(max_texture_dimensions))
-			return false;
+		character_boxes[character] = box;
+		new_characters.push_back(NewCharacter{character, &glyph, glyph_dimensions, format});
+		square_pixels[format == ColorFormat::A8 ? 0 : 1] += (glyph_dimensions.x + 1) * (glyph_dimensions.y + 1);
+	}
 
-		// Iterate over each rectangle in the layout, copying the glyph data into the rectangle as
-		// appropriate and generating geometry.
-		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
-		{
-			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
-			Character character = (Character)rectangle.GetId();
-			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-			TextureBox& box = character_boxes[character];
-
-			// Set the character's texture index.
-			box.texture_index = rectangle.GetTextureIndex();
-
-			// Generate the character's texture coordinates.
-			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
-			box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
-			box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
-			box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
-		}
+	if (new_characters.empty())
+		return true;
 
-		const FontEffect* effect_ptr = effect.get();
-		const int handle_version = handle->GetVersion();
+	constexpr int min_texture_dimensions = 128;
+	constexpr int max_texture_dimensions = 1024;
 
-		// Generate the textures.
-		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+	for (int i = 0; i < 2; i++)
+	{
+		TextureAtlas& texture_atlas = (i == 0 ? alpha_atlas : rgba_atlas).atlas;
+		if (texture_atlas.GetNumPages() == 0 && square_pixels[i] > 0)
 		{
-			const int texture_id = i;
-
-			CallbackTextureFunction texture_callback = [handle, effect_ptr, texture_id, handle_version](
-														   const CallbackTextureInterface& texture_interface) -> bool {
-				Vector2i dimensions;
-				Vector<byte> data;
-				if (!handle->GenerateLayerTexture(data, dimensions, effect_ptr, texture_id, handle_version) || data.empty())
-					return false;
-				if (!texture_interface.GenerateTexture(data, dimensions))
-					return false;
-				return true;
-			};
-
-			static_assert(std::is_nothrow_move_constructible<CallbackTextureSource>::value,
-				"CallbackTextureSource must be nothrow move constructible so that it can be placed in the vector below.");
-
-			textures_owned.emplace_back(std::move(texture_callback));
+			// Make the first texture large enough to fit the current glyphs with some room to spare, later glyphs are usually few.
+			const int texture_dimensions = Math::ToPowerOfTwo(int(Math::SquareRoot(2.f * float(square_pixels[i]))));
+			texture_atlas = TextureAtlas(Math::Clamp(texture_dimensions, min_texture_dimensions, max_texture_dimensions), max_texture_dimensions);
 		}
 	}
 
-	return true;
-}
-
-bool FontFaceLayer::GenerateTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
-{
-	if (texture_id < 0 || texture_id > texture_layout.GetNumTextures())
-		return false;
+	// Placing the tallest glyphs first makes better use of the atlas shelves.
+	std::sort(new_characters.begin(), new_characters.end(),
+		[](const NewCharacter& lhs, const NewCharacter& rhs) { return lhs.dimensions.y > rhs.dimensions.y; });
 
-	// Generate the texture data.
-	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
-	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
+	const int num_textures_before = (int)texture_data.size();
+	Vector<Rectanglei> dirty_regions(num_textures_before, Rectanglei::MakeInvalid());
 
-	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+	// Place each glyph into the texture atlas, copy its glyph data into the texture, and generate its texture coordinates.
+	for (const NewCharacter& new_character : new_characters)
 	{
-		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-		Character character = (Character)rectangle.GetId();
-		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-
-		TextureBox& box = character_boxes[character];
+		TextureBox& box = character_boxes[new_character.character];
+		FormatAtlas& format_atlas = (new_character.format == ColorFormat::A8 ? alpha_atlas : rgba_atlas);
+		const int bytes_per_pixel = (new_character.format == ColorFormat::A8 ? 1 : 4);
 
-		if (box.texture_index != texture_id)
+		Vector2i position;
+		const int page_index = format_atlas.atlas.Place(new_character.dimensions, position);
+		if (page_index < 0)
 			continue;
 
-		auto it = glyphs.find((Character)rectangle.GetId());
-		if (it == glyphs.end())
-			continue;
+		const Vector2i texture_dimensions = format_atlas.atlas.GetPageDimensions(page_index);
+		if (page_index == (int)format_atlas.texture_indices.size())
+		{
+			format_atlas.texture_indices.push_back((int)texture_data.size());
+			texture_data.push_back(TextureData{
+				new_character.format,
+				texture_dimensions,
+				Vector<byte>(size_t(texture_dimensions.x * texture_dimensions.y * bytes_per_pixel), byte(0)),
+			});
+		}
 
-		const FontGlyph& glyph = it->second;
+		const int texture_index = format_atlas.texture_indices[page_index];
+		if (texture_index < num_textures_before)
+		{
+			const Rectanglei glyph_region = Rectanglei::FromPositionSize(position, new_character.dimensions);
+			Rectanglei& dirty_region = dirty_regions[texture_index];
+			dirty_region = (dirty_region.Valid() ? dirty_region.Join(glyph_region) : glyph_region);
+		}
+
+		RMLUI_ASSERT(texture_index < (int)texture_data.size());
+
+		box.texture_index = texture_index;
+		box.texcoords[0].x = float(position.x) / float(texture_dimensions.x);
+		box.texcoords[0].y = float(position.y) / float(texture_dimensions.y);
+		box.texcoords[1].x = float(position.x + new_character.dimensions.x) / float(texture_dimensions.x);
+		box.texcoords[1].y = float(position.y + new_character.dimensions.y) / float(texture_dimensions.y);
+
+		const FontGlyph& glyph = *new_character.glyph;
+		const int texture_stride = texture_dimensions.x * bytes_per_pixel;
+		byte* destination = texture_data[texture_index].data.data() + position.y * texture_stride + position.x * bytes_per_pixel;
 
 		if (effect == nullptr)
 		{
-			// Copy the glyph's bitmap data into its allocated texture.
+			// Copy the glyph's bitmap data into its allocated texture, which uses the same format as the glyph.
 			if (glyph.bitmap_data)
 			{
-				byte* destination = rectangle.GetTextureData();
 				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+				const int num_bytes_per_line = glyph.bitmap_dimensions.x * bytes_per_pixel;
 
 				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
 				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						// We use premultiplied alpha, so copy the alpha into all four channels.
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							for (int c = 0; c < 4; ++c)
-								destination[k * 4 + c] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
+					memcpy(destination, source, num_bytes_per_line);
+					destination += texture_stride;
 					source += num_bytes_per_line;
 				}
 			}
 		}
 		else
 		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
+			effect->GenerateGlyphTexture(destination, new_character.dimensions, texture_stride, glyph);
 		}
 	}
 
+	// Existing textures which received new glyphs are updated on their next use, only the region covering the new glyphs is
+	// uploaded when the render interface supports it. Previously generated geometry refers to the same textures, thus it remains valid.
+	for (int i = 0; i < num_textures_before; ++i)
+	{
+		if (dirty_regions[i].Valid())
+			textures_owned[i].InvalidateRegion(dirty_regions[i]);
+	}
+
+	// Generate the new textures.
+	for (int i = num_textures_before; i < (int)texture_data.size(); ++i)
+	{
+		const int texture_index = i;
+
+		CallbackTextureFunction texture_callback = [this, texture_index](const CallbackTextureInterface& texture_interface) -> bool {
+			const TextureData& data = texture_data[texture_index];
+			if (data.format == ColorFormat::A8)
+				return texture_interface.GenerateAlphaTexture(data.data, data.dimensions);
+			return texture_interface.GenerateTexture(data.data, data.dimensions);
+		};
+
+		static_assert(std::is_nothrow_move_constructible<CallbackTextureSource>::value,
+			"CallbackTextureSource must be nothrow move constructible so that it can be placed in the vector below.");
+
+		textures_owned.emplace_back(std::move(texture_callback));
+	}
+
 	return true;
 }
 
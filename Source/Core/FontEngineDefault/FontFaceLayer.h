@@ -32,8 +32,7 @@
 #include "../../../Include/RmlUi/Core/CallbackTexture.h"
 #include "../../../Include/RmlUi/Core/FontGlyph.h"
 #include "../../../Include/RmlUi/Core/Geometry.h"
-#include "../../../Include/RmlUi/Core/MeshUtilities.h"
-#include "../TextureLayout.h"
+#include "../TextureAtlas.h"
 
 namespace Rml {
 
@@ -52,40 +51,39 @@ public:
 	FontFaceLayer(const SharedPtr<const FontEffect>& _effect);
 	~FontFaceLayer();
 
-	/// Generates or re-generates the character and texture data for the layer.
+	/// Generates the character and texture data for the layer from all the glyphs of its handle.
 	/// @param[in] handle The handle generating this layer.
 	/// @param[in] clone The layer to optionally clone geometry and texture data from.
 	/// @param[in] clone_glyph_origins True to keep the character origins from the cloned layer, false to generate new ones.
 	/// @return True if the layer was generated successfully, false if not.
 	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
 
-	/// Generates the texture data for a layer (for the texture database).
-	/// @param[out] texture_data The generated texture data.
-	/// @param[out] texture_dimensions The dimensions of the texture.
-	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] glyphs The glyphs required by the font face handle.
-	bool GenerateTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs);
-
-	/// Generates the geometry required to render a single character.
-	/// @param[out] mesh_list An array of meshes this layer will write to. It must be at least as big as the number of textures in this layer.
-	/// @param[in] character_code The character to generate geometry for.
-	/// @param[in] position The position of the baseline.
-	/// @param[in] colour The colour of the string.
-	inline void GenerateGeometry(TexturedMesh* mesh_list, const Character character_code, const Vector2f position,
-		const ColourbPremultiplied colour) const
-	{
-		auto it = character_boxes.find(character_code);
-		if (it == character_boxes.end())
-			return;
+	/// Adds new glyphs to the layer. Their textures are packed next to the existing ones, leaving all previously
+	/// generated characters and their texture coordinates untouched.
+	/// @param[in] handle The handle generating this layer.
+	/// @param[in] characters The characters to add, characters already part of the layer are skipped.
+	/// @return True if the glyphs were added successfully, false if not.
+	bool AddGlyphs(const FontFaceHandleDefault* handle, const Vector<Character>& characters);
 
-		const TextureBox& box = it->second;
+	struct TextureBox {
+		// The offset, in pixels, of the baseline from the start of this character's geometry.
+		Vector2f origin;
+		// The width and height, in pixels, of this character's geometry.
+		Vector2f dimensions;
+		// The texture coordinates for the character's geometry.
+		Vector2f texcoords[2];
 
-		if (box.texture_index < 0)
-			return;
+		// The texture this character renders from.
+		int texture_index = -1;
+	};
 
-		// Generate the geometry for the character.
-		Mesh& mesh = mesh_list[box.texture_index].mesh;
-		MeshUtilities::GenerateQuad(mesh, (position + box.origin).Round(), box.dimensions, colour, box.texcoords[0], box.texcoords[1]);
+	/// Returns the box of the given character, or nullptr if the character is not rendered by this layer.
+	inline const TextureBox* GetTextureBox(const Character character_code) const
+	{
+		auto it = character_boxes.find(character_code);
+		if (it == character_boxes.end() || it->second.texture_index < 0)
+			return nullptr;
+		return &it->second;
 	}
 
 	/// Returns the effect used to generate the layer.
@@ -100,27 +98,38 @@ public:
 	ColourbPremultiplied GetColour(float opacity) const;
 
 private:
-	struct TextureBox {
-		// The offset, in pixels, of the baseline from the start of this character's geometry.
-		Vector2f origin;
-		// The width and height, in pixels, of this character's geometry.
-		Vector2f dimensions;
-		// The texture coordinates for the character's geometry.
-		Vector2f texcoords[2];
-
-		// The texture this character renders from.
-		int texture_index = -1;
+	// Glyphs are packed into separate atlases by texture format. Coverage-only glyphs go into single-channel pages, while colour glyphs and
+	// the output of font effects go into RGBA pages.
+	struct FormatAtlas {
+		TextureAtlas atlas;
+		// The texture index of each page in the atlas.
+		Vector<int> texture_indices;
+	};
+	struct TextureData {
+		ColorFormat format;
+		Vector2i dimensions;
+		Vector<byte> data;
 	};
 
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
 	using TextureList = Vector<CallbackTextureSource>;
+	using TextureDataList = Vector<TextureData>;
+
+	// Generates the boxes and texture data of the given characters, and updates the affected textures.
+	bool GenerateCharacters(const FontGlyphMap& glyphs, const Vector<Character>& characters);
 
 	SharedPtr<const FontEffect> effect;
 
+	const FontFaceLayer* clone_layer = nullptr;
+	bool clone_glyph_origins = false;
+
 	TextureList textures_owned;
 	TextureList* textures_ptr = &textures_owned;
 
-	TextureLayout texture_layout;
+	// The texture data is kept around so that new glyphs can be added to existing textures.
+	FormatAtlas alpha_atlas;
+	FormatAtlas rgba_atlas;
+	TextureDataList texture_data;
 	CharacterMap character_boxes;
 	Colourb colour;
 };
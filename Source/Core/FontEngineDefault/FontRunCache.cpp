@@ -0,0 +1,165 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontRunCache.h"
+#include "../../../Include/RmlUi/Core/Utilities.h"
+#include "../ControlledLifetimeResource.h"
+
+namespace Rml {
+
+// Longer strings are rarely repeated verbatim, such as lines of paragraphs or text areas, and are generated without the cache.
+static constexpr size_t max_cached_string_length = 256;
+static constexpr size_t memory_budget = 2 * 1024 * 1024;
+
+struct FontRunEntry {
+	const FontFaceHandleDefault* handle;
+	int layer_configuration;
+	float letter_spacing;
+	String string;
+	size_t hash;
+
+	FontRun run;
+	size_t memory;
+};
+
+using FontRunList = List<FontRunEntry>;
+
+struct FontRunCacheData {
+	// Ordered from the most to the least recently used run.
+	FontRunList runs;
+	// Entries are indexed by the hash of their key, the full key is compared on lookup. In the rare event of a hash collision, the newest
+	// run replaces the older one.
+	UnorderedMap<size_t, FontRunList::iterator> run_map;
+
+	size_t memory = 0;
+	size_t num_hits = 0;
+	size_t num_misses = 0;
+};
+
+static ControlledLifetimeResource<FontRunCacheData> cache_data;
+
+static size_t HashKey(const FontFaceHandleDefault* handle, int layer_configuration, float letter_spacing, StringView string)
+{
+	// FNV-1a, to hash the string without first copying it.
+	uint64_t string_hash = 14695981039346656037ull;
+	for (char c : string)
+		string_hash = (string_hash ^ uint64_t(static_cast<unsigned char>(c))) * 1099511628211ull;
+
+	size_t hash = size_t(string_hash);
+	Utilities::HashCombine(hash, handle);
+	Utilities::HashCombine(hash, layer_configuration);
+	Utilities::HashCombine(hash, letter_spacing);
+	return hash;
+}
+
+static void Erase(FontRunList::iterator it)
+{
+	cache_data->memory -= it->memory;
+	cache_data->run_map.erase(it->hash);
+	cache_data->runs.erase(it);
+}
+
+void FontRunCache::Initialize()
+{
+	cache_data.Initialize();
+}
+
+void FontRunCache::Shutdown()
+{
+	cache_data.Shutdown();
+}
+
+bool FontRunCache::IsCacheable(StringView string)
+{
+	return !string.empty() && string.size() <= max_cached_string_length;
+}
+
+const FontRun* FontRunCache::Find(const FontFaceHandleDefault* handle, int layer_configuration, float letter_spacing, StringView string)
+{
+	const size_t hash = HashKey(handle, layer_configuration, letter_spacing, string);
+
+	auto it_map = cache_data->run_map.find(hash);
+	if (it_map != cache_data->run_map.end())
+	{
+		const FontRunList::iterator it = it_map->second;
+		if (it->handle == handle && it->layer_configuration == layer_configuration && it->letter_spacing == letter_spacing &&
+			StringView(it->string) == string)
+		{
+			cache_data->runs.splice(cache_data->runs.begin(), cache_data->runs, it);
+			cache_data->num_hits += 1;
+			return &it->run;
+		}
+	}
+
+	cache_data->num_misses += 1;
+	return nullptr;
+}
+
+void FontRunCache::Insert(const FontFaceHandleDefault* handle, int layer_configuration, float letter_spacing, StringView string, FontRun&& run)
+{
+	const size_t hash = HashKey(handle, layer_configuration, letter_spacing, string);
+
+	auto it_map = cache_data->run_map.find(hash);
+	if (it_map != cache_data->run_map.end())
+		Erase(it_map->second);
+
+	cache_data->runs.push_front(FontRunEntry{handle, layer_configuration, letter_spacing, String(string), hash, std::move(run), 0});
+
+	FontRunEntry& entry = cache_data->runs.front();
+	entry.memory = sizeof(FontRunEntry) + 2 * sizeof(void*) + sizeof(size_t) + sizeof(FontRunList::iterator) + entry.string.capacity() +
+		entry.run.quads.capacity() * sizeof(FontRunQuad);
+
+	cache_data->run_map[hash] = cache_data->runs.begin();
+	cache_data->memory += entry.memory;
+
+	while (cache_data->memory > memory_budget)
+		Erase(std::prev(cache_data->runs.end()));
+}
+
+void FontRunCache::Clear()
+{
+	cache_data->runs.clear();
+	cache_data->run_map.clear();
+	cache_data->memory = 0;
+}
+
+FontRunCacheStatistics FontRunCache::GetStatistics()
+{
+	FontRunCacheStatistics result;
+	if (!cache_data)
+		return result;
+
+	result.num_runs = (int)cache_data->runs.size();
+	result.memory_bytes = cache_data->memory;
+	result.memory_budget_bytes = memory_budget;
+	result.num_hits = cache_data->num_hits;
+	result.num_misses = cache_data->num_misses;
+	return result;
+}
+
+} // namespace Rml
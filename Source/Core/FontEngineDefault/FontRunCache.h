@@ -0,0 +1,88 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTRUNCACHE_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTRUNCACHE_H
+
+#include "../../../Include/RmlUi/Core/FontRunCache.h"
+#include "../../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class FontFaceHandleDefault;
+
+// A glyph quad of a text run, positioned relative to the origin of the run.
+struct FontRunQuad {
+	// The pen position of the glyph along the baseline, in pixels.
+	int cursor = 0;
+	// The index of the layer in the layer configuration, and of the texture in that layer, that the quad is rendered with.
+	int layer_index = 0;
+	int texture_index = 0;
+	// True for colour glyphs in the base layer, which are rendered with white vertex colours.
+	bool white_colour = false;
+
+	Vector2f origin;
+	Vector2f dimensions;
+	Vector2f texcoords[2];
+};
+
+// The quads of a string for every layer of a layer configuration, ordered by layer.
+struct FontRun {
+	Vector<FontRunQuad> quads;
+	int width = 0;
+};
+
+/**
+    A least recently used cache of text runs, shared between all font face handles of the default font engine.
+
+    The quads of each glyph stay valid for the lifetime of their handle, since glyphs added later are packed around the
+    existing ones. Thus, runs only need to be cleared when the handles are released.
+ */
+class FontRunCache {
+public:
+	static void Initialize();
+	static void Shutdown();
+
+	/// Returns true if runs of the given string should be looked up and stored in the cache.
+	static bool IsCacheable(StringView string);
+
+	/// Returns the cached run, or nullptr if there is no such run. The run is marked as the most recently used one.
+	/// @note The returned run remains valid until the next call to Insert() or Clear().
+	static const FontRun* Find(const FontFaceHandleDefault* handle, int layer_configuration, float letter_spacing, StringView string);
+	/// Adds a run to the cache, then evicts the least recently used runs until the cache is within its memory budget.
+	static void Insert(const FontFaceHandleDefault* handle, int layer_configuration, float letter_spacing, StringView string, FontRun&& run);
+
+	/// Removes all runs, this must be done before any font face handle is released.
+	static void Clear();
+
+	static FontRunCacheStatistics GetStatistics();
+};
+
+} // namespace Rml
+#endif
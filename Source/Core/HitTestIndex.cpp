@@ -0,0 +1,138 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "HitTestIndex.h"
+
+namespace Rml {
+
+// Below this number of items, the items are simply visited in order without building the grid.
+static constexpr int MinGridItems = 32;
+// The maximum number of grid cells along each axis.
+static constexpr int MaxGridCells = 128;
+// Items overlapping more cells than this are placed in the overflow list instead of the grid cells.
+static constexpr int MaxCellsPerItem = 16;
+
+void HitTestIndex::Clear()
+{
+	items.clear();
+	bounds = Rectanglef::MakeInvalid();
+	unbounded = false;
+}
+
+void HitTestIndex::AddItem(Rectanglef item_bounds)
+{
+	items.push_back(item_bounds);
+
+	if (!item_bounds.Valid())
+		unbounded = true;
+	else if (!bounds.Valid())
+		bounds = item_bounds;
+	else
+		bounds = bounds.Join(item_bounds);
+}
+
+void HitTestIndex::Build()
+{
+	overflow_items.clear();
+	cell_offsets.clear();
+	cell_items.clear();
+	grid_columns = 0;
+	grid_rows = 0;
+
+	const int num_items = (int)items.size();
+	if (num_items < MinGridItems || !bounds.Valid())
+		return;
+
+	// Aim for about one cell per item, with the cells following the aspect ratio of the bounds.
+	const Vector2f size = bounds.Size();
+	int columns = 1;
+	int rows = 1;
+	if (size.x > 0.f && size.y > 0.f)
+	{
+		columns = Math::Clamp(int(Math::SquareRoot(float(num_items) * size.x / size.y) + 0.5f), 1, MaxGridCells);
+		rows = Math::Clamp((num_items + columns - 1) / columns, 1, MaxGridCells);
+	}
+	else if (size.x > 0.f)
+		columns = Math::Min(num_items, MaxGridCells);
+	else if (size.y > 0.f)
+		rows = Math::Min(num_items, MaxGridCells);
+
+	grid_origin = bounds.TopLeft();
+	grid_inverse_cell_size = {size.x > 0.f ? float(columns) / size.x : 0.f, size.y > 0.f ? float(rows) / size.y : 0.f};
+	grid_columns = columns;
+	grid_rows = rows;
+
+	// Returns the range of cells overlapped by the item, or false if it should be placed in the overflow list.
+	auto GetCellRange = [this](int item, int& column_begin, int& column_end, int& row_begin, int& row_end) {
+		const Rectanglef& rectangle = items[item];
+		if (!rectangle.Valid())
+			return false;
+
+		column_begin = Math::Min(int((rectangle.Left() - grid_origin.x) * grid_inverse_cell_size.x), grid_columns - 1);
+		column_end = Math::Min(int((rectangle.Right() - grid_origin.x) * grid_inverse_cell_size.x), grid_columns - 1) + 1;
+		row_begin = Math::Min(int((rectangle.Top() - grid_origin.y) * grid_inverse_cell_size.y), grid_rows - 1);
+		row_end = Math::Min(int((rectangle.Bottom() - grid_origin.y) * grid_inverse_cell_size.y), grid_rows - 1) + 1;
+
+		return (column_end - column_begin) * (row_end - row_begin) <= MaxCellsPerItem;
+	};
+
+	// Count the items in each cell, then fill the cells in stacking order.
+	cell_offsets.resize(columns * rows + 1, 0);
+
+	int column_begin, column_end, row_begin, row_end;
+	for (int i = 0; i < num_items; i++)
+	{
+		if (!GetCellRange(i, column_begin, column_end, row_begin, row_end))
+			continue;
+
+		for (int row = row_begin; row < row_end; row++)
+			for (int column = column_begin; column < column_end; column++)
+				cell_offsets[row * columns + column + 1] += 1;
+	}
+
+	for (size_t i = 1; i < cell_offsets.size(); i++)
+		cell_offsets[i] += cell_offsets[i - 1];
+
+	cell_items.resize(cell_offsets.back());
+	Vector<int> cell_cursors(cell_offsets.begin(), cell_offsets.end() - 1);
+
+	for (int i = 0; i < num_items; i++)
+	{
+		if (!GetCellRange(i, column_begin, column_end, row_begin, row_end))
+		{
+			overflow_items.push_back(i);
+			continue;
+		}
+
+		for (int row = row_begin; row < row_end; row++)
+			for (int column = column_begin; column < column_end; column++)
+				cell_items[cell_cursors[row * columns + column]++] = i;
+	}
+}
+
+} // namespace Rml
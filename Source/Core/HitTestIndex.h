@@ -0,0 +1,130 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_HITTESTINDEX_H
+#define RMLUI_CORE_HITTESTINDEX_H
+
+#include "../../Include/RmlUi/Core/Rectangle.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    A spatial index over the children of a local stacking context, used to find the children that may contain a point during hit testing.
+
+    Items are added in stacking order together with their conservative bounds in window coordinates. Unbounded items, such as transformed
+    elements, are always considered candidates. Larger sets of items are bucketed into a uniform grid, so that only the items overlapping the
+    grid cell at the point need to be visited.
+ */
+class HitTestIndex {
+public:
+	// Remove all items, before adding them again.
+	void Clear();
+	// Add the next item in stacking order, using an invalid rectangle for unbounded items.
+	void AddItem(Rectanglef item_bounds);
+	// Build the index from the added items.
+	void Build();
+
+	// Returns true if any of the items are unbounded.
+	bool IsUnbounded() const { return unbounded; }
+	// Returns the union of the bounds of all bounded items, or an invalid rectangle if there are none.
+	Rectanglef GetBounds() const { return bounds; }
+
+	// Visit the indices of the items that may contain the given point, from the top-most to the bottom-most item in stacking order.
+	// Returns the first index for which the predicate returns true, or -1 if there is no such item.
+	template <typename Predicate>
+	int FindLast(Vector2f point, Predicate&& predicate) const;
+
+private:
+	bool MayContain(int item, Vector2f point) const
+	{
+		const Rectanglef& rectangle = items[item];
+		return !rectangle.Valid() || rectangle.Contains(point);
+	}
+
+	Vector<Rectanglef> items;
+	// The union of the bounds of all bounded items.
+	Rectanglef bounds = Rectanglef::MakeInvalid();
+	bool unbounded = false;
+
+	// Items that are not placed in the grid cells, either because they are unbounded or cover many cells. Always visited.
+	Vector<int> overflow_items;
+
+	// The grid cells are stored contiguously, each cell listing the items overlapping it in stacking order. Only used with enough items.
+	Vector2f grid_origin;
+	Vector2f grid_inverse_cell_size;
+	int grid_columns = 0;
+	int grid_rows = 0;
+	Vector<int> cell_offsets;
+	Vector<int> cell_items;
+};
+
+template <typename Predicate>
+int HitTestIndex::FindLast(Vector2f point, Predicate&& predicate) const
+{
+	if (grid_columns == 0)
+	{
+		for (int i = (int)items.size() - 1; i >= 0; --i)
+		{
+			if (MayContain(i, point) && predicate(i))
+				return i;
+		}
+		return -1;
+	}
+
+	const int* cell_begin = nullptr;
+	const int* cell_it = nullptr;
+	if (bounds.Valid() && bounds.Contains(point))
+	{
+		const int column = Math::Min(int((point.x - grid_origin.x) * grid_inverse_cell_size.x), grid_columns - 1);
+		const int row = Math::Min(int((point.y - grid_origin.y) * grid_inverse_cell_size.y), grid_rows - 1);
+		const int cell = row * grid_columns + column;
+		cell_begin = cell_items.data() + cell_offsets[cell];
+		cell_it = cell_items.data() + cell_offsets[cell + 1];
+	}
+
+	// Merge the cell items and the overflow items, both sorted in stacking order, visiting them in reverse.
+	const int* overflow_begin = overflow_items.data();
+	const int* overflow_it = overflow_begin + overflow_items.size();
+	while (cell_it != cell_begin || overflow_it != overflow_begin)
+	{
+		int item;
+		if (overflow_it == overflow_begin || (cell_it != cell_begin && *(cell_it - 1) > *(overflow_it - 1)))
+			item = *(--cell_it);
+		else
+			item = *(--overflow_it);
+
+		if (MayContain(item, point) && predicate(item))
+			return item;
+	}
+
+	return -1;
+}
+
+} // namespace Rml
+#endif
@@ -58,6 +58,8 @@ public:
 
 	// Returns true if this box acts as a containing block for absolutely positioned descendants.
 	bool IsAbsolutePositioningContainingBlock() const { return is_absolute_positioning_containing_block; }
+	// Returns true if any absolutely positioned elements have been added to this box, and not yet formatted.
+	bool HasAbsoluteElements() const { return !absolute_elements.empty(); }
 
 protected:
 	ContainerBox(Type type, Element* element, ContainerBox* parent_container);
@@ -27,11 +27,14 @@
  */
 
 #include "LayoutEngine.h"
+#include "../../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../../Include/RmlUi/Core/Element.h"
+#include "../../../Include/RmlUi/Core/ElementScroll.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "ContainerBox.h"
 #include "FormattingContext.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -56,6 +59,147 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block)
 		// size of each element's scrollable area, we can finally clamp the scroll offset.
 		element->ClampScrollOffsetRecursive();
 	}
+
+	// Ignore any layout dirtied during formatting, formatting should not require re-iteration.
+	ClearDirtyLayout(element);
+}
+
+bool LayoutEngine::FormatDirtyLayoutBoundaries(Element* element)
+{
+	RMLUI_ASSERT(element);
+	if (!element->dirty_child_layout)
+		return true;
+
+	RMLUI_ZoneScoped;
+
+	ElementList boundaries;
+	if (!FindDirtyLayoutBoundaries(element, nullptr, boundaries))
+		return false;
+
+	// Boundaries nested inside other boundaries will be formatted along with their ancestor, so there is no need to format them separately.
+	ElementList outermost_boundaries;
+	for (Element* boundary : boundaries)
+	{
+		bool nested = false;
+		for (Element* ancestor = boundary->GetParentNode(); ancestor && ancestor != element && !nested; ancestor = ancestor->GetParentNode())
+			nested = (std::find(boundaries.begin(), boundaries.end(), ancestor) != boundaries.end());
+		if (!nested)
+			outermost_boundaries.push_back(boundary);
+	}
+
+	for (Element* boundary : outermost_boundaries)
+	{
+		using namespace Style;
+		RMLUI_ZoneScopedN("FormatLayoutBoundary");
+
+		// The boundary keeps its current box, thus we only need an approximate containing block for resolving its properties. Use the box of
+		// the element it was offset from during the last layout, which should be its containing block.
+		Element* offset_parent = boundary->GetOffsetParent();
+		if (!offset_parent)
+			return false;
+
+		const Position position = boundary->GetPosition();
+		const bool absolutely_positioned = (position == Position::Absolute || position == Position::Fixed);
+		Vector2f containing_block = offset_parent->GetBox().GetSize(absolutely_positioned ? BoxArea::Padding : BoxArea::Content);
+		if (!absolutely_positioned)
+		{
+			ElementScroll* element_scroll = offset_parent->GetElementScroll();
+			containing_block.x -= element_scroll->GetScrollbarSize(ElementScroll::VERTICAL);
+			containing_block.y -= element_scroll->GetScrollbarSize(ElementScroll::HORIZONTAL);
+		}
+		containing_block = Math::Max(containing_block, Vector2f(0.f));
+
+		RootBox root(containing_block);
+		const Box box = boundary->GetBox();
+
+		auto layout_box = FormattingContext::FormatIndependent(&root, boundary, &box, FormattingContextType::Block);
+		if (!layout_box)
+		{
+			Log::Message(Log::LT_ERROR, "Error while formatting layout boundary: %s", boundary->GetAddress().c_str());
+			return false;
+		}
+
+		// Absolutely positioned descendants whose containing block is outside the boundary end up in the root box. They must be positioned
+		// by their actual containing block, so fall back to formatting the whole element.
+		if (root.HasAbsoluteElements())
+			return false;
+
+		boundary->ClampScrollOffsetRecursive();
+	}
+
+	ClearDirtyLayout(element);
+
+	return true;
+}
+
+bool LayoutEngine::IsLayoutBoundary(Element* element)
+{
+	using namespace Style;
+	if (element->IsReplaced())
+		return false;
+
+	// Only consider block-level boxes, inline-level boxes may be affected by the baseline of their contents.
+	const ComputedValues& computed = element->GetComputedValues();
+	const Display display = computed.display();
+	if (display != Display::Block && display != Display::FlowRoot && display != Display::Flex)
+		return false;
+
+	// The size of the element must not depend on its contents. Flex items with definite sizes are also covered here, as we do not currently
+	// implement content-based minimum sizes of flex items.
+	if (computed.width().type != Width::Length || computed.height().type != Height::Length)
+		return false;
+
+	// Any overflow of the contents must be caught by the element itself, so that it does not contribute to the overflow of its ancestors.
+	if (computed.overflow_x() == Overflow::Visible || computed.overflow_y() == Overflow::Visible)
+		return false;
+
+	return true;
+}
+
+bool LayoutEngine::FindDirtyLayoutBoundaries(Element* element, Element* boundary, ElementList& boundaries)
+{
+	// Here, 'boundary' is the nearest layout boundary of the element, including the element itself.
+	const int num_dom_children = element->GetNumChildren();
+	const int num_children = element->GetNumChildren(true);
+
+	for (int i = 0; i < num_children; i++)
+	{
+		Element* child = element->GetChild(i);
+		if (!child->dirty_layout && !child->dirty_child_layout)
+			continue;
+
+		// Non-DOM children are formatted by their parent, such as scrollbars, thus they are treated as a dirty layout of the parent itself.
+		const bool dom_child = (i < num_dom_children);
+		if (child->dirty_layout || !dom_child)
+		{
+			// A change to the layout of the child may change its size, so restart from our nearest boundary.
+			if (!boundary)
+				return false;
+			if (boundaries.empty() || boundaries.back() != boundary)
+				boundaries.push_back(boundary);
+		}
+		else if (child->GetDisplay() != Style::Display::None)
+		{
+			if (!FindDirtyLayoutBoundaries(child, IsLayoutBoundary(child) ? child : boundary, boundaries))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void LayoutEngine::ClearDirtyLayout(Element* element)
+{
+	element->dirty_layout = false;
+
+	if (element->dirty_child_layout)
+	{
+		element->dirty_child_layout = false;
+
+		const int num_children = element->GetNumChildren(true);
+		for (int i = 0; i < num_children; i++)
+			ClearDirtyLayout(element->GetChild(i));
+	}
 }
 
 } // namespace Rml
@@ -47,6 +47,18 @@ public:
 	/// @param[in] element The element to lay out.
 	/// @param[in] containing_block The size of the containing block.
 	static void FormatElement(Element* element, Vector2f containing_block);
+
+	/// Formats only the parts of the element's layout which have been dirtied, by restarting formatting from their nearest layout boundaries.
+	/// A layout boundary is an element whose size and formatting cannot affect anything outside of itself.
+	/// @param[in] element The root-level element with dirty descendants, usually a document.
+	/// @return True on success, or false if some dirty layout could not be contained in a layout boundary. In this case, the element should
+	/// be formatted entirely.
+	static bool FormatDirtyLayoutBoundaries(Element* element);
+
+private:
+	static bool IsLayoutBoundary(Element* element);
+	static bool FindDirtyLayoutBoundaries(Element* element, Element* boundary, ElementList& boundaries);
+	static void ClearDirtyLayout(Element* element);
 };
 
 } // namespace Rml
@@ -26,50 +26,43 @@
  *
  */
 
-#ifndef TEXTURELAYOUTROW_H
-#define TEXTURELAYOUTROW_H
+#ifndef RMLUI_CORE_POOLEDCONTAINER_H
+#define RMLUI_CORE_POOLEDCONTAINER_H
 
-#include "TextureLayoutRectangle.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
 
-class TextureLayout;
-
 /**
-    A texture layout row is a single row of rectangles positioned vertically within a texture.
+    A container taken out of a pool of reusable containers for the lifetime of this object, then returned to the pool cleared but with its
+    capacity retained. Used for temporary containers on hot paths such as event dispatch, so that they do not allocate in steady state.
 
-    @author Peter
+    Each container is owned by a single object at a time, thus nested use, such as events dispatched from within event listeners, is safe.
  */
-
-class TextureLayoutRow {
+template <typename T>
+class PooledContainer : NonCopyMoveable {
 public:
-	TextureLayoutRow();
-	~TextureLayoutRow();
-
-	/// Attempts to position unplaced rectangles from the layout into this row.
-	/// @param[in] layout The layout to position rectangles from.
-	/// @param[in] width The maximum width of this row.
-	/// @param[in] y The y-coordinate of this row.
-	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int width, int y);
+	explicit PooledContainer(Vector<T>& pool) : pool(pool)
+	{
+		if (!pool.empty())
+		{
+			container = std::move(pool.back());
+			pool.pop_back();
+		}
+	}
+	~PooledContainer()
+	{
+		container.clear();
+		pool.push_back(std::move(container));
+	}
 
-	/// Assigns allocated texture data to all rectangles in this row.
-	/// @param[in] texture_data The pointer to the beginning of the texture's data.
-	/// @param[in] stride The stride of the texture's surface, in bytes;
-	void Allocate(byte* texture_data, int stride);
-
-	/// Returns the height of the row.
-	/// @return The row's height.
-	int GetHeight() const;
-
-	/// Resets the placed status for all of the rectangles within this row.
-	void Unplace();
+	T& operator*() { return container; }
+	T* operator->() { return &container; }
 
 private:
-	using RectangleList = Vector<TextureLayoutRectangle*>;
-
-	int height;
-	RectangleList rectangles;
+	Vector<T>& pool;
+	T container;
 };
 
 } // namespace Rml
@@ -0,0 +1,170 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "RenderCommandList.h"
+
+namespace Rml {
+
+void RenderCommandList::Clear()
+{
+	commands.clear();
+	draws.clear();
+	composites.clear();
+	scissor_regions.clear();
+	transforms.clear();
+	filters.clear();
+	layer_stack.clear();
+}
+
+void RenderCommandList::EnableScissorRegion(bool enable)
+{
+	commands.push_back(Command{CommandType::EnableScissorRegion, int(enable)});
+}
+
+void RenderCommandList::SetScissorRegion(Rectanglei region)
+{
+	commands.push_back(Command{CommandType::SetScissorRegion, (int)scissor_regions.size()});
+	scissor_regions.push_back(region);
+}
+
+void RenderCommandList::EnableClipMask(bool enable)
+{
+	commands.push_back(Command{CommandType::EnableClipMask, int(enable)});
+}
+
+void RenderCommandList::RenderToClipMask(ClipMaskOperation operation, CompiledGeometryHandle geometry, Vector2f translation)
+{
+	commands.push_back(Command{CommandType::RenderToClipMask, (int)draws.size()});
+	draws.push_back(DrawCommand{geometry, {}, {}, translation, operation});
+}
+
+void RenderCommandList::SetTransform(const Matrix4f* transform)
+{
+	commands.push_back(Command{CommandType::SetTransform, transform ? (int)transforms.size() : -1});
+	if (transform)
+		transforms.push_back(*transform);
+}
+
+void RenderCommandList::RenderGeometry(CompiledGeometryHandle geometry, Vector2f translation, TextureHandle texture)
+{
+	commands.push_back(Command{CommandType::RenderGeometry, (int)draws.size()});
+	draws.push_back(DrawCommand{geometry, texture, {}, translation, {}});
+}
+
+void RenderCommandList::RenderShader(CompiledShaderHandle shader, CompiledGeometryHandle geometry, Vector2f translation, TextureHandle texture)
+{
+	commands.push_back(Command{CommandType::RenderShader, (int)draws.size()});
+	draws.push_back(DrawCommand{geometry, texture, shader, translation, {}});
+}
+
+void RenderCommandList::PushLayer(LayerHandle layer)
+{
+	commands.push_back(Command{CommandType::PushLayer, 0});
+	layer_stack.push_back(layer);
+}
+
+void RenderCommandList::CompositeLayers(LayerHandle source, LayerHandle destination, BlendMode blend_mode, Span<const CompiledFilterHandle> in_filters)
+{
+	commands.push_back(Command{CommandType::CompositeLayers, (int)composites.size()});
+	composites.push_back(CompositeCommand{FindLayer(source), FindLayer(destination), blend_mode, (int)filters.size(), (int)in_filters.size()});
+	filters.insert(filters.end(), in_filters.begin(), in_filters.end());
+}
+
+void RenderCommandList::PopLayer()
+{
+	RMLUI_ASSERT(!layer_stack.empty());
+	commands.push_back(Command{CommandType::PopLayer, 0});
+	layer_stack.pop_back();
+}
+
+int RenderCommandList::FindLayer(LayerHandle layer) const
+{
+	if (!layer)
+		return -1;
+
+	for (int i = (int)layer_stack.size() - 1; i >= 0; i--)
+	{
+		if (layer_stack[i] == layer)
+			return i;
+	}
+
+	RMLUI_ERRORMSG("Recorded layer operation refers to a layer outside the layer stack.");
+	return -1;
+}
+
+void RenderCommandList::Replay(RenderInterface* render_interface) const
+{
+	Vector<LayerHandle> replay_layer_stack;
+
+	auto GetLayer = [&replay_layer_stack](int layer_index) {
+		return layer_index < 0 ? LayerHandle{} : replay_layer_stack[layer_index];
+	};
+
+	for (const Command& command : commands)
+	{
+		switch (command.type)
+		{
+		case CommandType::EnableScissorRegion: render_interface->EnableScissorRegion(command.index != 0); break;
+		case CommandType::SetScissorRegion: render_interface->SetScissorRegion(scissor_regions[command.index]); break;
+		case CommandType::EnableClipMask: render_interface->EnableClipMask(command.index != 0); break;
+		case CommandType::RenderToClipMask:
+		{
+			const DrawCommand& draw = draws[command.index];
+			render_interface->RenderToClipMask(draw.clip_operation, draw.geometry, draw.translation);
+		}
+		break;
+		case CommandType::SetTransform: render_interface->SetTransform(command.index < 0 ? nullptr : &transforms[command.index]); break;
+		case CommandType::RenderGeometry:
+		{
+			const DrawCommand& draw = draws[command.index];
+			render_interface->RenderGeometry(draw.geometry, draw.translation, draw.texture);
+		}
+		break;
+		case CommandType::RenderShader:
+		{
+			const DrawCommand& draw = draws[command.index];
+			render_interface->RenderShader(draw.shader, draw.geometry, draw.translation, draw.texture);
+		}
+		break;
+		case CommandType::PushLayer: replay_layer_stack.push_back(render_interface->PushLayer()); break;
+		case CommandType::CompositeLayers:
+		{
+			const CompositeCommand& composite = composites[command.index];
+			render_interface->CompositeLayers(GetLayer(composite.source_layer), GetLayer(composite.destination_layer), composite.blend_mode,
+				Span<const CompiledFilterHandle>(filters.data() + composite.filters_begin, composite.filters_count));
+		}
+		break;
+		case CommandType::PopLayer:
+			render_interface->PopLayer();
+			replay_layer_stack.pop_back();
+			break;
+		}
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,117 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_RENDERCOMMANDLIST_H
+#define RMLUI_CORE_RENDERCOMMANDLIST_H
+
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    A compact list of commands submitted to the render interface, which can later be replayed verbatim.
+
+    Only state and draw commands are stored, the referenced geometry, texture, shader, and filter handles must outlive
+    the list. Layer handles are stored relative to the layer stack, and resolved again during replay.
+ */
+class RenderCommandList {
+public:
+	void Clear();
+	bool Empty() const { return commands.empty(); }
+
+	void EnableScissorRegion(bool enable);
+	void SetScissorRegion(Rectanglei region);
+
+	void EnableClipMask(bool enable);
+	void RenderToClipMask(ClipMaskOperation operation, CompiledGeometryHandle geometry, Vector2f translation);
+
+	void SetTransform(const Matrix4f* transform);
+
+	void RenderGeometry(CompiledGeometryHandle geometry, Vector2f translation, TextureHandle texture);
+	void RenderShader(CompiledShaderHandle shader, CompiledGeometryHandle geometry, Vector2f translation, TextureHandle texture);
+
+	void PushLayer(LayerHandle layer);
+	void CompositeLayers(LayerHandle source, LayerHandle destination, BlendMode blend_mode, Span<const CompiledFilterHandle> filters);
+	void PopLayer();
+
+	// Submits all the recorded commands to the given render interface, in the order they were recorded.
+	void Replay(RenderInterface* render_interface) const;
+
+private:
+	enum class CommandType : byte {
+		EnableScissorRegion,
+		SetScissorRegion,
+		EnableClipMask,
+		RenderToClipMask,
+		SetTransform,
+		RenderGeometry,
+		RenderShader,
+		PushLayer,
+		CompositeLayers,
+		PopLayer,
+	};
+
+	// The index refers into the payload list of the given command type, or holds the enable flag for toggle commands.
+	struct Command {
+		CommandType type;
+		int index;
+	};
+
+	struct DrawCommand {
+		CompiledGeometryHandle geometry;
+		TextureHandle texture;
+		CompiledShaderHandle shader;
+		Vector2f translation;
+		ClipMaskOperation clip_operation;
+	};
+
+	// Layers are referenced by their position in the layer stack, or -1 for the zero handle.
+	struct CompositeCommand {
+		int source_layer;
+		int destination_layer;
+		BlendMode blend_mode;
+		int filters_begin;
+		int filters_count;
+	};
+
+	int FindLayer(LayerHandle layer) const;
+
+	Vector<Command> commands;
+	Vector<DrawCommand> draws;
+	Vector<CompositeCommand> composites;
+	Vector<Rectanglei> scissor_regions;
+	Vector<Matrix4f> transforms;
+	Vector<CompiledFilterHandle> filters;
+
+	// The layer stack while recording.
+	Vector<LayerHandle> layer_stack;
+};
+
+} // namespace Rml
+#endif
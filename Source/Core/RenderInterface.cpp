@@ -45,6 +45,16 @@ RenderInterface::~RenderInterface()
 		"or nullptr dereference when releasing render resources. Ensure that the render interface is destroyed *after* the call to Rml::Shutdown.");
 }
 
+TextureHandle RenderInterface::GenerateAlphaTexture(Span<const byte> /*source*/, Vector2i /*source_dimensions*/)
+{
+	return TextureHandle{};
+}
+
+bool RenderInterface::UpdateTexture(TextureHandle /*texture*/, Span<const byte> /*source*/, Rectanglei /*region*/)
+{
+	return false;
+}
+
 void RenderInterface::EnableClipMask(bool /*enable*/) {}
 
 void RenderInterface::RenderToClipMask(ClipMaskOperation /*operation*/, CompiledGeometryHandle /*geometry*/, Vector2f /*translation*/) {}
@@ -31,6 +31,7 @@
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "RenderCommandList.h"
 #include "TextureDatabase.h"
 
 namespace Rml {
@@ -45,6 +46,8 @@ RenderManager::RenderManager(RenderInterface* render_interface) : render_interfa
 
 RenderManager::~RenderManager()
 {
+	ReleaseBatchGeometry();
+
 	struct ResourceCount {
 		const char* name;
 		int count;
@@ -78,6 +81,9 @@ void RenderManager::PrepareRender(Vector2i dimensions)
 	RMLUI_ASSERTMSG(render_stack.empty(), "Unbalanced render stack detected, ensure every PushLayer call has a corresponding call to PopLayer.");
 #endif
 
+	FlushBatch();
+	ReleaseBatchGeometry();
+
 	SetViewport(dimensions);
 }
 
@@ -91,6 +97,18 @@ Vector2i RenderManager::GetViewport() const
 	return viewport_dimensions;
 }
 
+void RenderManager::EnableBatching(bool enable)
+{
+	if (!enable)
+		FlushBatch();
+	batching_enabled = enable;
+}
+
+bool RenderManager::IsBatchingEnabled() const
+{
+	return batching_enabled;
+}
+
 Geometry RenderManager::MakeGeometry(Mesh&& mesh)
 {
 	return Geometry(this, InsertGeometry(std::move(mesh)));
@@ -104,11 +122,13 @@ Texture RenderManager::LoadTexture(const String& source, const String& document_
 	else
 		GetSystemInterface()->JoinPath(path, StringUtilities::Replace(document_path, '|', ':'), source);
 
+	resource_generation += 1;
 	return Texture(this, texture_database->file_database.InsertTexture(path));
 }
 
 CallbackTexture RenderManager::MakeCallbackTexture(CallbackTextureFunction callback)
 {
+	resource_generation += 1;
 	return CallbackTexture(this, texture_database->callback_database.CreateTexture(std::move(callback)));
 }
 
@@ -123,14 +143,24 @@ void RenderManager::SetScissorRegion(Rectanglei new_region)
 	const bool new_scissor_enable = new_region.Valid();
 
 	if (new_scissor_enable != old_scissor_enable)
+	{
+		FlushBatch();
 		render_interface->EnableScissorRegion(new_scissor_enable);
+		if (recording)
+			recording->EnableScissorRegion(new_scissor_enable);
+	}
 
 	if (new_scissor_enable)
 	{
 		new_region = new_region.Intersect(Rectanglei::FromSize(viewport_dimensions));
 
 		if (new_region != state.scissor_region)
+		{
+			FlushBatch();
 			render_interface->SetScissorRegion(new_region);
+			if (recording)
+				recording->SetScissorRegion(new_region);
+		}
 	}
 
 	state.scissor_region = new_region;
@@ -173,15 +203,22 @@ void RenderManager::SetTransform(const Matrix4f* p_new_transform)
 
 	if (state.transform != new_transform)
 	{
+		FlushBatch();
 		render_interface->SetTransform(p_new_transform);
+		if (recording)
+			recording->SetTransform(p_new_transform);
 		state.transform = new_transform;
 	}
 }
 
 void RenderManager::ApplyClipMask(const ClipMaskGeometryList& clip_elements)
 {
+	FlushBatch();
+
 	const bool clip_mask_enabled = !clip_elements.empty();
 	render_interface->EnableClipMask(clip_mask_enabled);
+	if (recording)
+		recording->EnableClipMask(clip_mask_enabled);
 
 	if (clip_mask_enabled)
 	{
@@ -192,7 +229,11 @@ void RenderManager::ApplyClipMask(const ClipMaskGeometryList& clip_elements)
 			RMLUI_ASSERT(element_clip.geometry->render_manager == this);
 			SetTransform(element_clip.transform);
 			if (CompiledGeometryHandle handle = GetCompiledGeometryHandle(element_clip.geometry->resource_handle))
+			{
 				render_interface->RenderToClipMask(element_clip.operation, handle, element_clip.absolute_offset);
+				if (recording)
+					recording->RenderToClipMask(element_clip.operation, handle, element_clip.absolute_offset);
+			}
 		}
 
 		// Apply the initially set transform in case it was changed.
@@ -212,10 +253,12 @@ void RenderManager::SetState(const RenderState& next)
 void RenderManager::ResetState()
 {
 	SetState(RenderState{});
+	FlushBatch();
 }
 
 StableVectorIndex RenderManager::InsertGeometry(Mesh&& mesh)
 {
+	resource_generation += 1;
 	return geometry_list.insert(GeometryData{std::move(mesh), CompiledGeometryHandle{}});
 }
 
@@ -246,21 +289,110 @@ void RenderManager::Render(const Geometry& geometry, Vector2f translation, Textu
 		return;
 	}
 
-	if (CompiledGeometryHandle geometry_handle = GetCompiledGeometryHandle(geometry.resource_handle))
+	if (geometry_list[geometry.resource_handle].mesh.indices.empty())
+		return;
+
+	TextureHandle texture_handle = {};
+	if (texture.file_index != TextureFileIndex::Invalid)
+		texture_handle = texture_database->file_database.GetHandle(render_interface, texture.file_index);
+	else if (texture.callback_index != StableVectorIndex::Invalid)
+		texture_handle = texture_database->callback_database.GetHandle(this, render_interface, texture.callback_index);
+
+	// Recorded commands are replayed in later frames, thus they cannot refer to the per-frame batch geometry.
+	if (batching_enabled && !shader && !recording)
 	{
-		TextureHandle texture_handle = {};
-		if (texture.file_index != TextureFileIndex::Invalid)
-			texture_handle = texture_database->file_database.GetHandle(render_interface, texture.file_index);
-		else if (texture.callback_index != StableVectorIndex::Invalid)
-			texture_handle = texture_database->callback_database.GetHandle(this, render_interface, texture.callback_index);
+		if (!batched_draws.empty() && texture_handle != batched_texture)
+			FlushBatch();
+
+		batched_texture = texture_handle;
+		batched_draws.push_back(BatchedDraw{geometry.resource_handle, translation});
+		return;
+	}
 
+	FlushBatch();
+
+	if (CompiledGeometryHandle geometry_handle = GetCompiledGeometryHandle(geometry.resource_handle))
+	{
 		if (shader)
+		{
 			render_interface->RenderShader(shader.resource_handle, geometry_handle, translation, texture_handle);
+			if (recording)
+				recording->RenderShader(shader.resource_handle, geometry_handle, translation, texture_handle);
+		}
 		else
+		{
 			render_interface->RenderGeometry(geometry_handle, translation, texture_handle);
+			if (recording)
+				recording->RenderGeometry(geometry_handle, translation, texture_handle);
+		}
 	}
 }
 
+void RenderManager::FlushBatch()
+{
+	if (batched_draws.empty())
+		return;
+
+	if (batched_draws.size() == 1)
+	{
+		// Nothing to merge, render the draw using its own compiled geometry.
+		const BatchedDraw& draw = batched_draws.front();
+		if (CompiledGeometryHandle geometry_handle = GetCompiledGeometryHandle(draw.geometry))
+			render_interface->RenderGeometry(geometry_handle, draw.translation, batched_texture);
+	}
+	else
+	{
+		Mesh batch_mesh;
+		if (!free_batch_meshes.empty())
+		{
+			batch_mesh = std::move(free_batch_meshes.back());
+			free_batch_meshes.pop_back();
+			batch_mesh.vertices.clear();
+			batch_mesh.indices.clear();
+		}
+
+		// Pre-translate the vertices so that all the draws can share a single translation.
+		for (const BatchedDraw& draw : batched_draws)
+		{
+			const Mesh& mesh = geometry_list[draw.geometry].mesh;
+			const int index_offset = (int)batch_mesh.vertices.size();
+
+			for (Vertex vertex : mesh.vertices)
+			{
+				vertex.position += draw.translation;
+				batch_mesh.vertices.push_back(vertex);
+			}
+			for (int index : mesh.indices)
+				batch_mesh.indices.push_back(index + index_offset);
+		}
+
+		if (CompiledGeometryHandle geometry_handle = render_interface->CompileGeometry(batch_mesh.vertices, batch_mesh.indices))
+		{
+			render_interface->RenderGeometry(geometry_handle, Vector2f(0), batched_texture);
+			batch_geometry_handles.push_back(geometry_handle);
+			batch_meshes.push_back(std::move(batch_mesh));
+		}
+		else
+		{
+			free_batch_meshes.push_back(std::move(batch_mesh));
+		}
+	}
+
+	batched_draws.clear();
+}
+
+void RenderManager::ReleaseBatchGeometry()
+{
+	for (CompiledGeometryHandle geometry_handle : batch_geometry_handles)
+		render_interface->ReleaseGeometry(geometry_handle);
+	batch_geometry_handles.clear();
+
+	// The data of the released geometry is no longer referenced by the render interface, its memory can now be reused.
+	for (Mesh& mesh : batch_meshes)
+		free_batch_meshes.push_back(std::move(mesh));
+	batch_meshes.clear();
+}
+
 void RenderManager::GetTextureSourceList(StringList& source_list) const
 {
 	texture_database->file_database.GetSourceList(source_list);
@@ -268,17 +400,24 @@ void RenderManager::GetTextureSourceList(StringList& source_list) const
 
 bool RenderManager::ReleaseTexture(const String& texture_source)
 {
+	FlushBatch();
+	resource_generation += 1;
 	return texture_database->file_database.ReleaseTexture(render_interface, texture_source);
 }
 
 void RenderManager::ReleaseAllTextures()
 {
+	FlushBatch();
+	resource_generation += 1;
 	texture_database->callback_database.ReleaseAllTextures(render_interface);
 	texture_database->file_database.ReleaseAllTextures(render_interface);
 }
 
 void RenderManager::ReleaseAllCompiledGeometry()
 {
+	FlushBatch();
+	ReleaseBatchGeometry();
+	resource_generation += 1;
 	geometry_list.for_each([this](GeometryData& data) {
 		if (data.handle)
 		{
@@ -312,8 +451,11 @@ CompiledShader RenderManager::CompileShader(const String& name, const Dictionary
 
 LayerHandle RenderManager::PushLayer()
 {
+	FlushBatch();
 	const LayerHandle layer = render_interface->PushLayer();
 	render_stack.push_back(layer);
+	if (recording)
+		recording->PushLayer(layer);
 	return layer;
 }
 
@@ -321,14 +463,20 @@ void RenderManager::CompositeLayers(LayerHandle source, LayerHandle destination,
 {
 	RMLUI_ASSERT(source == 0 || std::find(render_stack.begin(), render_stack.end(), source) != render_stack.end());
 	RMLUI_ASSERT(destination == 0 || std::find(render_stack.begin(), render_stack.end(), destination) != render_stack.end());
+	FlushBatch();
 	render_interface->CompositeLayers(source, destination, blend_mode, filters);
+	if (recording)
+		recording->CompositeLayers(source, destination, blend_mode, filters);
 }
 
 void RenderManager::PopLayer()
 {
 	RMLUI_ASSERT(!render_stack.empty());
+	FlushBatch();
 	render_interface->PopLayer();
 	render_stack.pop_back();
+	if (recording)
+		recording->PopLayer();
 }
 
 LayerHandle RenderManager::GetTopLayer() const
@@ -344,6 +492,10 @@ LayerHandle RenderManager::GetNextLayer() const
 
 CompiledFilter RenderManager::SaveLayerAsMaskImage()
 {
+	// The mask image is a new resource each time, thus this frame cannot be replayed later.
+	recording_aborted = true;
+
+	FlushBatch();
 	if (CompiledFilterHandle handle = render_interface->SaveLayerAsMaskImage())
 	{
 		compiled_filter_count += 1;
@@ -356,6 +508,8 @@ void RenderManager::ReleaseResource(const CallbackTexture& texture)
 {
 	RMLUI_ASSERT(texture.render_manager == this && texture.resource_handle != texture.InvalidHandle());
 
+	resource_generation += 1;
+	FlushBatch();
 	texture_database->callback_database.ReleaseTexture(render_interface, texture.resource_handle);
 }
 
@@ -363,6 +517,8 @@ Mesh RenderManager::ReleaseResource(const Geometry& geometry)
 {
 	RMLUI_ASSERT(geometry.render_manager == this && geometry.resource_handle != geometry.InvalidHandle());
 
+	resource_generation += 1;
+	FlushBatch();
 	GeometryData& data = geometry_list[geometry.resource_handle];
 	if (data.handle)
 	{
@@ -378,6 +534,8 @@ void RenderManager::ReleaseResource(const CompiledFilter& filter)
 {
 	RMLUI_ASSERT(filter.render_manager == this && filter.resource_handle != filter.InvalidHandle());
 
+	resource_generation += 1;
+	FlushBatch();
 	render_interface->ReleaseFilter(filter.resource_handle);
 	compiled_filter_count -= 1;
 }
@@ -386,8 +544,34 @@ void RenderManager::ReleaseResource(const CompiledShader& shader)
 {
 	RMLUI_ASSERT(shader.render_manager == this && shader.resource_handle != shader.InvalidHandle());
 
+	resource_generation += 1;
+	FlushBatch();
 	render_interface->ReleaseShader(shader.resource_handle);
 	compiled_shader_count -= 1;
 }
 
+void RenderManager::BeginRecording(RenderCommandList* command_list)
+{
+	RMLUI_ASSERT(command_list && !recording);
+	FlushBatch();
+	command_list->Clear();
+	recording = command_list;
+	recording_aborted = false;
+}
+
+bool RenderManager::EndRecording()
+{
+	RMLUI_ASSERT(recording);
+	if (recording_aborted)
+		recording->Clear();
+	recording = nullptr;
+	return !recording_aborted;
+}
+
+void RenderManager::Replay(const RenderCommandList& command_list)
+{
+	RMLUI_ASSERT(!recording);
+	command_list.Replay(render_interface);
+}
+
 } // namespace Rml
@@ -42,6 +42,20 @@ Vector2i RenderManagerAccess::GetDimensions(RenderManager* render_manager, Stabl
 	return render_manager->texture_database->callback_database.GetDimensions(render_manager, render_manager->render_interface, callback_texture);
 }
 
+void RenderManagerAccess::InvalidateCallbackTexture(RenderManager* render_manager, StableVectorIndex callback_texture)
+{
+	render_manager->resource_generation += 1;
+	render_manager->FlushBatch();
+	render_manager->texture_database->callback_database.InvalidateTexture(render_manager->render_interface, callback_texture);
+}
+
+void RenderManagerAccess::InvalidateCallbackTextureRegion(RenderManager* render_manager, StableVectorIndex callback_texture, Rectanglei region)
+{
+	render_manager->resource_generation += 1;
+	render_manager->FlushBatch();
+	render_manager->texture_database->callback_database.InvalidateTextureRegion(callback_texture, region);
+}
+
 void RenderManagerAccess::Render(RenderManager* render_manager, const Geometry& geometry, Vector2f translation, Texture texture,
 	const CompiledShader& shader)
 {
@@ -68,4 +82,24 @@ void RenderManagerAccess::ReleaseAllCompiledGeometry(RenderManager* render_manag
 	render_manager->ReleaseAllCompiledGeometry();
 }
 
+int RenderManagerAccess::GetResourceGeneration(RenderManager* render_manager)
+{
+	return render_manager->resource_generation;
+}
+
+void RenderManagerAccess::BeginRecording(RenderManager* render_manager, RenderCommandList* command_list)
+{
+	render_manager->BeginRecording(command_list);
+}
+
+bool RenderManagerAccess::EndRecording(RenderManager* render_manager)
+{
+	return render_manager->EndRecording();
+}
+
+void RenderManagerAccess::Replay(RenderManager* render_manager, const RenderCommandList& command_list)
+{
+	render_manager->Replay(command_list);
+}
+
 } // namespace Rml
@@ -51,6 +51,8 @@ private:
 
 	static Vector2i GetDimensions(RenderManager* render_manager, TextureFileIndex texture);
 	static Vector2i GetDimensions(RenderManager* render_manager, StableVectorIndex callback_texture);
+	static void InvalidateCallbackTexture(RenderManager* render_manager, StableVectorIndex callback_texture);
+	static void InvalidateCallbackTextureRegion(RenderManager* render_manager, StableVectorIndex callback_texture, Rectanglei region);
 
 	static void Render(RenderManager* render_manager, const Geometry& geometry, Vector2f translation, Texture texture, const CompiledShader& shader);
 
@@ -60,6 +62,12 @@ private:
 	static void ReleaseAllTextures(RenderManager* render_manager);
 	static void ReleaseAllCompiledGeometry(RenderManager* render_manager);
 
+	static int GetResourceGeneration(RenderManager* render_manager);
+	static void BeginRecording(RenderManager* render_manager, RenderCommandList* command_list);
+	static bool EndRecording(RenderManager* render_manager);
+	static void Replay(RenderManager* render_manager, const RenderCommandList& command_list);
+
+	friend class Context;
 	friend class CompiledFilter;
 	friend class CompiledShader;
 	friend class CallbackTexture;
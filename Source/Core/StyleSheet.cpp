@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "AncestorFilter.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
 #include "StyleSheetNode.h"
@@ -97,6 +98,32 @@ void StyleSheet::BuildNodeIndex()
 	root->BuildIndex(styled_node_index);
 }
 
+int StyleSheet::GetInvalidationFlags(const Element* element, StyleSheetIndex::SelectorFeature feature, const String& name) const
+{
+	const StyleSheetIndex::InvalidationIndex* index = nullptr;
+	switch (feature)
+	{
+	case StyleSheetIndex::SelectorFeature::Id: index = &styled_node_index.id_invalidation; break;
+	case StyleSheetIndex::SelectorFeature::Class: index = &styled_node_index.class_invalidation; break;
+	case StyleSheetIndex::SelectorFeature::PseudoClass: index = &styled_node_index.pseudo_class_invalidation; break;
+	case StyleSheetIndex::SelectorFeature::Attribute: index = &styled_node_index.attribute_invalidation; break;
+	}
+
+	auto it = index->find(Hash<String>()(name));
+	if (it == index->end())
+		return 0;
+
+	const StyleSheetIndex::Invalidation& invalidation = it->second;
+	int flags = invalidation.flags;
+	for (const auto& node_flags : invalidation.relative_nodes)
+	{
+		if ((flags & node_flags.second) != node_flags.second && node_flags.first->IsCompoundApplicable(element, feature))
+			flags |= node_flags.second;
+	}
+
+	return flags;
+}
+
 const NamedDecorator* StyleSheet::GetNamedDecorator(const String& name) const
 {
 	auto it = named_decorator_map.find(name);
@@ -198,14 +225,34 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	static Vector<const StyleSheetNode*> applicable_nodes;
 	applicable_nodes.clear();
 
-	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
-		auto it_nodes = node_index.find(Hash<String>()(key));
+	// Text elements are never matched.
+	if (element->GetTagName() == "#text")
+		return nullptr;
+
+	// When the element is visited during the element update traversal, the ancestor filter can quickly reject nodes which require names not
+	// present on any of the element's ancestors. The filter is only prepared once we encounter a node requiring any such names.
+	enum class AncestorFilterState { Unprepared, Valid, Invalid };
+	AncestorFilterState ancestor_filter_state = AncestorFilterState::Unprepared;
+
+	auto IsRejectedByAncestorFilter = [element, &ancestor_filter_state](const StyleSheetNode* node) {
+		if (!node->RequiresAncestorNames())
+			return false;
+		if (ancestor_filter_state == AncestorFilterState::Unprepared)
+			ancestor_filter_state = (AncestorFilter::PrepareFor(element) ? AncestorFilterState::Valid : AncestorFilterState::Invalid);
+		return ancestor_filter_state == AncestorFilterState::Valid && !node->MayMatchAncestorFilter();
+	};
+
+	auto AddApplicableNodes = [element, &IsRejectedByAncestorFilter](const StyleSheetIndex::NodeIndex& node_index, Atom key) {
+		auto it_nodes = node_index.find(key);
 		if (it_nodes != node_index.end())
 		{
 			const StyleSheetIndex::NodeList& nodes = it_nodes->second;
 
 			for (const StyleSheetNode* node : nodes)
 			{
+				if (IsRejectedByAncestorFilter(node))
+					continue;
+
 				// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
 				// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
 				// element's hierarchy to nodes in the style hierarchy.
@@ -216,26 +263,27 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	};
 
 	// See if there are any styles defined for this element.
-	const String& tag = element->GetTagName();
-	const String& id = element->GetId();
-	const StringList& class_names = element->GetStyle()->GetClassNameList();
-
-	// Text elements are never matched.
-	if (tag == "#text")
-		return nullptr;
+	const ElementStyle* style = element->GetStyle();
+	const Atom id_atom = style->GetIdAtom();
 
 	// First, look up the indexed requirements.
-	if (!id.empty())
-		AddApplicableNodes(styled_node_index.ids, id);
+	if (id_atom)
+		AddApplicableNodes(styled_node_index.ids, id_atom);
 
-	for (const String& name : class_names)
-		AddApplicableNodes(styled_node_index.classes, name);
+	for (Atom class_atom : style->GetClassAtomList())
+		AddApplicableNodes(styled_node_index.classes, class_atom);
 
-	AddApplicableNodes(styled_node_index.tags, tag);
+	for (Atom pseudo_class_atom : style->GetPseudoClassAtomList())
+		AddApplicableNodes(styled_node_index.pseudo_classes, pseudo_class_atom);
+
+	AddApplicableNodes(styled_node_index.tags, style->GetTagAtom());
 
 	// Also check all remaining nodes that don't contain any indexed requirements.
 	for (const StyleSheetNode* node : styled_node_index.other)
 	{
+		if (IsRejectedByAncestorFilter(node))
+			continue;
+
 		if (node->IsApplicable(element, nullptr))
 			applicable_nodes.push_back(node);
 	}
@@ -30,6 +30,8 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "AncestorFilter.h"
+#include "ElementStyle.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetSelector.h"
 #include <algorithm>
@@ -45,16 +47,22 @@ static inline bool IsTextElement(const Element* element)
 StyleSheetNode::StyleSheetNode()
 {
 	CalculateAndSetSpecificity();
+	CompileSelector();
+	CollectAncestorHashes();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const CompoundSelector& selector) : parent(parent), selector(selector)
 {
 	CalculateAndSetSpecificity();
+	CompileSelector();
+	CollectAncestorHashes();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, CompoundSelector&& selector) : parent(parent), selector(std::move(selector))
 {
 	CalculateAndSetSpecificity();
+	CompileSelector();
+	CollectAncestorHashes();
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const CompoundSelector& other)
@@ -129,8 +137,8 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 	// If this has properties defined, then we insert it into the styled node index.
 	if (!properties.Empty())
 	{
-		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, const String& key, const StyleSheetNode* node) {
-			StyleSheetIndex::NodeList& nodes = node_index[Hash<String>()(key)];
+		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, Atom key, const StyleSheetNode* node) {
+			StyleSheetIndex::NodeList& nodes = node_index[key];
 			auto it = std::find(nodes.begin(), nodes.end(), node);
 			if (it == nodes.end())
 				nodes.push_back(node);
@@ -140,17 +148,21 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 		// general requirement last. This way we are able to rule out as many nodes as possible as quickly as possible.
 		if (!selector.id.empty())
 		{
-			IndexInsertNode(styled_node_index.ids, selector.id, this);
+			IndexInsertNode(styled_node_index.ids, id_atom, this);
 		}
 		else if (!selector.class_names.empty())
 		{
 			// @performance Right now we just use the first class for simplicity. Later we may want to devise a better strategy to try to add the
 			// class with the most unique name. For example by adding the class from this node's list that has the fewest existing matches.
-			IndexInsertNode(styled_node_index.classes, selector.class_names.front(), this);
+			IndexInsertNode(styled_node_index.classes, class_atoms.front(), this);
+		}
+		else if (!selector.pseudo_class_names.empty())
+		{
+			IndexInsertNode(styled_node_index.pseudo_classes, AtomTable::GetOrInsert(selector.pseudo_class_names.front()), this);
 		}
 		else if (!selector.tag.empty())
 		{
-			IndexInsertNode(styled_node_index.tags, selector.tag, this);
+			IndexInsertNode(styled_node_index.tags, tag_atom, this);
 		}
 		else
 		{
@@ -158,15 +170,104 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 		}
 	}
 
+	// Record which elements may be affected when an element changes any of the features of this node's selector. Styled nodes match the changed
+	// element itself, while our children's combinators determine whether the change can affect its descendants or siblings.
+	if (parent)
+	{
+		int relative_flags = 0;
+		for (auto& child : children)
+		{
+			switch (child->selector.combinator)
+			{
+			case SelectorCombinator::Descendant:
+			case SelectorCombinator::Child: relative_flags |= StyleSheetIndex::InvalidateDescendants; break;
+			case SelectorCombinator::NextSibling:
+			case SelectorCombinator::SubsequentSibling: relative_flags |= StyleSheetIndex::InvalidateSiblings; break;
+			}
+		}
+		BuildInvalidationIndex(styled_node_index, properties.Empty() ? 0 : StyleSheetIndex::InvalidateSelf, relative_flags, false);
+	}
+
 	for (auto& child : children)
 		child->BuildIndex(styled_node_index);
 }
 
+void StyleSheetNode::BuildInvalidationIndex(StyleSheetIndex& styled_node_index, int invalidation_flags, int relative_flags,
+	bool include_descendants) const
+{
+	auto IndexInsertFlags = [this, invalidation_flags, relative_flags](StyleSheetIndex::InvalidationIndex& index, const String& key) {
+		StyleSheetIndex::Invalidation& invalidation = index[Hash<String>()(key)];
+		invalidation.flags |= invalidation_flags;
+		if (relative_flags)
+			invalidation.relative_nodes.emplace_back(this, relative_flags);
+	};
+
+	if (!selector.id.empty())
+		IndexInsertFlags(styled_node_index.id_invalidation, selector.id);
+	for (const String& name : selector.class_names)
+		IndexInsertFlags(styled_node_index.class_invalidation, name);
+	for (const String& name : selector.pseudo_class_names)
+		IndexInsertFlags(styled_node_index.pseudo_class_invalidation, name);
+	for (const AttributeSelector& attribute : selector.attributes)
+		IndexInsertFlags(styled_node_index.attribute_invalidation, attribute.name);
+
+	// Internal selectors such as those in :not() may refer to the element's relatives, thus conservatively invalidate all of them.
+	for (const StructuralSelector& structural_selector : selector.structural_selectors)
+	{
+		if (structural_selector.selector_tree)
+			structural_selector.selector_tree->root->BuildInvalidationIndex(styled_node_index, StyleSheetIndex::InvalidateAll, 0, true);
+	}
+
+	if (include_descendants)
+	{
+		for (auto& child : children)
+			child->BuildInvalidationIndex(styled_node_index, invalidation_flags, relative_flags, true);
+	}
+}
+
+bool StyleSheetNode::RequiresAncestorNames() const
+{
+	return num_ancestor_hashes > 0;
+}
+
+bool StyleSheetNode::MayMatchAncestorFilter() const
+{
+	for (int i = 0; i < num_ancestor_hashes; i++)
+	{
+		if (!AncestorFilter::MayContain(ancestor_hashes[i]))
+			return false;
+	}
+	return true;
+}
+
 int StyleSheetNode::GetSpecificity() const
 {
 	return specificity;
 }
 
+bool StyleSheetNode::IsCompoundApplicable(const Element* element, StyleSheetIndex::SelectorFeature changed_feature) const
+{
+	const ElementStyle* style = element->GetStyle();
+
+	if (tag_atom && tag_atom != style->GetTagAtom())
+		return false;
+
+	// Attribute changes may also change the id and class names, thus only pseudo-class changes leave them untouched.
+	if (changed_feature == StyleSheetIndex::SelectorFeature::PseudoClass)
+	{
+		if (id_atom && id_atom != style->GetIdAtom())
+			return false;
+
+		for (Atom class_atom : class_atoms)
+		{
+			if (!style->IsClassSet(class_atom))
+				return false;
+		}
+	}
+
+	return true;
+}
+
 void StyleSheetNode::ImportProperties(const PropertyDictionary& _properties, int rule_specificity)
 {
 	properties.Import(_properties, specificity + rule_specificity);
@@ -179,21 +280,26 @@ const PropertyDictionary& StyleSheetNode::GetProperties() const
 
 bool StyleSheetNode::Match(const Element* element, const Element* scope) const
 {
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	const ElementStyle* style = element->GetStyle();
+
+	if (tag_atom && tag_atom != style->GetTagAtom())
 		return false;
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (id_atom && id_atom != style->GetIdAtom())
 		return false;
 
-	for (auto& name : selector.class_names)
+	for (Atom class_atom : class_atoms)
 	{
-		if (!element->IsClassSet(name))
+		if (!style->IsClassSet(class_atom))
 			return false;
 	}
 
-	for (auto& name : selector.pseudo_class_names)
+	if ((style->GetPseudoClassMask() & pseudo_class_mask) != pseudo_class_mask)
+		return false;
+
+	for (Atom pseudo_class_atom : unmasked_pseudo_class_atoms)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(pseudo_class_atom))
 			return false;
 	}
 
@@ -362,22 +468,27 @@ bool StyleSheetNode::IsApplicable(const Element* element, const Element* scope)
 
 	// We could in principle just call Match() here and then go on with the ancestor style nodes. Instead, we test the requirements of this node in a
 	// particular order for performance reasons.
-	for (const String& name : selector.pseudo_class_names)
+	const ElementStyle* style = element->GetStyle();
+
+	if ((style->GetPseudoClassMask() & pseudo_class_mask) != pseudo_class_mask)
+		return false;
+
+	for (Atom pseudo_class_atom : unmasked_pseudo_class_atoms)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(pseudo_class_atom))
 			return false;
 	}
 
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	if (tag_atom && tag_atom != style->GetTagAtom())
 		return false;
 
-	for (const String& name : selector.class_names)
+	for (Atom class_atom : class_atoms)
 	{
-		if (!element->IsClassSet(name))
+		if (!style->IsClassSet(class_atom))
 			return false;
 	}
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (id_atom && id_atom != style->GetIdAtom())
 		return false;
 
 	if (!selector.attributes.empty() && !MatchAttributes(element))
@@ -417,4 +528,52 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void StyleSheetNode::CollectAncestorHashes()
+{
+	num_ancestor_hashes = 0;
+
+	auto AddHash = [this](uint32_t hash) {
+		if (num_ancestor_hashes < max_ancestor_hashes)
+			ancestor_hashes[num_ancestor_hashes++] = hash;
+	};
+
+	// A parent node must match an ancestor of the element whenever its child node is joined by a descendant or child combinator. Sibling
+	// combinators move to a sibling, which shares its ancestors with the element. Thus, the compound selectors of all such parent nodes name
+	// required ancestors. Prefer the most unique names, and the nearest ancestors.
+	for (const StyleSheetNode* node = this; node->parent && node->parent->parent && num_ancestor_hashes < max_ancestor_hashes; node = node->parent)
+	{
+		if (node->selector.combinator != SelectorCombinator::Descendant && node->selector.combinator != SelectorCombinator::Child)
+			continue;
+
+		const StyleSheetNode* ancestor = node->parent;
+		if (ancestor->id_atom)
+			AddHash(AncestorFilter::GetIdHash(ancestor->id_atom));
+		for (Atom class_atom : ancestor->class_atoms)
+			AddHash(AncestorFilter::GetClassHash(class_atom));
+		if (ancestor->tag_atom)
+			AddHash(AncestorFilter::GetTagHash(ancestor->tag_atom));
+	}
+}
+
+void StyleSheetNode::CompileSelector()
+{
+	tag_atom = AtomTable::GetOrInsert(selector.tag);
+	id_atom = AtomTable::GetOrInsert(selector.id);
+
+	class_atoms.clear();
+	for (const String& name : selector.class_names)
+		class_atoms.push_back(AtomTable::GetOrInsert(name));
+
+	pseudo_class_mask = 0;
+	unmasked_pseudo_class_atoms.clear();
+	for (const String& name : selector.pseudo_class_names)
+	{
+		const Atom atom = AtomTable::GetOrInsert(name);
+		if (const uint32_t bit = AtomTable::GetPseudoClassBit(atom))
+			pseudo_class_mask |= bit;
+		else
+			unmasked_pseudo_class_atoms.push_back(atom);
+	}
+}
+
 } // namespace Rml
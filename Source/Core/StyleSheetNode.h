@@ -30,12 +30,13 @@
 #define RMLUI_CORE_STYLESHEETNODE_H
 
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
+#include "../../Include/RmlUi/Core/StyleSheetTypes.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AtomTable.h"
 #include "StyleSheetSelector.h"
 
 namespace Rml {
 
-struct StyleSheetIndex;
 class StyleSheetNode;
 using StyleSheetNodeList = Vector<UniquePtr<StyleSheetNode>>;
 
@@ -76,11 +77,23 @@ public:
 	/// consider any text element not applicable.
 	bool IsApplicable(const Element* element, const Element* scope) const;
 
+	/// Returns true if the node requires any tag, id, or class names to be present on the ancestors of matching elements.
+	bool RequiresAncestorNames() const;
+	/// Returns false if the node requires an ancestor name which is definitely not present in the ancestor filter.
+	/// @note The caller must ensure that the ancestor filter is valid for the element being matched.
+	bool MayMatchAncestorFilter() const;
+
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
 
+	/// Returns true if this node's compound selector may apply to the element, regardless of its ancestors and siblings. Only the parts of the
+	/// selector which cannot change together with the given feature are tested.
+	bool IsCompoundApplicable(const Element* element, StyleSheetIndex::SelectorFeature changed_feature) const;
+
 private:
 	void CalculateAndSetSpecificity();
+	void CompileSelector();
+	void CollectAncestorHashes();
 
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element, const Element* scope) const;
@@ -90,12 +103,28 @@ private:
 	// Recursively traverse the nodes up towards the root to match the element and its hierarchy.
 	bool TraverseMatch(const Element* element, const Element* scope) const;
 
+	// Records the invalidation flags of the features used in this node's selector, and those of its descendants when requested. The relative
+	// flags only apply to elements matching this node's compound selector.
+	void BuildInvalidationIndex(StyleSheetIndex& styled_node_index, int invalidation_flags, int relative_flags, bool include_descendants) const;
+
 	// The parent of this node; is nullptr for the root node.
 	StyleSheetNode* parent = nullptr;
 
 	// Node requirements
 	CompoundSelector selector;
 
+	// The selector's names compiled to atoms, and its pseudo-classes to a mask where possible, for fast matching.
+	Atom tag_atom = 0;
+	Atom id_atom = 0;
+	Vector<Atom> class_atoms;
+	uint32_t pseudo_class_mask = 0;
+	Vector<Atom> unmasked_pseudo_class_atoms;
+
+	// Ancestor filter hashes of names required by our ancestor nodes to be present on ancestors of the matched element.
+	static constexpr int max_ancestor_hashes = 4;
+	Array<uint32_t, max_ancestor_hashes> ancestor_hashes = {};
+	int num_ancestor_hashes = 0;
+
 	// A measure of specificity of this node; the attribute in a node with a higher value will override those of a node with a lower value.
 	int specificity = 0;
 
@@ -33,9 +33,11 @@
 
 namespace Rml {
 
-static inline bool IsTextElement(const Element* element)
+// Text nodes and internal elements, such as the spacers of virtualized 'data-for' views, are ignored by structural selectors.
+static inline bool IsIgnoredElement(const Element* element)
 {
-	return element->GetTagName() == "#text";
+	const String& tag = element->GetTagName();
+	return !tag.empty() && tag[0] == '#';
 }
 
 // Returns true if a positive integer can be found for n in the equation an + b = count.
@@ -108,8 +110,8 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 		{
 			Element* child = parent->GetChild(i);
 
-			// Skip text nodes.
-			if (IsTextElement(child))
+			// Skip text nodes and internal elements.
+			if (IsIgnoredElement(child))
 				continue;
 
 			// If we've found our element, then break; the current index is our element's index.
@@ -134,8 +136,8 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 		{
 			Element* child = parent->GetChild(i);
 
-			// Skip text nodes.
-			if (IsTextElement(child))
+			// Skip text nodes and internal elements.
+			if (IsIgnoredElement(child))
 				continue;
 
 			// If we've found our element, then break; the current index is our element's index.
@@ -215,11 +217,11 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 			if (child == element)
 				return true;
 
-			// If this child is not a text element, then the selector fails; this element is non-trivial.
-			if (!IsTextElement(child))
+			// If this child is not an ignored element, then the selector fails; this element is non-trivial.
+			if (!IsIgnoredElement(child))
 				return false;
 
-			// Otherwise, skip over the text element to find the last non-trivial element.
+			// Otherwise, skip over the ignored element to find the last non-trivial element.
 			child_index++;
 		}
 
@@ -240,11 +242,11 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 			if (child == element)
 				return true;
 
-			// If this child is not a text element, then the selector fails; this element is non-trivial.
-			if (!IsTextElement(child))
+			// If this child is not an ignored element, then the selector fails; this element is non-trivial.
+			if (!IsIgnoredElement(child))
 				return false;
 
-			// Otherwise, skip over the text element to find the last non-trivial element.
+			// Otherwise, skip over the ignored element to find the last non-trivial element.
 			child_index--;
 		}
 
@@ -315,7 +317,7 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 				continue;
 
 			// Skip the child if it is trivial.
-			if (IsTextElement(child))
+			if (IsIgnoredElement(child))
 				continue;
 
 			return false;
@@ -0,0 +1,109 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TextureAtlas.h"
+#include "../../Include/RmlUi/Core/Math.h"
+
+namespace Rml {
+
+// Spacing added between rectangles and around the page edges, to avoid filtering artifacts.
+static constexpr int rectangle_spacing = 1;
+
+TextureAtlas::TextureAtlas(int initial_page_size, int max_page_size) : initial_page_size(initial_page_size), max_page_size(max_page_size) {}
+
+int TextureAtlas::Place(Vector2i dimensions, Vector2i& position)
+{
+	RMLUI_ASSERT(dimensions.x >= 0 && dimensions.y >= 0);
+
+	const int required_size = Math::Max(dimensions.x, dimensions.y) + 2 * rectangle_spacing;
+	if (required_size > max_page_size)
+		return -1;
+
+	// Only the last pages are likely to have room, so search them first.
+	for (int i = (int)pages.size() - 1; i >= 0; i--)
+	{
+		if (PlaceInPage(pages[i], dimensions, position))
+			return i;
+	}
+
+	int page_size = (pages.empty() ? initial_page_size : pages.back().size * 2);
+	page_size = Math::Min(Math::Max(page_size, Math::ToPowerOfTwo(required_size)), max_page_size);
+
+	pages.push_back(Page{page_size, rectangle_spacing, {}});
+	if (!PlaceInPage(pages.back(), dimensions, position))
+	{
+		RMLUI_ERROR;
+		pages.pop_back();
+		return -1;
+	}
+
+	return (int)pages.size() - 1;
+}
+
+int TextureAtlas::GetNumPages() const
+{
+	return (int)pages.size();
+}
+
+Vector2i TextureAtlas::GetPageDimensions(int page_index) const
+{
+	RMLUI_ASSERT(page_index >= 0 && page_index < (int)pages.size());
+	return Vector2i(pages[page_index].size);
+}
+
+bool TextureAtlas::PlaceInPage(Page& page, Vector2i dimensions, Vector2i& position)
+{
+	// Find the shelf which wastes the least amount of height while still having room for the rectangle.
+	Shelf* best_shelf = nullptr;
+	for (Shelf& shelf : page.shelves)
+	{
+		if (shelf.height >= dimensions.y && shelf.used_width + dimensions.x + rectangle_spacing <= page.size &&
+			(!best_shelf || shelf.height < best_shelf->height))
+			best_shelf = &shelf;
+	}
+
+	// Open a new shelf if the best existing shelf is considerably taller than the rectangle, and there is room for it.
+	const bool open_new_shelf = (!best_shelf || best_shelf->height > dimensions.y + dimensions.y / 2 + 2);
+	if (open_new_shelf && page.used_height + dimensions.y + rectangle_spacing <= page.size &&
+		rectangle_spacing + dimensions.x + rectangle_spacing <= page.size)
+	{
+		page.shelves.push_back(Shelf{page.used_height, dimensions.y, rectangle_spacing});
+		page.used_height += dimensions.y + rectangle_spacing;
+		best_shelf = &page.shelves.back();
+	}
+
+	if (!best_shelf)
+		return false;
+
+	position = Vector2i(best_shelf->used_width, best_shelf->y);
+	best_shelf->used_width += dimensions.x + rectangle_spacing;
+
+	return true;
+}
+
+} // namespace Rml
@@ -0,0 +1,81 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TEXTUREATLAS_H
+#define RMLUI_CORE_TEXTUREATLAS_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    A texture atlas places rectangles within a list of textures, called pages. Rectangles are added one at a time, and
+    are never moved after being placed. Instead, new pages are added whenever the existing ones are filled up. This
+    makes it possible to add new rectangles to the atlas without invalidating any previously placed ones.
+
+    Rectangles are placed using shelf packing: each page is divided into horizontal shelves, and each rectangle is
+    placed next to the previous one on the shelf that best fits its height.
+ */
+class TextureAtlas {
+public:
+	/// @param[in] initial_page_size The width and height of the first page.
+	/// @param[in] max_page_size The maximum width and height of any page. Each new page doubles in size up to this limit.
+	TextureAtlas(int initial_page_size = 0, int max_page_size = 0);
+
+	/// Places a rectangle within the atlas, adding a new page if it does not fit in any of the existing pages.
+	/// @param[in] dimensions The dimensions of the rectangle.
+	/// @param[out] position The top-left position of the rectangle within its page.
+	/// @return The index of the page the rectangle was placed in, or -1 if the rectangle is too large to fit in any page.
+	int Place(Vector2i dimensions, Vector2i& position);
+
+	/// Returns the number of pages in the atlas.
+	int GetNumPages() const;
+	/// Returns the dimensions of the given page.
+	Vector2i GetPageDimensions(int page_index) const;
+
+private:
+	struct Shelf {
+		int y;
+		int height;
+		int used_width;
+	};
+	struct Page {
+		int size;
+		int used_height;
+		Vector<Shelf> shelves;
+	};
+
+	bool PlaceInPage(Page& page, Vector2i dimensions, Vector2i& position);
+
+	int initial_page_size;
+	int max_page_size;
+	Vector<Page> pages;
+};
+
+} // namespace Rml
+#endif
@@ -50,7 +50,7 @@ CallbackTextureDatabase::~CallbackTextureDatabase()
 StableVectorIndex CallbackTextureDatabase::CreateTexture(CallbackTextureFunction&& callback)
 {
 	RMLUI_ASSERT(callback);
-	return texture_list.insert(CallbackTextureEntry{std::move(callback), TextureHandle(), Vector2i()});
+	return texture_list.insert(CallbackTextureEntry{std::move(callback), TextureHandle(), Vector2i(), false, Rectanglei::MakeInvalid()});
 }
 
 void CallbackTextureDatabase::ReleaseTexture(RenderInterface* render_interface, StableVectorIndex callback_index)
@@ -61,6 +61,26 @@ void CallbackTextureDatabase::ReleaseTexture(RenderInterface* render_interface,
 	texture_list.erase(callback_index);
 }
 
+void CallbackTextureDatabase::InvalidateTexture(RenderInterface* render_interface, StableVectorIndex callback_index)
+{
+	CallbackTextureEntry& data = texture_list[callback_index];
+	if (data.texture_handle)
+	{
+		render_interface->ReleaseTexture(data.texture_handle);
+		data.texture_handle = {};
+		data.dimensions = {};
+	}
+	data.dirty_region = Rectanglei::MakeInvalid();
+}
+
+void CallbackTextureDatabase::InvalidateTextureRegion(StableVectorIndex callback_index, Rectanglei region)
+{
+	CallbackTextureEntry& data = texture_list[callback_index];
+	// Textures not yet generated will be generated in full anyway.
+	if (data.texture_handle)
+		data.dirty_region = (data.dirty_region.Valid() ? data.dirty_region.Join(region) : region);
+}
+
 Vector2i CallbackTextureDatabase::GetDimensions(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index)
 {
 	return EnsureLoaded(render_manager, render_interface, callback_index).dimensions;
@@ -75,10 +95,16 @@ auto CallbackTextureDatabase::EnsureLoaded(RenderManager* render_manager, Render
 	-> CallbackTextureEntry&
 {
 	CallbackTextureEntry& data = texture_list[callback_index];
-	if (!data.texture_handle)
+	if (!data.texture_handle || data.dirty_region.Valid())
 	{
-		if (!data.callback(CallbackTextureInterface(*render_manager, *render_interface, data.texture_handle, data.dimensions)))
+		const Rectanglei update_region = data.dirty_region;
+		data.dirty_region = Rectanglei::MakeInvalid();
+
+		if (!data.callback(
+				CallbackTextureInterface(*render_manager, *render_interface, data.texture_handle, data.dimensions, data.alpha_texture, update_region)))
 		{
+			if (data.texture_handle)
+				render_interface->ReleaseTexture(data.texture_handle);
 			data.texture_handle = {};
 			data.dimensions = {};
 		}
@@ -100,6 +126,7 @@ void CallbackTextureDatabase::ReleaseAllTextures(RenderInterface* render_interfa
 			texture.texture_handle = {};
 			texture.dimensions = {};
 		}
+		texture.dirty_region = Rectanglei::MakeInvalid();
 	});
 }
 
@@ -44,6 +44,10 @@ public:
 
 	StableVectorIndex CreateTexture(CallbackTextureFunction&& callback);
 	void ReleaseTexture(RenderInterface* render_interface, StableVectorIndex callback_index);
+	// Releases the texture handle while keeping the callback, so that the texture is regenerated on next use.
+	void InvalidateTexture(RenderInterface* render_interface, StableVectorIndex callback_index);
+	// Marks a region of the texture as changed, so that the callback is called again to update the texture on next use.
+	void InvalidateTextureRegion(StableVectorIndex callback_index, Rectanglei region);
 
 	Vector2i GetDimensions(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
 	TextureHandle GetHandle(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
@@ -57,6 +61,8 @@ private:
 		CallbackTextureFunction callback;
 		TextureHandle texture_handle = {};
 		Vector2i dimensions;
+		bool alpha_texture = false;
+		Rectanglei dirty_region = Rectanglei::MakeInvalid();
 	};
 
 	CallbackTextureEntry& EnsureLoaded(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
@@ -168,6 +168,9 @@ void WidgetScroll::Update()
 
 			if (Context* ctx = parent->GetContext())
 				ctx->RequestNextUpdate(arrow_timers[i]);
+
+			// Make sure we are visited again during the next update loop for as long as the arrow is held.
+			parent->DirtyUpdate();
 		}
 	}
 }
@@ -431,12 +434,14 @@ void WidgetScroll::ProcessEvent(Event& event)
 		{
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			parent->DirtyUpdate();
 			ScrollLineUp();
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			parent->DirtyUpdate();
 			ScrollLineDown();
 		}
 	}
@@ -0,0 +1,143 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "XMLFragment.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/URL.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+
+namespace Rml {
+
+// Records the nodes of the parsed source into the fragment, while submitting them to the node handlers as usual.
+class XMLFragmentRecorder final : public XMLParser {
+public:
+	XMLFragmentRecorder(Element* root, XMLFragment& fragment) : XMLParser(root), fragment(fragment) {}
+
+	// Mismatched and unclosed tags are reported by the parser, thus such sources should not be instanced from the fragment.
+	bool IsWellFormed() const { return !has_mismatched_tags && open_tags.empty(); }
+
+protected:
+	void HandleElementStart(const String& name, const XMLAttributes& attributes) override
+	{
+		int attributes_index = -1;
+		if (!attributes.empty())
+		{
+			attributes_index = (int)fragment.attributes.size();
+			fragment.attributes.push_back(attributes);
+		}
+
+		fragment.nodes.push_back(XMLFragment::Node{XMLFragment::NodeType::ElementStart, XMLDataType::Text, attributes_index, name});
+		open_tags.push_back(StringUtilities::ToLower(name));
+
+		XMLParser::HandleElementStart(name, attributes);
+	}
+
+	void HandleElementEnd(const String& name) override
+	{
+		if (open_tags.empty() || open_tags.back() != StringUtilities::ToLower(name))
+			has_mismatched_tags = true;
+		else
+			open_tags.pop_back();
+
+		fragment.nodes.push_back(XMLFragment::Node{XMLFragment::NodeType::ElementEnd, XMLDataType::Text, -1, name});
+
+		XMLParser::HandleElementEnd(name);
+	}
+
+	void HandleData(const String& data, XMLDataType type) override
+	{
+		fragment.nodes.push_back(XMLFragment::Node{XMLFragment::NodeType::Data, type, -1, data});
+
+		XMLParser::HandleData(data, type);
+	}
+
+private:
+	XMLFragment& fragment;
+	StringList open_tags;
+	bool has_mismatched_tags = false;
+};
+
+// Submits the nodes of a fragment to the node handlers, as if they were encountered during parsing.
+class XMLFragmentInstancer final : public XMLParser {
+public:
+	XMLFragmentInstancer(Element* root) : XMLParser(root) {}
+
+	void Instance(const XMLFragment& fragment)
+	{
+		const URL source_url;
+		SetSourceURLPtr(&source_url);
+
+		for (const XMLFragment::Node& node : fragment.nodes)
+		{
+			switch (node.type)
+			{
+			case XMLFragment::NodeType::ElementStart:
+				HandleElementStart(node.value, node.attributes_index < 0 ? empty_attributes : fragment.attributes[node.attributes_index]);
+				break;
+			case XMLFragment::NodeType::ElementEnd: HandleElementEnd(node.value); break;
+			case XMLFragment::NodeType::Data: HandleData(node.value, node.data_type); break;
+			}
+		}
+
+		SetSourceURLPtr(nullptr);
+	}
+
+private:
+	const XMLAttributes empty_attributes;
+};
+
+XMLFragment::XMLFragment() {}
+
+XMLFragment::~XMLFragment() {}
+
+void XMLFragment::Parse(Element* parent, const String& rml)
+{
+	RMLUI_ZoneScoped;
+
+	nodes.clear();
+	attributes.clear();
+
+	StreamMemory stream(reinterpret_cast<const byte*>(rml.data()), rml.size());
+	XMLFragmentRecorder recorder(parent, *this);
+	recorder.Parse(&stream);
+
+	well_formed = recorder.IsWellFormed();
+}
+
+void XMLFragment::Instance(Element* parent) const
+{
+	RMLUI_ZoneScoped;
+
+	XMLFragmentInstancer instancer(parent);
+	instancer.Instance(*this);
+}
+
+} // namespace Rml
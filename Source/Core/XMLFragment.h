@@ -0,0 +1,84 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#ifndef RMLUI_CORE_XMLFRAGMENT_H
+#define RMLUI_CORE_XMLFRAGMENT_H
+
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+    A pre-parsed fragment of RML, stored as the sequence of nodes reported by the XML parser.
+
+    Instancing the fragment submits its nodes to the XML node handlers, just like the XML parser does during parsing, but
+    without tokenizing the source again. Structural data views receive their inner RML as a data node, like during
+    regular parsing.
+ */
+class XMLFragment : NonCopyMoveable {
+public:
+	XMLFragment();
+	~XMLFragment();
+
+	/// Parses the RML source as children of the given element, while recording its nodes into this fragment.
+	void Parse(Element* parent, const String& rml);
+
+	/// Instances the recorded fragment as children of the given element.
+	void Instance(Element* parent) const;
+
+	/// Returns false if the source has mismatched or unclosed tags. Such sources should always be parsed, so that the
+	/// errors are reported each time.
+	bool IsWellFormed() const { return well_formed; }
+
+private:
+	enum class NodeType : byte { ElementStart, ElementEnd, Data };
+
+	struct Node {
+		NodeType type;
+		XMLDataType data_type;
+		// Index into 'attributes', or -1 if the element has no attributes.
+		int attributes_index;
+		// The tag name of elements, otherwise the data contents.
+		String value;
+	};
+
+	Vector<Node> nodes;
+	Vector<XMLAttributes> attributes;
+	bool well_formed = false;
+
+	friend class XMLFragmentRecorder;
+	friend class XMLFragmentInstancer;
+};
+
+} // namespace Rml
+#endif
@@ -57,6 +57,8 @@ ElementInfo::ElementInfo(const String& tag) : ElementDebugDocument(tag)
 	force_update_once = false;
 	title_dirty = true;
 	previous_update_time = 0.0;
+
+	SetNeedsUpdate(true);
 }
 
 ElementInfo::~ElementInfo()
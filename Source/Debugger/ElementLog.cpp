@@ -48,6 +48,8 @@ ElementLog::ElementLog(const String& tag) : ElementDebugDocument(tag)
 	message_content = nullptr;
 	current_index = 0;
 
+	SetNeedsUpdate(true);
+
 	// Set up the log type buttons.
 	log_types[Log::LT_ALWAYS].visible = true;
 	log_types[Log::LT_ALWAYS].class_name = "error";
@@ -196,8 +198,6 @@ void ElementLog::AddLogMessage(Log::Type type, const String& message)
 
 void ElementLog::OnUpdate()
 {
-	ElementDocument::OnUpdate();
-
 	if (dirty_logs)
 	{
 		// Set the log content:
@@ -32,18 +32,97 @@
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/MeshUtilities.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/RenderManager.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <future>
 #include <rlottie.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define RMLUI_LOTTIE_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#include <arm_neon.h>
+	#define RMLUI_LOTTIE_NEON
+#endif
+
 namespace Rml {
 
-ElementLottie::ElementLottie(const String& tag) : Element(tag) {}
+namespace Lottie {
+	// A rendered animation frame, with one word per pixel in RmlUi's RGBA byte order. The texture is generated from the pixels when the frame
+	// is first rendered, and kept with the frame so that it can be displayed again from the frame cache without another upload.
+	struct FrameData {
+		size_t index = 0;
+		Vector2i dimensions;
+		UniquePtr<uint32_t[]> pixels;
+		CallbackTexture texture;
+		uint64_t last_used = 0;
+	};
 
-ElementLottie::~ElementLottie() {}
+	// An animation frame being rendered in the background, the frame data is written to until the result is ready.
+	struct FrameRender {
+		SharedPtr<FrameData> frame;
+		std::future<rlottie::Surface> result;
+	};
+} // namespace Lottie
+
+// Converts the pixels from rlottie's native ARGB words to RmlUi's RGBA byte order, by swapping the red and blue bytes of each word. Like
+// the rest of the library, assumes a little-endian host.
+static void ConvertToRGBA(uint32_t* pixels, size_t num_pixels)
+{
+	size_t i = 0;
+#if defined(RMLUI_LOTTIE_SSE2)
+	const __m128i mask_alpha_green = _mm_set1_epi32(int(0xff00ff00u));
+	const __m128i mask_low_byte = _mm_set1_epi32(0xff);
+	for (; i + 4 <= num_pixels; i += 4)
+	{
+		const __m128i pixel = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+		const __m128i red_blue = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(pixel, 16), mask_low_byte),
+			_mm_slli_epi32(_mm_and_si128(pixel, mask_low_byte), 16));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm_or_si128(_mm_and_si128(pixel, mask_alpha_green), red_blue));
+	}
+#elif defined(RMLUI_LOTTIE_NEON)
+	const uint32x4_t mask_alpha_green = vdupq_n_u32(0xff00ff00u);
+	const uint32x4_t mask_low_byte = vdupq_n_u32(0xffu);
+	for (; i + 4 <= num_pixels; i += 4)
+	{
+		const uint32x4_t pixel = vld1q_u32(pixels + i);
+		const uint32x4_t red_blue = vorrq_u32(vandq_u32(vshrq_n_u32(pixel, 16), mask_low_byte), vshlq_n_u32(vandq_u32(pixel, mask_low_byte), 16));
+		vst1q_u32(pixels + i, vorrq_u32(vandq_u32(pixel, mask_alpha_green), red_blue));
+	}
+#endif
+	for (; i < num_pixels; i++)
+	{
+		const uint32_t pixel = pixels[i];
+		pixels[i] = (pixel & 0xff00ff00u) | ((pixel >> 16) & 0xffu) | ((pixel & 0xffu) << 16);
+	}
+
+#ifdef RMLUI_DEBUG
+	const byte* p_data = reinterpret_cast<const byte*>(pixels);
+	for (size_t i = 0; i < num_pixels * 4; i += 4)
+	{
+		const byte alpha = p_data[i + 3];
+		for (int c = 0; c < 3; c++)
+			RMLUI_ASSERTMSG(p_data[i + c] <= alpha, "Glyph data is assumed to be encoded in premultiplied alpha, but that is not the case.");
+	}
+#endif
+}
+
+ElementLottie::ElementLottie(const String& tag) : Element(tag)
+{
+	SetNeedsUpdate(true);
+}
+
+ElementLottie::~ElementLottie()
+{
+	// The background render refers to the animation, make sure it is done before the animation is destroyed.
+	CancelFrameRender();
+}
 
 bool ElementLottie::GetIntrinsicDimensions(Vector2f& dimensions, float& ratio)
 {
@@ -88,14 +167,14 @@ void ElementLottie::OnRender()
 			GenerateGeometry();
 
 		UpdateTexture();
-		geometry.Render(GetAbsoluteOffset(BoxArea::Content).Round(), texture);
+		if (frame)
+			geometry.Render(GetAbsoluteOffset(BoxArea::Content).Round(), frame->texture);
 	}
 }
 
 void ElementLottie::OnResize()
 {
 	geometry_dirty = true;
-	texture_size_dirty = true;
 }
 
 void ElementLottie::OnAttributeChange(const ElementAttributes& changed_attributes)
@@ -107,6 +186,12 @@ void ElementLottie::OnAttributeChange(const ElementAttributes& changed_attribute
 		animation_dirty = true;
 		DirtyLayout();
 	}
+
+	if (changed_attributes.count("frame-cache"))
+	{
+		frame_cache_capacity = Math::Max(GetAttribute<int>("frame-cache", 0), 0);
+		TrimFrameCache(frame_cache_capacity);
+	}
 }
 
 void ElementLottie::OnPropertyChange(const PropertyIdSet& changed_properties)
@@ -138,9 +223,10 @@ bool ElementLottie::LoadAnimation()
 {
 	animation_dirty = false;
 	intrinsic_dimensions = Vector2f{};
-	texture = {};
+	CancelFrameRender();
+	frame.reset();
+	frame_cache.clear();
 	animation.reset();
-	prev_animation_frame = size_t(-1);
 	time_animation_start = -1;
 
 	const String attribute_src = GetAttribute<String>("src", "");
@@ -191,6 +277,23 @@ void ElementLottie::UpdateTexture()
 	if (!render_manager)
 		return;
 
+	// Pick up the result of the background render once it is done, without waiting for it.
+	if (frame_render && frame_render->result.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+	{
+		frame_render->result.get();
+		SharedPtr<Lottie::FrameData> rendered_frame = std::move(frame_render->frame);
+		frame_render.reset();
+
+		ConvertToRGBA(rendered_frame->pixels.get(), size_t(rendered_frame->dimensions.x) * size_t(rendered_frame->dimensions.y));
+		SetFrame(std::move(rendered_frame));
+	}
+
+	if (frame_cache_dimensions != render_dimensions)
+	{
+		frame_cache.clear();
+		frame_cache_dimensions = render_dimensions;
+	}
+
 	const double t = GetSystemInterface()->GetElapsedTime();
 
 	// Find the next animation frame to display.
@@ -200,56 +303,102 @@ void ElementLottie::UpdateTexture()
 	const double pos = std::modf((t - time_animation_start) / animation->duration(), &_unused);
 
 	const size_t next_frame = animation->frameAtPos(pos);
-	if (!texture_size_dirty && next_frame == prev_animation_frame)
+	if (frame && frame->index == next_frame && frame->dimensions == render_dimensions)
 	{
 		// No need to update the texture if we are drawing the same frame at the same size.
 		return;
 	}
 
-	// Resize the texture buffer if necessary.
-	const size_t new_texture_data_size = 4 * render_dimensions.x * render_dimensions.y;
-	if (new_texture_data_size > texture_data_size)
+	auto it_cached_frame = frame_cache.find(next_frame);
+	if (it_cached_frame != frame_cache.end())
 	{
-		texture_data.reset(new byte[new_texture_data_size]);
-		texture_data_size = new_texture_data_size;
+		SetFrame(it_cached_frame->second);
+		return;
 	}
 
-	// Callback for generating texture.
-	auto texture_callback = [this, next_frame](const CallbackTextureInterface& texture_interface) -> bool {
-		RMLUI_ASSERT(animation);
+	// Keep displaying the current frame while the next one is being rendered. If we are still waiting for a previous frame, the next frame
+	// is started once that one is done.
+	if (!frame_render)
+		StartFrameRender(next_frame);
 
-		const size_t bytes_per_line = 4 * render_dimensions.x;
-		const size_t total_bytes = bytes_per_line * render_dimensions.y;
-		byte* p_data = texture_data.get();
+	if (Context* ctx = GetContext())
+		ctx->RequestNextUpdate(0);
+}
 
-		rlottie::Surface surface(reinterpret_cast<uint32_t*>(p_data), render_dimensions.x, render_dimensions.y, bytes_per_line);
-		animation->renderSync(next_frame, surface);
+void ElementLottie::StartFrameRender(size_t frame_index)
+{
+	RMLUI_ASSERT(animation && !frame_render);
+	if (render_dimensions.x <= 0 || render_dimensions.y <= 0)
+		return;
 
-		// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA.
-		for (size_t i = 0; i < total_bytes; i += 4)
-		{
-			// Swap the RB order for correct color channels.
-			std::swap(p_data[i], p_data[i + 2]);
+	auto rendered_frame = MakeShared<Lottie::FrameData>();
+	rendered_frame->index = frame_index;
+	rendered_frame->dimensions = render_dimensions;
+	rendered_frame->pixels.reset(new uint32_t[size_t(render_dimensions.x) * size_t(render_dimensions.y)]);
 
-#ifdef RMLUI_DEBUG
-			const byte alpha = p_data[i + 3];
-			for (int c = 0; c < 3; c++)
-				RMLUI_ASSERTMSG(p_data[i + c] <= alpha, "Glyph data is assumed to be encoded in premultiplied alpha, but that is not the case.");
-#endif
-		}
-
-		if (!texture_interface.GenerateTexture({p_data, total_bytes}, render_dimensions))
-		{
-			Log::Message(Rml::Log::Type::LT_WARNING, "Could not generate texture for lottie animation: %s", GetAttribute<String>("src", "").c_str());
-			return false;
-		}
-		return true;
-	};
+	const size_t bytes_per_line = 4 * render_dimensions.x;
+	rlottie::Surface surface(rendered_frame->pixels.get(), render_dimensions.x, render_dimensions.y, bytes_per_line);
+
+	frame_render = MakeUnique<Lottie::FrameRender>();
+	frame_render->result = animation->render(frame_index, surface);
+	frame_render->frame = std::move(rendered_frame);
+}
+
+void ElementLottie::CancelFrameRender()
+{
+	if (!frame_render)
+		return;
+
+	if (frame_render->result.valid())
+		frame_render->result.wait();
+	frame_render.reset();
+}
 
-	texture = render_manager->MakeCallbackTexture(std::move(texture_callback));
+void ElementLottie::SetFrame(SharedPtr<Lottie::FrameData> new_frame)
+{
+	RenderManager* render_manager = GetRenderManager();
+	if (!render_manager)
+		return;
+
+	if (!new_frame->texture)
+	{
+		// Callback for generating the texture, uploads the completed frame data without any further processing. The texture is owned by
+		// the frame, thus the frame data stays valid for as long as the callback can be called.
+		const Lottie::FrameData* frame_data = new_frame.get();
+		auto texture_callback = [this, frame_data](const CallbackTextureInterface& texture_interface) -> bool {
+			const size_t total_bytes = 4 * size_t(frame_data->dimensions.x) * size_t(frame_data->dimensions.y);
+			if (!texture_interface.GenerateTexture({reinterpret_cast<const byte*>(frame_data->pixels.get()), total_bytes}, frame_data->dimensions))
+			{
+				Log::Message(Rml::Log::Type::LT_WARNING, "Could not generate texture for lottie animation: %s",
+					GetAttribute<String>("src", "").c_str());
+				return false;
+			}
+			return true;
+		};
+
+		new_frame->texture = render_manager->MakeCallbackTexture(std::move(texture_callback));
+	}
+
+	frame_use_counter += 1;
+	new_frame->last_used = frame_use_counter;
 
-	prev_animation_frame = next_frame;
-	texture_size_dirty = false;
+	if (frame_cache_capacity > 0 && new_frame->dimensions == frame_cache_dimensions && frame_cache.count(new_frame->index) == 0)
+	{
+		TrimFrameCache(frame_cache_capacity - 1);
+		frame_cache.emplace(new_frame->index, new_frame);
+	}
+
+	frame = std::move(new_frame);
+}
+
+void ElementLottie::TrimFrameCache(int max_num_frames)
+{
+	while (!frame_cache.empty() && int(frame_cache.size()) > max_num_frames)
+	{
+		auto it_least_recent = std::min_element(frame_cache.begin(), frame_cache.end(),
+			[](const auto& a, const auto& b) { return a.second->last_used < b.second->last_used; });
+		frame_cache.erase(it_least_recent);
+	}
 }
 
 } // namespace Rml
@@ -30,21 +30,25 @@
 #include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
-#include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/MeshUtilities.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/RenderManager.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
-#include <cmath>
-#include <lunasvg.h>
-#include <string.h>
+#include "SVGCache.h"
 
 namespace Rml {
 
-ElementSVG::ElementSVG(const String& tag) : Element(tag) {}
+ElementSVG::ElementSVG(const String& tag) : Element(tag)
+{
+	// Only needs to be visited during the update loop when changed.
+	SetNeedsUpdate(false);
+}
 
-ElementSVG::~ElementSVG() {}
+ElementSVG::~ElementSVG()
+{
+	ReleaseSource();
+}
 
 bool ElementSVG::GetIntrinsicDimensions(Vector2f& dimensions, float& ratio)
 {
@@ -76,7 +80,8 @@ void ElementSVG::OnRender()
 			GenerateGeometry();
 
 		UpdateTexture();
-		geometry.Render(GetAbsoluteOffset(BoxArea::Content), Texture(texture));
+		if (texture)
+			geometry.Render(GetAbsoluteOffset(BoxArea::Content), texture->texture_source.GetTexture(*GetRenderManager()));
 	}
 }
 
@@ -132,8 +137,7 @@ bool ElementSVG::LoadSource()
 	source_dirty = false;
 	texture_dirty = true;
 	intrinsic_dimensions = Vector2f{};
-	texture = {};
-	svg_document.reset();
+	ReleaseSource();
 
 	const String attribute_src = GetAttribute<String>("src", "");
 
@@ -141,34 +145,18 @@ bool ElementSVG::LoadSource()
 		return false;
 
 	String path = attribute_src;
-	String directory;
 
 	if (ElementDocument* document = GetOwnerDocument())
 	{
 		const String document_source_url = StringUtilities::Replace(document->GetSourceURL(), '|', ':');
 		GetSystemInterface()->JoinPath(path, document_source_url, attribute_src);
-		GetSystemInterface()->JoinPath(directory, document_source_url, "");
 	}
 
-	String svg_data;
-
-	if (path.empty() || !GetFileInterface()->LoadFile(path, svg_data))
-	{
-		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG file %s", path.c_str());
-		return false;
-	}
-
-	// We use a reset-release approach here in case clients use a non-std unique_ptr (lunasvg uses std::unique_ptr)
-	svg_document.reset(lunasvg::Document::loadFromData(svg_data).release());
-
+	svg_document = SVG::SVGCache::AcquireDocument(path);
 	if (!svg_document)
-	{
-		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG data from file %s", path.c_str());
 		return false;
-	}
 
-	intrinsic_dimensions.x = Math::Max(float(svg_document->width()), 1.0f);
-	intrinsic_dimensions.y = Math::Max(float(svg_document->height()), 1.0f);
+	intrinsic_dimensions = svg_document->intrinsic_dimensions;
 
 	return true;
 }
@@ -178,36 +166,28 @@ void ElementSVG::UpdateTexture()
 	if (!svg_document || !texture_dirty)
 		return;
 
-	RenderManager* render_manager = GetRenderManager();
-	if (!render_manager)
-		return;
-
-	// Callback for generating texture.
-	auto texture_callback = [this](const CallbackTextureInterface& texture_interface) -> bool {
-		RMLUI_ASSERT(svg_document);
-		lunasvg::Bitmap bitmap = svg_document->renderToBitmap(render_dimensions.x, render_dimensions.y);
-		if (!bitmap.valid() || !bitmap.data())
-		{
-			Log::Message(Rml::Log::Type::LT_WARNING, "Could not render SVG to bitmap: %s", GetAttribute<String>("src", "").c_str());
-			return false;
-		}
-
-		// Swap red and blue channels, assuming LunaSVG v2.3.2 or newer, to convert to RmlUi's expected RGBA-ordering.
-		const size_t bitmap_byte_size = bitmap.width() * bitmap.height() * 4;
-		uint8_t* bitmap_data = bitmap.data();
-		for (size_t i = 0; i < bitmap_byte_size; i += 4)
-			std::swap(bitmap_data[i], bitmap_data[i + 2]);
-
-		if (!texture_interface.GenerateTexture({reinterpret_cast<const Rml::byte*>(bitmap.data()), bitmap_byte_size}, render_dimensions))
-		{
-			Log::Message(Rml::Log::Type::LT_WARNING, "Could not generate texture for SVG: %s", GetAttribute<String>("src", "").c_str());
-			return false;
-		}
-		return true;
-	};
-
-	texture = render_manager->MakeCallbackTexture(std::move(texture_callback));
+	ReleaseTexture();
+	texture = SVG::SVGCache::AcquireTexture(svg_document, render_dimensions);
 	texture_dirty = false;
 }
 
+void ElementSVG::ReleaseSource()
+{
+	ReleaseTexture();
+	if (svg_document)
+	{
+		SVG::SVGCache::ReleaseDocument(svg_document);
+		svg_document = nullptr;
+	}
+}
+
+void ElementSVG::ReleaseTexture()
+{
+	if (texture)
+	{
+		SVG::SVGCache::ReleaseTexture(texture);
+		texture = nullptr;
+	}
+}
+
 } // namespace Rml
@@ -0,0 +1,208 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "SVGCache.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../Core/ControlledLifetimeResource.h"
+#include <algorithm>
+#include <lunasvg.h>
+
+namespace Rml {
+namespace SVG {
+
+	struct SVGCacheData {
+		UnorderedMap<String, UniquePtr<SVGDocument>> documents;
+		int num_document_loads = 0;
+		int num_texture_renders = 0;
+	};
+
+	static ControlledLifetimeResource<SVGCacheData> cache_data;
+
+	SVGDocument::SVGDocument() = default;
+	SVGDocument::~SVGDocument() = default;
+
+	void SVGCache::Initialize()
+	{
+		cache_data.Initialize();
+	}
+
+	void SVGCache::Shutdown()
+	{
+		cache_data.Shutdown();
+	}
+
+	SVGDocument* SVGCache::AcquireDocument(const String& path)
+	{
+		auto it = cache_data->documents.find(path);
+		if (it != cache_data->documents.end())
+		{
+			it->second->reference_count += 1;
+			return it->second.get();
+		}
+
+		String svg_data;
+
+		if (path.empty() || !GetFileInterface()->LoadFile(path, svg_data))
+		{
+			Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG file %s", path.c_str());
+			return nullptr;
+		}
+
+		auto document = MakeUnique<SVGDocument>();
+
+		// We use a reset-release approach here in case clients use a non-std unique_ptr (lunasvg uses std::unique_ptr)
+		document->document.reset(lunasvg::Document::loadFromData(svg_data).release());
+		cache_data->num_document_loads += 1;
+
+		if (!document->document)
+		{
+			Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG data from file %s", path.c_str());
+			return nullptr;
+		}
+
+		document->path = path;
+		document->intrinsic_dimensions.x = Math::Max(float(document->document->width()), 1.0f);
+		document->intrinsic_dimensions.y = Math::Max(float(document->document->height()), 1.0f);
+		document->source_size = svg_data.size();
+		document->reference_count = 1;
+
+		SVGDocument* result = document.get();
+		cache_data->documents.emplace(path, std::move(document));
+		return result;
+	}
+
+	void SVGCache::ReleaseDocument(SVGDocument* document)
+	{
+		RMLUI_ASSERT(document && document->reference_count > 0);
+		document->reference_count -= 1;
+		if (document->reference_count == 0)
+		{
+			RMLUI_ASSERTMSG(document->textures.empty(), "SVG document released while its textures are still in use.");
+			cache_data->documents.erase(document->path);
+		}
+	}
+
+	SVGTexture* SVGCache::AcquireTexture(SVGDocument* document, Vector2i dimensions)
+	{
+		RMLUI_ASSERT(document);
+		auto it = std::find_if(document->textures.begin(), document->textures.end(),
+			[&](const UniquePtr<SVGTexture>& texture) { return texture->dimensions == dimensions; });
+		if (it != document->textures.end())
+		{
+			(*it)->reference_count += 1;
+			return it->get();
+		}
+
+		auto texture = MakeUnique<SVGTexture>();
+		texture->document = document;
+		texture->dimensions = dimensions;
+		texture->reference_count = 1;
+
+		// Callback for generating the texture, the texture entry outlives any render manager's use of it.
+		SVGTexture* texture_ptr = texture.get();
+		texture->texture_source = CallbackTextureSource([texture_ptr](const CallbackTextureInterface& texture_interface) -> bool {
+			const SVGDocument* document = texture_ptr->document;
+			const Vector2i dimensions = texture_ptr->dimensions;
+			RMLUI_ASSERT(document->document);
+
+			lunasvg::Bitmap bitmap = document->document->renderToBitmap(dimensions.x, dimensions.y);
+			cache_data->num_texture_renders += 1;
+			if (!bitmap.valid() || !bitmap.data())
+			{
+				Log::Message(Rml::Log::Type::LT_WARNING, "Could not render SVG to bitmap: %s", document->path.c_str());
+				return false;
+			}
+
+			// Swap red and blue channels, assuming LunaSVG v2.3.2 or newer, to convert to RmlUi's expected RGBA-ordering.
+			const size_t bitmap_byte_size = bitmap.width() * bitmap.height() * 4;
+			uint8_t* bitmap_data = bitmap.data();
+			for (size_t i = 0; i < bitmap_byte_size; i += 4)
+				std::swap(bitmap_data[i], bitmap_data[i + 2]);
+
+			if (!texture_interface.GenerateTexture({reinterpret_cast<const Rml::byte*>(bitmap.data()), bitmap_byte_size}, dimensions))
+			{
+				Log::Message(Rml::Log::Type::LT_WARNING, "Could not generate texture for SVG: %s", document->path.c_str());
+				return false;
+			}
+			return true;
+		});
+
+		document->reference_count += 1;
+		document->textures.push_back(std::move(texture));
+		return texture_ptr;
+	}
+
+	void SVGCache::ReleaseTexture(SVGTexture* texture)
+	{
+		RMLUI_ASSERT(texture && texture->reference_count > 0);
+		texture->reference_count -= 1;
+		if (texture->reference_count > 0)
+			return;
+
+		SVGDocument* document = texture->document;
+		auto it = std::find_if(document->textures.begin(), document->textures.end(),
+			[texture](const UniquePtr<SVGTexture>& entry) { return entry.get() == texture; });
+		RMLUI_ASSERT(it != document->textures.end());
+		document->textures.erase(it);
+
+		// Each texture holds a reference to its document.
+		ReleaseDocument(document);
+	}
+
+	CacheStatistics SVGCache::GetStatistics()
+	{
+		CacheStatistics statistics;
+		statistics.num_document_loads = cache_data->num_document_loads;
+		statistics.num_texture_renders = cache_data->num_texture_renders;
+
+		for (const auto& document_pair : cache_data->documents)
+		{
+			const SVGDocument& document = *document_pair.second;
+			statistics.num_documents += 1;
+			statistics.document_source_bytes += document.source_size;
+
+			for (const UniquePtr<SVGTexture>& texture : document.textures)
+			{
+				statistics.num_textures += 1;
+				statistics.texture_bytes += size_t(texture->dimensions.x) * size_t(texture->dimensions.y) * 4;
+			}
+		}
+
+		return statistics;
+	}
+
+	CacheStatistics GetCacheStatistics()
+	{
+		return SVGCache::GetStatistics();
+	}
+
+} // namespace SVG
+} // namespace Rml
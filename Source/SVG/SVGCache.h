@@ -0,0 +1,94 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_SVG_SVGCACHE_H
+#define RMLUI_SVG_SVGCACHE_H
+
+#include "../../Include/RmlUi/Core/CallbackTexture.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/SVG/SVGCache.h"
+
+namespace lunasvg {
+class Document;
+}
+
+namespace Rml {
+namespace SVG {
+
+	struct SVGDocument;
+
+	// A rasterization of a document at a given size, shared by all elements rendering the same document at the same size.
+	struct SVGTexture {
+		SVGDocument* document = nullptr;
+		Vector2i dimensions;
+		CallbackTextureSource texture_source;
+		int reference_count = 0;
+	};
+
+	// A parsed document, shared by all elements referring to the same source path.
+	struct SVGDocument {
+		SVGDocument();
+		~SVGDocument();
+
+		String path;
+		UniquePtr<lunasvg::Document> document;
+		Vector2f intrinsic_dimensions;
+		size_t source_size = 0;
+		int reference_count = 0;
+
+		Vector<UniquePtr<SVGTexture>> textures;
+	};
+
+	/**
+	    Shares parsed SVG documents and their rasterized textures between elements.
+
+	    Documents are keyed by their resolved source path, and textures by their document and pixel dimensions. Each acquired document
+	    and texture is reference counted, and released from the cache as soon as its last user releases it.
+	 */
+	class SVGCache {
+	public:
+		static void Initialize();
+		static void Shutdown();
+
+		/// Returns the document at the given path, only loading and parsing the file if it is not already cached.
+		/// @return The shared document, or nullptr if it could not be loaded. Must be handed back using ReleaseDocument().
+		static SVGDocument* AcquireDocument(const String& path);
+		static void ReleaseDocument(SVGDocument* document);
+
+		/// Returns the texture rendering the document at the given dimensions, only rasterizing the document if no such texture is cached.
+		/// @return The shared texture. Must be handed back using ReleaseTexture().
+		static SVGTexture* AcquireTexture(SVGDocument* document, Vector2i dimensions);
+		static void ReleaseTexture(SVGTexture* texture);
+
+		static CacheStatistics GetStatistics();
+	};
+
+} // namespace SVG
+} // namespace Rml
+
+#endif
@@ -31,6 +31,8 @@
 #include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/StreamMemory.h>
 #include <doctest.h>
 #include <nanobench.h>
 
@@ -245,3 +247,170 @@ TEST_CASE("data_binding")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String grow_list_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; font-size: 14px; width: 800px; height: 600px; overflow: auto; }
+		.row span { display: inline-block; width: 100px; }
+	</style>
+</head>
+<body>
+<div data-model="grow_list">
+	<div class="row" data-for="row : rows"><span class="index">{{ it_index }}</span><span class="name">{{ row.name }}</span><span class="value">{{ row.value }}</span><input type="checkbox" data-checked="row.checked"/></div>
+</div>
+<div id="reference"></div>
+</body>
+</rml>
+)";
+
+static const String grow_list_row_rml =
+	R"(<span class="index">1</span><span class="name">Name</span><span class="value">10</span><input type="checkbox" checked/>)";
+
+struct GrowListRow {
+	String name;
+	int value = 0;
+	bool checked = false;
+};
+
+TEST_CASE("data_binding.grow_list")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<GrowListRow> rows;
+	DataModelHandle model_handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("grow_list");
+		REQUIRE(constructor);
+		if (auto handle = constructor.RegisterStruct<GrowListRow>())
+		{
+			handle.RegisterMember("name", &GrowListRow::name);
+			handle.RegisterMember("value", &GrowListRow::value);
+			handle.RegisterMember("checked", &GrowListRow::checked);
+		}
+		constructor.RegisterArray<Vector<GrowListRow>>();
+		constructor.Bind("rows", &rows);
+		model_handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(grow_list_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* reference = document->GetElementById("reference");
+	REQUIRE(reference);
+
+	nanobench::Bench bench;
+	bench.title("Data bindings: Grow list by 1k rows");
+	bench.relative(true);
+	bench.minEpochIterations(2);
+
+	// Parsing the row contents from source each time, as done without the pre-parsed fragment cache.
+	bench.run("Reference (parse rows)", [&] {
+		for (int i = 0; i < 1000; i++)
+		{
+			Element* row = reference->AppendChild(document->CreateElement("div"));
+			const String source = "<body>" + grow_list_row_rml + "</body>";
+			StreamMemory stream(reinterpret_cast<const byte*>(source.data()), source.size());
+			Factory::InstanceElementStream(row, &stream);
+		}
+		context->Update();
+		reference->SetInnerRML("");
+	});
+
+	bench.run("SetInnerRML rows", [&] {
+		for (int i = 0; i < 1000; i++)
+			reference->AppendChild(document->CreateElement("div"))->SetInnerRML(grow_list_row_rml);
+		context->Update();
+		reference->SetInnerRML("");
+	});
+
+	bench.run("data-for rows", [&] {
+		rows.resize(1000, GrowListRow{"Name", 10, true});
+		model_handle.DirtyVariable("rows");
+		context->Update();
+
+		rows.clear();
+		model_handle.DirtyVariable("rows");
+		context->Update();
+	});
+
+	document->Close();
+	context->RemoveDataModel("grow_list");
+
+	TestsShell::ShutdownShell();
+}
+
+static const String scoreboard_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; font-size: 14px; width: 800px; height: 600px; overflow: auto; }
+		.row { display: block; width: 400px; height: 20px; overflow: hidden; }
+		.row span { display: inline-block; width: 100px; }
+	</style>
+</head>
+<body>
+<div data-model="scoreboard">
+	<div class="row" data-for="row : rows"><span class="index">{{ it_index }}</span><span class="name">{{ row.name }}</span><span class="value">{{ row.value }}</span></div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("data_binding.scoreboard")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<GrowListRow> rows(1000, GrowListRow{"Name", 10, true});
+	DataModelHandle model_handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("scoreboard");
+		REQUIRE(constructor);
+		if (auto handle = constructor.RegisterStruct<GrowListRow>())
+		{
+			handle.RegisterMember("name", &GrowListRow::name);
+			handle.RegisterMember("value", &GrowListRow::value);
+			handle.RegisterMember("checked", &GrowListRow::checked);
+		}
+		constructor.RegisterArray<Vector<GrowListRow>>();
+		constructor.Bind("rows", &rows);
+		model_handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(scoreboard_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	nanobench::Bench bench;
+	bench.title("Data bindings: Change one cell of 1k rows");
+	bench.relative(true);
+
+	int index = 0;
+	bench.run("Dirty variable", [&] {
+		index = (index + 1) % (int)rows.size();
+		rows[index].value += 1;
+		model_handle.DirtyVariable("rows");
+		context->Update();
+	});
+
+	bench.run("Dirty address", [&] {
+		index = (index + 1) % (int)rows.size();
+		rows[index].value += 1;
+		model_handle.DirtyAddress(DataAddress{DataAddressEntry("rows"), DataAddressEntry(index), DataAddressEntry("value")});
+		context->Update();
+	});
+
+	document->Close();
+	context->RemoveDataModel("scoreboard");
+
+	TestsShell::ShutdownShell();
+}
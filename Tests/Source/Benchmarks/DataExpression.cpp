@@ -94,4 +94,44 @@ TEST_CASE("data_expressions")
 	bench_assignment("radius = 15", "Simple assign (parse)", "Simple assign (execute)");
 
 	bench_assignment("radius = radius*radius*3.14; color_name = 'image-color'", "Complex assign (parse)", "Complex assign (execute)");
+
+	// Measure evaluations per second over a mix of expressions, similar to a data model updating many views each frame.
+	const String evaluation_expressions[] = {
+		"2 * 2",
+		"radius * 2 + 1",
+		"radius > 10 ? 'large' : 'small'",
+		"color_name == 'color' && radius < 100",
+		"'Radius: ' + radius",
+		"(1 + 2) * 3 > 4 ? radius : 0",
+		"true || false ? true && radius==1+2 ? 'Absolutely!' : color_value : 'no'",
+	};
+
+	struct CompiledExpression {
+		Program program;
+		AddressList addresses;
+	};
+	Vector<CompiledExpression> compiled_expressions;
+	for (const String& expression : evaluation_expressions)
+	{
+		DataParser parser(expression, interface);
+		REQUIRE(parser.Parse(false));
+		compiled_expressions.push_back(CompiledExpression{parser.ReleaseProgram(), parser.ReleaseAddresses()});
+	}
+
+	nanobench::Bench bench_evaluations;
+	bench_evaluations.title("Data expression evaluations");
+	bench_evaluations.unit("evaluation");
+	bench_evaluations.batch(compiled_expressions.size());
+
+	bool evaluation_result = true;
+	bench_evaluations.run("Mixed expressions (execute)", [&] {
+		for (const CompiledExpression& compiled : compiled_expressions)
+		{
+			DataInterpreter interpreter(compiled.program, compiled.addresses, interface);
+			evaluation_result &= interpreter.Run();
+			nanobench::doNotOptimizeAway(interpreter.Result());
+		}
+	});
+
+	REQUIRE(evaluation_result);
 }
@@ -26,10 +26,12 @@
  *
  */
 
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StyleSharing.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 #include <nanobench.h>
@@ -315,3 +317,302 @@ TEST_CASE("element.asymptotic_complexity")
 
 	document->Close();
 }
+
+TEST_CASE("element.update_dirty_subtrees")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+
+	const char* row = R"(
+			<div class="row">
+				<div class="col col1"><span>Item %d</span></div>
+				<div class="col col23"><span>Description</span><span>%d</span></div>
+				<div class="col col4"><div>%d</div><div>%d</div></div>
+			</div>)";
+
+	{
+		nanobench::Bench bench;
+		bench.title("Update (unmodified)");
+		bench.timeUnit(std::chrono::microseconds(1), "us");
+		bench.relative(true);
+
+		// The cost of an idle update should not scale with the size of the tree.
+		for (const int num_rows : {10, 100, 1000, 2000})
+		{
+			el->SetInnerRML(GenerateRml(num_rows, row));
+			context->Update();
+			context->Render();
+
+			const String title = CreateString("Update (unmodified) - %d elements", GetNumDescendentElements(el));
+			bench.complexityN(num_rows).run(title, [&] { context->Update(); });
+		}
+	}
+
+	{
+		nanobench::Bench bench;
+		bench.title("Update (changed rows)");
+		bench.timeUnit(std::chrono::microseconds(1), "us");
+		bench.relative(true);
+
+		constexpr int num_rows = 2000;
+		el->SetInnerRML(GenerateRml(num_rows, row));
+		context->Update();
+		context->Render();
+
+		// Instead, the update cost should scale with the number of changed elements.
+		bool toggle = true;
+		for (const int num_changes : {1, 10, 100, 1000})
+		{
+			bench.complexityN(num_changes).run(CreateString("Update (%d changed rows)", num_changes), [&] {
+				const Property color = (toggle ? Property(Colourb(255, 0, 0), Unit::COLOUR) : Property(Colourb(0, 255, 0), Unit::COLOUR));
+				for (int i = 0; i < num_changes; i++)
+					el->GetChild(i * (num_rows / num_changes))->GetFirstChild()->GetFirstChild()->SetProperty(PropertyId::Color, color);
+				toggle = !toggle;
+				context->Update();
+			});
+		}
+	}
+
+	document->Close();
+}
+
+TEST_CASE("element.relayout_boundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+
+	// Rows with a fixed size and hidden overflow act as layout boundaries, changes inside them should not require a full document layout.
+	const char* row_plain = R"(
+			<div class="row">
+				<div class="col col1"><span>Item %d</span></div>
+				<div class="col col23"><span>Description</span><span>%d</span></div>
+				<div class="col col4"><div>%d</div><div>%d</div></div>
+			</div>)";
+	const char* row_boundary = R"(
+			<div class="row" style="width: 700px; height: 40px; overflow: hidden;">
+				<div class="col col1"><span>Item %d</span></div>
+				<div class="col col23"><span>Description</span><span>%d</span></div>
+				<div class="col col4"><div>%d</div><div>%d</div></div>
+			</div>)";
+
+	nanobench::Bench bench;
+	bench.title("Relayout (changed text)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	constexpr int num_rows = 1000;
+	for (const char* row : {row_plain, row_boundary})
+	{
+		el->SetInnerRML(GenerateRml(num_rows, row));
+		context->Update();
+		context->Render();
+
+		Element* text_parent = el->GetChild(num_rows / 2)->GetFirstChild()->GetFirstChild();
+		bool toggle = true;
+		const String title = (row == row_plain ? "Relayout - plain rows" : "Relayout - boundary rows");
+		bench.run(title, [&] {
+			text_parent->SetInnerRML(toggle ? "Item changed" : "Item");
+			toggle = !toggle;
+			context->Update();
+		});
+	}
+
+	document->Close();
+}
+
+TEST_CASE("element.render_culling")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+
+	// Only the rows inside the scroll view should be rendered, thus the number of render calls should not scale with the number of rows.
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+
+	nanobench::Bench bench;
+	bench.title("Render (long scroll view)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	for (const int num_rows : {10, 100, 1000})
+	{
+		el->SetInnerRML(GenerateRml(num_rows, DefaultRow));
+		context->Update();
+		context->Render();
+
+		size_t num_render_calls = 0;
+		if (render_interface)
+		{
+			render_interface->ResetCounters();
+			context->Render();
+			num_render_calls = render_interface->GetCounters().render_geometry;
+		}
+
+		const String title = CreateString("Render - %d rows, %zu RenderGeometry calls", num_rows, num_render_calls);
+		bench.complexityN(num_rows).run(title, [&] { context->Render(); });
+	}
+
+	document->Close();
+}
+
+TEST_CASE("element.render_cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+	el->SetInnerRML(GenerateRml(100, DefaultRow));
+
+	nanobench::Bench bench;
+	bench.title("Render (static document)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	for (const bool enable_cache : {false, true})
+	{
+		context->EnableRenderCache(enable_cache);
+		context->Update();
+		context->Render();
+
+		bench.run(enable_cache ? "Render - replay cached commands" : "Render - traverse elements", [&] {
+			context->Update();
+			context->Render();
+		});
+	}
+
+	context->EnableRenderCache(false);
+	document->Close();
+}
+
+static const String hit_testing_rml = R"(
+<rml>
+<head>
+	<style>
+		body { width: 800px; }
+		.icon { float: left; width: 6px; height: 6px; margin: 1px; }
+		.icon:hover { background-color: #f00; }
+	</style>
+</head>
+<body/>
+</rml>
+)";
+
+TEST_CASE("element.hit_testing")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	nanobench::Bench bench;
+	bench.title("Hit testing (grid of hoverable icons)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	for (const int num_icons : {100, 1000, 10000})
+	{
+		ElementDocument* document = context->LoadDocumentFromMemory(hit_testing_rml);
+		REQUIRE(document);
+
+		String rml;
+		for (int i = 0; i < num_icons; i++)
+			rml += "<div class=\"icon\"/>";
+		document->SetInnerRML(rml);
+		document->Show();
+		context->Update();
+
+		int i = 0;
+		bench.complexityN(num_icons).run(CreateString("Mouse move - %d icons", num_icons), [&] {
+			i = (i + 1) % 64;
+			context->ProcessMouseMove(4 + 37 * i % 200, 4 + 8 * i, 0);
+		});
+
+		document->Close();
+		context->Update();
+	}
+}
+
+static const String style_sharing_rml = R"(
+<rml>
+<head>
+	<style>
+		body { width: 800px; height: 600px; overflow: hidden; font-family: LatoLatin; font-size: 14px; }
+		li { display: block; padding: 2px 0.5em; margin-bottom: 1px; border-bottom: 1px #ccc; line-height: 1.2; }
+		li.odd { background-color: #eee; }
+	</style>
+</head>
+<body>
+<ul id="list"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("element.style_sharing")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(style_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("list");
+	REQUIRE(el);
+
+	nanobench::Bench bench;
+	bench.title("Style sharing (list rows)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	for (const int num_rows : {100, 500, 2000})
+	{
+		String rml;
+		for (int i = 0; i < num_rows; i++)
+			rml += CreateString("<li%s>Item %d</li>", i % 2 ? " class=\"odd\"" : "", i);
+
+		const StyleSharingStatistics stats_before = GetStyleSharingStatistics();
+
+		bench.complexityN(num_rows).run(CreateString("SetInnerRML + Update - %d rows", num_rows), [&] {
+			el->SetInnerRML(rml);
+			context->Update();
+		});
+
+		// Changing an inherited property recomputes the values of every row, without affecting the layout.
+		bool toggle = true;
+		bench.complexityN(num_rows).run(CreateString("Update (inherited property changed) - %d rows", num_rows), [&] {
+			el->SetProperty(PropertyId::Color, Property(toggle ? Colourb(255, 0, 0) : Colourb(0, 0, 255), Unit::COLOUR));
+			toggle = !toggle;
+			context->Update();
+		});
+
+		const StyleSharingStatistics stats_after = GetStyleSharingStatistics();
+		const size_t num_hits = stats_after.num_hits - stats_before.num_hits;
+		const size_t num_misses = stats_after.num_misses - stats_before.num_misses;
+		MESSAGE("Style sharing hit rate with " << num_rows << " rows: " << 100.0 * double(num_hits) / double(num_hits + num_misses) << "%");
+	}
+
+	document->Close();
+}
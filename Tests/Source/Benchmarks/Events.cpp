@@ -0,0 +1,150 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/Types.h>
+#include <cstdlib>
+#include <doctest.h>
+#include <nanobench.h>
+#include <new>
+
+using namespace ankerl;
+using namespace Rml;
+
+// Count heap allocations made through the global operator new, which also covers the library when it is linked statically.
+static size_t num_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+	num_allocations += 1;
+	if (void* ptr = std::malloc(size ? size : 1))
+		return ptr;
+	throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+	std::free(ptr);
+}
+
+static const String document_events_rml = R"(
+<rml>
+<head>
+	<style>
+		body { left: 0; top: 0; width: 400px; height: 200px; }
+		div { display: block; }
+		.branch { float: left; width: 200px; height: 200px; }
+		.branch div { height: 100%; }
+	</style>
+</head>
+<body>
+<div class="branch" id="left"/>
+<div class="branch" id="right"/>
+</body>
+</rml>
+)";
+
+class CountingListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override
+	{
+		num_events += 1;
+		mouse_x = event.GetParameter("mouse_x", 0);
+	}
+
+	int num_events = 0;
+	int mouse_x = 0;
+};
+
+TEST_CASE("events.mousemove")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_events_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// Give each branch a deep hover chain.
+	String rml;
+	for (int i = 0; i < 20; i++)
+		rml += "<div>";
+	for (int i = 0; i < 20; i++)
+		rml += "</div>";
+	document->GetElementById("left")->SetInnerRML(rml);
+	document->GetElementById("right")->SetInnerRML(rml);
+
+	CountingListener listener;
+	for (EventId id : {EventId::Mousemove, EventId::Mouseover, EventId::Mouseout})
+		document->AddEventListener(id, &listener);
+
+	context->Update();
+	context->Render();
+
+	nanobench::Bench bench;
+	bench.title("Mouse move events");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	struct Case {
+		const char* name;
+		int x_step;
+	};
+	for (const Case& bench_case : {Case{"within element", 1}, Case{"between elements", 200}})
+	{
+		int i = 0;
+		auto MoveMouse = [&] {
+			i = (i + 1) % 2;
+			context->ProcessMouseMove(50 + i * bench_case.x_step, 50, 0);
+		};
+
+		// Measure the allocations per mouse move in steady state, after the first few moves.
+		for (int j = 0; j < 4; j++)
+			MoveMouse();
+		const size_t num_allocations_begin = num_allocations;
+		const int num_moves = 100;
+		for (int j = 0; j < num_moves; j++)
+			MoveMouse();
+		const double allocations_per_move = double(num_allocations - num_allocations_begin) / double(num_moves);
+
+		bench.run(CreateString("Mouse move %s - %.1f allocations per move", bench_case.name, allocations_per_move), MoveMouse);
+	}
+
+	for (EventId id : {EventId::Mousemove, EventId::Mouseover, EventId::Mouseout})
+		document->RemoveEventListener(id, &listener);
+
+	document->Close();
+	context->Update();
+}
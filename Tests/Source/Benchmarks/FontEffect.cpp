@@ -85,3 +85,35 @@ TEST_CASE("font_effect")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("font_effect.radius")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	for (const char* effect_name : {"blur", "outline", "glow"})
+	{
+		nanobench::Bench bench;
+		bench.title(CreateString("Font effect radius (%s)", effect_name));
+		bench.relative(true);
+
+		for (int effect_size : {1, 2, 4, 8, 16})
+		{
+			const String rml_document = CreateString(rml_font_effect_document.c_str(), effect_name, effect_size);
+
+			ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
+			document->Show();
+			context->Update();
+			context->Render();
+
+			bench.complexityN(effect_size).run(CreateString("%s %dpx", effect_name, effect_size), [&]() {
+				Rml::ReleaseFontResources();
+				context->Render();
+			});
+
+			document->Close();
+		}
+	}
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,122 @@
+﻿/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/Mesh.h>
+#include <RmlUi/Core/TextShapingContext.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String rml_font_engine_document = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			font-size: 16px;
+		}
+	</style>
+</head>
+<body>
+<p id="text">Text</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("font_engine")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_font_engine_document);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* element = document->GetElementById("text");
+	REQUIRE(element);
+
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	const FontFaceHandle font_face_handle = element->GetFontFaceHandle();
+	REQUIRE(font_face_handle);
+	const FontEffectsHandle font_effects_handle = font_engine_interface->PrepareFontEffects(font_face_handle, {});
+
+	const String language;
+	const TextShapingContext text_shaping_context{language};
+
+	struct TestCase {
+		const char* name;
+		const char* text;
+	};
+	const TestCase test_cases[] = {
+		{"ascii", "The quick brown fox jumps over the lazy dog. "},
+		{"latin-1", "Ærøskøbing, Zürich, Besançon, Málaga, Łódź, Göteborg. "},
+	};
+
+	nanobench::Bench bench;
+	bench.title("Font engine");
+	bench.timeUnit(std::chrono::nanoseconds(1), "ns");
+	bench.unit("character");
+
+	for (const TestCase& test_case : test_cases)
+	{
+		// Long enough to bypass the text run cache, so that every character is shaped.
+		String text;
+		while (text.size() < 1000)
+			text += test_case.text;
+		const int num_characters = (int)StringUtilities::LengthUTF8(text);
+
+		// Make sure all glyphs are generated before measuring.
+		TexturedMeshList mesh_list;
+		font_engine_interface->GenerateString(context->GetRenderManager(), font_face_handle, font_effects_handle, text, {}, {}, 1.f,
+			text_shaping_context, mesh_list);
+
+		bench.batch(num_characters).run(CreateString("GetStringWidth - %s", test_case.name), [&] {
+			const int width = font_engine_interface->GetStringWidth(font_face_handle, text, text_shaping_context);
+			nanobench::doNotOptimizeAway(width);
+		});
+
+		bench.batch(num_characters).run(CreateString("GenerateString - %s", test_case.name), [&] {
+			mesh_list.clear();
+			const int width = font_engine_interface->GenerateString(context->GetRenderManager(), font_face_handle, font_effects_handle, text, {},
+				{}, 1.f, text_shaping_context, mesh_list);
+			nanobench::doNotOptimizeAway(width);
+		});
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -213,9 +213,10 @@ TEST_CASE("Selectors")
 
 	// Benchmark the lookup of applicable style rules for elements.
 	//
-	// We do this by toggling a pseudo class on an element with a lot of descendent elements. This dirties the style definition for this and all
-	// descendent elements, requiring a lookup for applicable nodes on each of them. We repeat this benchmark with different combinations of unique
-	// "dummy" style rules added to the style sheet.
+	// We do this by toggling a pseudo class on an element with a lot of descendent elements. A rule using this pseudo class in a descendant position
+	// ensures that this dirties the style definition for this and all descendent elements, requiring a lookup for applicable nodes on each of them.
+	// We repeat this benchmark with different combinations of unique "dummy" style rules added to the style sheet.
+	const String invalidation_rule = "#performance:hover div { scrollbar-margin: 0px; }\n";
 
 	nanobench::Bench bench;
 	bench.title("Selector (rule name)");
@@ -250,11 +251,11 @@ TEST_CASE("Selectors")
 		const SelectorFlags selector_flags = SelectorFlags(i < NUM_COMBINATIONS ? i : NO_SELECTOR);
 		const String& complex_selector = (i < NUM_COMBINATIONS ? String() : complex_selectors[i - NUM_COMBINATIONS]);
 
-		String name, styles;
+		String name, styles = invalidation_rule;
 		if (reference)
 			name = "Reference (no style rules)";
 		else
-			styles = GenerateRCSS(selector_flags, complex_selector, name);
+			styles += GenerateRCSS(selector_flags, complex_selector, name);
 
 		const String compiled_document_rml = Rml::CreateString(document_rml_template, styles.c_str());
 
@@ -293,3 +294,126 @@ TEST_CASE("Selectors")
 		context->Update();
 	}
 }
+
+TEST_CASE("Selectors.hover_large_panel")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 200;
+	const String rml = GenerateRml(num_rows);
+
+	// Benchmark toggling pseudo-classes and classes on a panel with a lot of descendent elements. Only rules using the changed name in a
+	// descendant or sibling position should require the descendants to look up their applicable style rules again.
+
+	nanobench::Bench bench;
+	bench.title("Selector invalidation (large panel)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	const Vector<Pair<String, String>> rule_sets = {
+		{"No rules using the name", ""},
+		{"Subject rules only", "#performance:hover, #performance.highlight { scrollbar-margin: 1px; }"},
+		{"Descendant rules", "#performance:hover div, #performance.highlight div { scrollbar-margin: 1px; }"},
+	};
+
+	for (const auto& rule_set : rule_sets)
+	{
+		const String compiled_document_rml = Rml::CreateString(document_rml_template, rule_set.second.c_str());
+
+		ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+		document->Show();
+
+		Element* el = document->GetElementById("performance");
+		el->SetInnerRML(rml);
+		context->Update();
+		context->Render();
+
+		bool active = false;
+
+		bench.run(rule_set.first + " - toggle :hover", [&] {
+			active = !active;
+			el->SetPseudoClass("hover", active);
+			context->Update();
+		});
+
+		bench.run(rule_set.first + " - toggle class", [&] {
+			active = !active;
+			el->SetClass("highlight", active);
+			context->Update();
+		});
+
+		document->Close();
+		context->Update();
+	}
+}
+
+TEST_CASE("Selectors.deep_descendant")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int depth = 20;
+	constexpr int num_slots = 100;
+	constexpr int num_rules = 100;
+
+	// A deep tree of nested containers, with a grid of inventory slots at the bottom.
+	String rml;
+	for (int i = 0; i < depth; i++)
+		rml += CreateString("<div class=\"level%d\">", i);
+	rml += "<div class=\"inventory\">";
+	for (int i = 0; i < num_slots; i++)
+		rml += "<div class=\"slot\"><div class=\"icon\"/></div>";
+	rml += "</div>";
+	for (int i = 0; i < depth; i++)
+		rml += "</div>";
+
+	// Benchmark style rules with descendant combinators, where the subject matches but the required ancestors are mostly not present. Toggling
+	// the pseudo class dirties the style definition of all descendants, each of them requiring a lookup of their applicable style rules.
+
+	nanobench::Bench bench;
+	bench.title("Selector (deep descendant rules)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	const String invalidation_rule = "#performance:hover div { scrollbar-margin: 0px; }\n";
+
+	const Vector<Pair<String, String>> rule_patterns = {
+		{"Reference (no descendant rules)", ""},
+		{"Missing ancestor class", ".inventory%d .slot .icon { scrollbar-margin: 1px; }\n"},
+		{"Missing ancestor id", "#bag%d .slot .icon { scrollbar-margin: 1px; }\n"},
+		{"Missing ancestor tag", "tabset%d .slot .icon { scrollbar-margin: 1px; }\n"},
+		{"Present ancestors", ".level0 .slot:nth-child(%d) > .icon { scrollbar-margin: 1px; }\n"},
+	};
+
+	for (const auto& rule_pattern : rule_patterns)
+	{
+		String styles = invalidation_rule;
+		if (!rule_pattern.second.empty())
+		{
+			for (int i = 0; i < num_rules; i++)
+				styles += CreateString(rule_pattern.second.c_str(), i);
+		}
+
+		const String compiled_document_rml = Rml::CreateString(document_rml_template, styles.c_str());
+
+		ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+		document->Show();
+
+		Element* el = document->GetElementById("performance");
+		el->SetInnerRML(rml);
+		context->Update();
+		context->Render();
+
+		bool hover_active = false;
+
+		bench.run(rule_pattern.first, [&] {
+			hover_active = !hover_active;
+			el->SetPseudoClass("hover", hover_active);
+			context->Update();
+		});
+
+		document->Close();
+		context->Update();
+	}
+}
@@ -0,0 +1,145 @@
+﻿/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/Types.h>
+#include <RmlUi_Renderer_Software.h>
+#include <doctest.h>
+#include <nanobench.h>
+#include <thread>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String rml_software_effects_document = R"(
+<rml>
+<head>
+	<title>Effects</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { padding: 20px; width: auto; left: 0; right: 0; }
+		div {
+			display: inline-block;
+			width: 200px;
+			height: 150px;
+			margin: 20px;
+			border-radius: 20px;
+			background: #9ac;
+			color: #333;
+			font-size: 20px;
+		}
+		.linear { decorator: linear-gradient(45deg, #f00, #ff0 50%, #00f); }
+		.radial { decorator: radial-gradient(circle, #fff, #0a0 40%, transparent); }
+		.conic { decorator: repeating-conic-gradient(#fc0, #06c 30deg, #fc0 60deg); }
+		.shadow { box-shadow: #000a 10px 10px 20px 5px; }
+		.blur { filter: blur(5px); }
+		.drop-shadow { filter: drop-shadow(#a00 10px 10px 5px); }
+		.color { filter: sepia(0.5) hue-rotate(90deg) contrast(1.5); }
+		.transform { transform: perspective(400px) rotateY(30deg) rotate(10deg); }
+		.mask { mask-image: radial-gradient(circle, #fff 30%, transparent 70%); }
+		.clip { overflow: hidden; transform: rotate(15deg); }
+		.clip p { width: 300px; height: 300px; background: #c33; }
+	</style>
+</head>
+<body>
+	<div class="linear">Linear gradient</div>
+	<div class="radial">Radial gradient</div>
+	<div class="conic">Conic gradient</div>
+	<div class="shadow">Box shadow</div>
+	<div class="blur">Blur filter</div>
+	<div class="drop-shadow">Drop shadow</div>
+	<div class="color">Color filters</div>
+	<div class="transform">Transform</div>
+	<div class="mask">Mask image</div>
+	<div class="clip"><p>Clip mask</p></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("software_renderer")
+{
+	// Initialize the shell for the fonts and interfaces, but render using separate contexts with the software renderer.
+	Context* shell_context = TestsShell::GetContext();
+	REQUIRE(shell_context);
+	const Vector2i dimensions = shell_context->GetDimensions();
+
+	nanobench::Bench bench;
+	bench.title("Software renderer");
+	bench.unit("frame");
+	bench.relative(true);
+
+	// Compare single-threaded rendering to using all hardware threads, when more than one is available.
+	Vector<int> thread_counts = {1};
+	const int max_num_threads = (int)std::thread::hardware_concurrency();
+	if (max_num_threads > 1)
+		thread_counts.push_back(max_num_threads);
+
+	struct DocumentSource {
+		const char* name;
+		const char* path;
+	};
+	const DocumentSource sources[] = {
+		{"benchmark", "basic/benchmark/data/benchmark.rml"},
+		{"effects", nullptr},
+	};
+
+	for (const DocumentSource& source : sources)
+	{
+		for (int num_threads : thread_counts)
+		{
+			RenderInterface_Software render_interface(num_threads);
+			render_interface.SetViewport(dimensions.x, dimensions.y);
+
+			Context* context = Rml::CreateContext("software_renderer", dimensions, &render_interface);
+			REQUIRE(context);
+
+			ElementDocument* document =
+				(source.path ? context->LoadDocument(source.path) : context->LoadDocumentFromMemory(rml_software_effects_document));
+			REQUIRE(document);
+			document->Show();
+			context->Update();
+
+			bench.run(CreateString("%s (%d thread%s)", source.name, num_threads, num_threads == 1 ? "" : "s"), [&]() {
+				render_interface.BeginFrame();
+				context->Render();
+				render_interface.EndFrame();
+			});
+
+			// Release all render resources before the render interface is destroyed, including textures held by cached style sheets.
+			Rml::RemoveContext(context->GetName());
+			Rml::ReleaseRenderManagers();
+			Rml::Factory::ClearStyleSheetCache();
+		}
+	}
+
+	TestsShell::ShutdownShell();
+}
@@ -154,6 +154,49 @@ TEST_CASE("WidgetTextInput")
 		}
 	}
 
+	SUBCASE("LargeDocument")
+	{
+		bench.title("WidgetTextInput.LargeDocument");
+		bench.timeUnit(std::chrono::milliseconds(1), "ms");
+
+		constexpr int num_lines = 10'000;
+		String value;
+		for (int i = 0; i < num_lines; i++)
+			value += "Line " + ToString(i) + ": The quick brown fox jumps over the lazy dog, again and again.\n";
+
+		el->SetValue(value);
+		el->Focus();
+		context->Update();
+		context->Render();
+
+		// Place the cursor in the middle of the document.
+		const int cursor_index = (int)StringUtilities::LengthUTF8(value) / 2;
+		el->SetSelectionRange(cursor_index, cursor_index);
+		context->Update();
+
+		bench.run("Type character", [&] {
+			context->ProcessTextInput('a');
+			IncrementTime();
+			context->Update();
+			context->Render();
+		});
+
+		bench.run("Type newline", [&] {
+			context->ProcessTextInput('\n');
+			IncrementTime();
+			context->Update();
+			context->Render();
+		});
+
+		bench.run("Backspace", [&] {
+			context->ProcessKeyDown(Input::KI_BACK, 0);
+			context->ProcessKeyUp(Input::KI_BACK, 0);
+			IncrementTime();
+			context->Update();
+			context->Render();
+		});
+	}
+
 	TestsShell::RenderLoop();
 
 	document->Close();
@@ -166,12 +166,33 @@ Rml::TextureHandle TestsRenderInterface::LoadTexture(Rml::Vector2i& texture_dime
 	return 1;
 }
 
-Rml::TextureHandle TestsRenderInterface::GenerateTexture(Rml::Span<const Rml::byte> /*source*/, Rml::Vector2i /*source_dimensions*/)
+Rml::TextureHandle TestsRenderInterface::GenerateTexture(Rml::Span<const Rml::byte> source, Rml::Vector2i /*source_dimensions*/)
 {
 	counters.generate_texture += 1;
+	counters.generate_texture_bytes += source.size();
 	return 1;
 }
 
+Rml::TextureHandle TestsRenderInterface::GenerateAlphaTexture(Rml::Span<const Rml::byte> source, Rml::Vector2i /*source_dimensions*/)
+{
+	if (!alpha_textures_supported)
+		return 0;
+
+	counters.generate_texture += 1;
+	counters.generate_texture_bytes += source.size();
+	return 1;
+}
+
+bool TestsRenderInterface::UpdateTexture(Rml::TextureHandle /*texture_handle*/, Rml::Span<const Rml::byte> source, Rml::Rectanglei /*region*/)
+{
+	if (!texture_updates_supported)
+		return false;
+
+	counters.update_texture += 1;
+	counters.update_texture_bytes += source.size();
+	return true;
+}
+
 void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle /*texture_handle*/)
 {
 	counters.release_texture += 1;
@@ -225,6 +246,8 @@ void TestsRenderInterface::Reset()
 {
 	VerifyMeshes();
 	meshes_set = false;
+	alpha_textures_supported = true;
+	texture_updates_supported = true;
 	ResetCounters();
 }
 void TestsRenderInterface::VerifyMeshes()
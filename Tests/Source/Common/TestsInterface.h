@@ -66,6 +66,9 @@ public:
 		size_t load_texture;
 		size_t generate_texture;
 		size_t release_texture;
+		size_t generate_texture_bytes;
+		size_t update_texture;
+		size_t update_texture_bytes;
 		size_t enable_scissor;
 		size_t set_scissor;
 		size_t enable_clip_mask;
@@ -85,6 +88,8 @@ public:
 	Rml::TextureHandle LoadTexture(Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	Rml::TextureHandle GenerateTexture(Rml::Span<const Rml::byte> source_data, Rml::Vector2i source_dimensions) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
+	Rml::TextureHandle GenerateAlphaTexture(Rml::Span<const Rml::byte> source_data, Rml::Vector2i source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, Rml::Span<const Rml::byte> source_data, Rml::Rectanglei region) override;
 
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(Rml::Rectanglei region) override;
@@ -108,6 +113,11 @@ public:
 
 	void ExpectCompileGeometry(Rml::Vector<Rml::Mesh> meshes);
 
+	// Single-channel textures are supported by default, when disabled they are generated as RGBA textures instead.
+	void SetAlphaTexturesSupported(bool supported) { alpha_textures_supported = supported; }
+	// Texture updates are supported by default, when disabled the textures are generated again instead.
+	void SetTextureUpdatesSupported(bool supported) { texture_updates_supported = supported; }
+
 	void Reset();
 
 private:
@@ -117,6 +127,8 @@ private:
 	Counters counters_from_previous_reset = {};
 	Rml::Vector<Rml::Mesh> meshes;
 	bool meshes_set = false;
+	bool alpha_textures_supported = true;
+	bool texture_updates_supported = true;
 };
 
 #endif
@@ -0,0 +1,120 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core/ConvolutionFilter.h>
+#include <RmlUi/Core/Math.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+// Straightforward per-pixel evaluation of the filter, used as a reference for the optimized implementation.
+static void RunReference(const Vector<float>& kernel, Vector2i kernel_radius, FilterOperation operation, byte* destination,
+	Vector2i destination_dimensions, const byte* source, Vector2i source_dimensions, Vector2i source_offset)
+{
+	const Vector2i kernel_size = kernel_radius * 2 + Vector2i(1);
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			float opacity = 0.f;
+			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+			{
+				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+				{
+					const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
+					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
+					if (source_y < 0 || source_y >= source_dimensions.y || source_x < 0 || source_x >= source_dimensions.x)
+						continue;
+
+					const float value = float(source[source_y * source_dimensions.x + source_x]) * kernel[kernel_y * kernel_size.x + kernel_x];
+					opacity = (operation == FilterOperation::Sum ? opacity + value : Math::Max(opacity, value));
+				}
+			}
+			destination[y * destination_dimensions.x + x] = byte(Math::Min(255.f, opacity));
+		}
+	}
+}
+
+TEST_CASE("ConvolutionFilter")
+{
+	const Vector2i source_dimensions(23, 17);
+	Vector<byte> source(source_dimensions.x * source_dimensions.y);
+	unsigned int seed = 1;
+	for (byte& value : source)
+	{
+		seed = seed * 1103515245u + 12345u;
+		value = byte(seed >> 16);
+	}
+
+	for (FilterOperation operation : {FilterOperation::Sum, FilterOperation::Dilation})
+	{
+		for (Vector2i kernel_radius : {Vector2i(0), Vector2i(1), Vector2i(5, 0), Vector2i(0, 5), Vector2i(3), Vector2i(9)})
+		{
+			INFO("Operation " << int(operation) << ", kernel radius " << kernel_radius.x << "x" << kernel_radius.y);
+
+			ConvolutionFilter filter;
+			REQUIRE(filter.Initialise(kernel_radius, operation));
+
+			// Use the circular outline kernel for dilation, otherwise a normalized falloff.
+			const Vector2i kernel_size = kernel_radius * 2 + Vector2i(1);
+			const float radius = float(Math::Max(kernel_radius.x, kernel_radius.y)) - 0.5f;
+			Vector<float> kernel(kernel_size.x * kernel_size.y);
+			for (int y = 0; y < kernel_size.y; ++y)
+			{
+				for (int x = 0; x < kernel_size.x; ++x)
+				{
+					const Vector2f offset(float(x - kernel_radius.x), float(y - kernel_radius.y));
+					const float distance = offset.Magnitude();
+					float weight = 0.f;
+					if (operation == FilterOperation::Dilation)
+						weight = (distance <= radius ? 1.f : Math::Max(radius + 1.f - distance, 0.f));
+					else
+						weight = 1.f / ((1.f + distance) * float(kernel_size.x * kernel_size.y) * 0.5f);
+
+					kernel[y * kernel_size.x + x] = weight;
+					filter[y][x] = weight;
+				}
+			}
+
+			for (Vector2i source_offset : {kernel_radius, Vector2i(0), Vector2i(-2, 3)})
+			{
+				const Vector2i destination_dimensions = source_dimensions + kernel_radius * 2;
+				Vector<byte> result(destination_dimensions.x * destination_dimensions.y);
+				Vector<byte> expected(result.size());
+
+				filter.Run(result.data(), destination_dimensions, destination_dimensions.x, ColorFormat::A8, source.data(), source_dimensions,
+					source_offset, ColorFormat::A8);
+				RunReference(kernel, kernel_radius, operation, expected.data(), destination_dimensions, source.data(), source_dimensions,
+					source_offset);
+
+				CHECK(result == expected);
+			}
+		}
+	}
+}
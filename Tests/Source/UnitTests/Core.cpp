@@ -32,6 +32,7 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FontRunCache.h>
 #include <Shell.h>
 #include <algorithm>
 #include <doctest.h>
@@ -329,11 +330,46 @@ TEST_CASE("core.release_resources")
 		TestsShell::RenderLoop();
 		CHECK(counters.generate_texture == counter_generate_before);
 
-		// However, when we display a non-ASCII character not part of the initial cache, the font texture needs to be regenerated.
+		// However, when we display a non-ASCII character not part of the initial cache, the glyph is added to the font texture. Then only the
+		// region covering the new glyph is uploaded, without regenerating the texture.
+		const auto counter_update_before = counters.update_texture;
+		element->SetInnerRML(reinterpret_cast<const char*>(u8"π"));
+		TestsShell::RenderLoop();
+		CHECK(counters.generate_texture == counter_generate_before);
+		CHECK(counters.release_texture == counter_release_before);
+		CHECK(counters.update_texture == counter_update_before + 1);
+		CHECK(counters.update_texture_bytes > 0);
+		CHECK(counters.update_texture_bytes < counters.generate_texture_bytes);
+	}
+
+	SUBCASE("FontGlyphCacheWithoutTextureUpdates")
+	{
+		render_interface->SetTextureUpdatesSupported(false);
+		const auto counter_generate_before = counters.generate_texture;
+		const auto counter_release_before = counters.release_texture;
+
+		// When the render interface does not support texture updates, the whole font texture is generated again instead.
 		element->SetInnerRML(reinterpret_cast<const char*>(u8"π"));
 		TestsShell::RenderLoop();
 		CHECK(counters.generate_texture == counter_generate_before + 1);
 		CHECK(counters.release_texture == counter_release_before + 1);
+		CHECK(counters.update_texture == 0);
+	}
+
+	SUBCASE("FontGlyphCacheIncremental")
+	{
+		// New glyphs should not invalidate the geometry of text already using the font, only the new text needs to be compiled.
+		element->SetInnerRML("Abc");
+		TestsShell::RenderLoop();
+		const auto counter_compile_before = counters.compile_geometry;
+		element->SetInnerRML("Abd");
+		TestsShell::RenderLoop();
+		const auto num_compiled_ascii = counters.compile_geometry - counter_compile_before;
+
+		const auto counter_compile_before_glyph = counters.compile_geometry;
+		element->SetInnerRML(reinterpret_cast<const char*>(u8"Abπ"));
+		TestsShell::RenderLoop();
+		CHECK(counters.compile_geometry - counter_compile_before_glyph == num_compiled_ascii);
 	}
 
 	SUBCASE("ReleaseGeometry")
@@ -362,6 +398,88 @@ TEST_CASE("core.release_resources")
 	TestsShell::ResetTestsRenderInterface();
 }
 
+TEST_CASE("core.font_texture_bytes")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Only verifies the ratio between the font texture bytes uploaded with and without single-channel textures. The test fonts only cover
+	// Latin characters, thus this is not representative of the memory savings for documents with large character sets, such as CJK text.
+	String latin_text;
+	for (char32_t character = 0xC0; character <= 0xFF; character++)
+		latin_text += StringUtilities::ToUTF8(Character(character));
+
+	String document_rml = R"(<rml><head><link type="text/rcss" href="/../Tests/Data/style.rcss"/></head><body>)";
+	for (int font_size : {12, 16, 24, 36})
+		document_rml += CreateString(R"(<p style="font-size: %dpx">%s Latin text, 0123456789.</p>)", font_size, latin_text.c_str());
+	document_rml += "</body></rml>";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto MeasureUploadedFontTextureBytes = [&](bool alpha_textures_supported) {
+		render_interface->SetAlphaTexturesSupported(alpha_textures_supported);
+		Rml::ReleaseFontResources();
+		render_interface->ResetCounters();
+		TestsShell::RenderLoop();
+		return render_interface->GetCounters().generate_texture_bytes;
+	};
+
+	const size_t bytes_rgba = MeasureUploadedFontTextureBytes(false);
+	const size_t bytes_alpha = MeasureUploadedFontTextureBytes(true);
+	MESSAGE("Font texture bytes uploaded: " << bytes_alpha << " with single-channel textures, " << bytes_rgba << " when expanded to RGBA.");
+
+	// Glyph coverage is uploaded with a single channel, instead of being replicated into all four channels.
+	CHECK(bytes_alpha > 0);
+	CHECK(bytes_rgba == 4 * bytes_alpha);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.font_run_cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_repeats = 50;
+	String document_rml = R"(<rml><head>
+		<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+		<style>.outline { font-effect: outline(2px black); }</style>
+	</head><body>)";
+	for (int i = 0; i < num_repeats; i++)
+		document_rml += R"(<p>Repeated label</p><p class="outline">Repeated label</p>)";
+	document_rml += "</body></rml>";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Rml::ReleaseFontResources();
+	CHECK(Rml::GetFontRunCacheStatistics().num_runs == 0);
+
+	const FontRunCacheStatistics stats_before = Rml::GetFontRunCacheStatistics();
+	TestsShell::RenderLoop();
+	const FontRunCacheStatistics stats_after = Rml::GetFontRunCacheStatistics();
+
+	// Each combination of string and font effects is only shaped once, all later occurrences are taken from the cache.
+	CHECK(stats_after.num_runs == 2);
+	CHECK(stats_after.num_misses - stats_before.num_misses == 2);
+	CHECK(stats_after.num_hits - stats_before.num_hits == 2 * (num_repeats - 1));
+	CHECK(stats_after.memory_bytes > 0);
+	CHECK(stats_after.memory_bytes <= stats_after.memory_budget_bytes);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
 TEST_CASE("core.initialize")
 {
 	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
@@ -458,3 +576,76 @@ TEST_CASE("core.RemoveContext")
 
 	Shell::Shutdown();
 }
+
+TEST_CASE("core.render_cache")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	context->EnableRenderCache(true);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_basic_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto RenderFrame = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		return render_interface->GetCounters();
+	};
+
+	context->Update();
+	CHECK(!context->IsRenderCacheValid());
+
+	const auto counters_initial = RenderFrame();
+	CHECK(counters_initial.render_geometry > 0);
+
+	// Nothing changed, the recorded commands should be replayed without compiling anything.
+	context->Update();
+	CHECK(context->IsRenderCacheValid());
+	const auto counters_replay = RenderFrame();
+	CHECK(counters_replay.render_geometry == counters_initial.render_geometry);
+	CHECK(counters_replay.compile_geometry == 0);
+	CHECK(counters_replay.load_texture == 0);
+
+	Element* sprite = document->QuerySelector("div.sprite");
+	REQUIRE(sprite);
+
+	SUBCASE("Property")
+	{
+		sprite->SetProperty("height", "50px");
+	}
+	SUBCASE("Attribute")
+	{
+		document->QuerySelector("img")->SetAttribute("src", "/assets/high_scores_alien_2.tga");
+	}
+	SUBCASE("Text")
+	{
+		document->AppendChild(document->CreateTextNode("def"));
+	}
+	SUBCASE("Remove")
+	{
+		sprite->GetParentNode()->RemoveChild(sprite);
+	}
+	SUBCASE("Manual")
+	{
+		context->DirtyRenderCache();
+	}
+
+	context->Update();
+	CHECK(!context->IsRenderCacheValid());
+	RenderFrame();
+	context->Update();
+	CHECK(context->IsRenderCacheValid());
+
+	context->EnableRenderCache(false);
+	CHECK(!context->IsRenderCacheValid());
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
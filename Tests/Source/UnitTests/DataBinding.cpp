@@ -710,3 +710,238 @@ TEST_CASE("data_binding.set_enum")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String virtual_for_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 14px;
+			width: 500px;
+			height: 400px;
+		}
+		#list {
+			height: 200px;
+			overflow: auto;
+		}
+		p {
+			display: block;
+			width: 50px;
+			height: 20px;
+			margin: 0;
+		}
+		p:nth-child(odd) {
+			width: 100px;
+		}
+	</style>
+</head>
+<body>
+<div data-model="virtual_list">
+<div id="list">
+	<p data-for="item : items" virtual="[VIRTUAL]">{{ item }}</p>
+</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("data_binding.virtual_for")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> items(10'000);
+	for (int i = 0; i < (int)items.size(); i++)
+		items[i] = i;
+
+	{
+		DataModelConstructor constructor = context->CreateDataModel("virtual_list");
+		REQUIRE(constructor);
+		REQUIRE(constructor.RegisterArray<Vector<int>>());
+		REQUIRE(constructor.Bind("items", &items));
+	}
+
+	String document_rml = virtual_for_rml;
+	SUBCASE("Fixed row height")
+	{
+		document_rml = StringUtilities::Replace(document_rml, "[VIRTUAL]", "20");
+	}
+	SUBCASE("Estimated row height")
+	{
+		document_rml = StringUtilities::Replace(document_rml, "[VIRTUAL]", "");
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	for (int i = 0; i < 3; i++)
+		context->Update();
+
+	Element* list = document->GetElementById("list");
+	REQUIRE(list);
+
+	// Returns the contents of the first and last instantiated rows, and verifies that the list has the height of all its rows. Also verifies
+	// that structural selectors match the rows by their index in the data container, as if all rows were instantiated.
+	auto GetRowRange = [&]() -> Pair<String, String> {
+		ElementList rows;
+		list->QuerySelectorAll(rows, "p");
+		CHECK(list->GetScrollHeight() == doctest::Approx(20.f * items.size()));
+
+		String first, last;
+		for (Element* row : rows)
+		{
+			// Skip the data-for element itself, the spacers are not matched by the selector.
+			if (row->HasAttribute("data-for"))
+				continue;
+			if (first.empty())
+				first = row->GetInnerRML();
+			last = row->GetInnerRML();
+
+			const bool is_odd_child = (FromString<int>(row->GetInnerRML()) % 2 == 0);
+			CHECK(row->GetProperty<float>("width") == (is_odd_child ? 100.f : 50.f));
+		}
+		CHECK(rows.size() < 30);
+		return {first, last};
+	};
+
+	// Only the rows in view plus a few rows on each side should be instantiated.
+	CHECK(GetRowRange() == Pair<String, String>{"0", "13"});
+
+	// Formatting the list again without changing the visible range should not dirty the container.
+	DataModelHandle handle = context->GetDataModel("virtual_list").GetModelHandle();
+	list->SetProperty("width", "300px");
+	for (int i = 0; i < 2; i++)
+	{
+		context->Update();
+		CHECK(!handle.IsVariableDirty("items"));
+	}
+	CHECK(GetRowRange() == Pair<String, String>{"0", "13"});
+
+	// Scrolling by an odd number of rows should not change which rows the structural selectors match.
+	list->SetScrollTop(5020.f);
+	for (int i = 0; i < 3; i++)
+		context->Update();
+	CHECK(GetRowRange() == Pair<String, String>{"246", "264"});
+
+	list->SetScrollTop(5000.f);
+	for (int i = 0; i < 3; i++)
+		context->Update();
+	CHECK(GetRowRange() == Pair<String, String>{"246", "263"});
+
+	list->SetScrollTop(list->GetScrollHeight());
+	for (int i = 0; i < 3; i++)
+		context->Update();
+	CHECK(GetRowRange() == Pair<String, String>{"9986", "9999"});
+
+	// Shrinking the container should remove the rows past its end.
+	items.resize(100);
+	context->GetDataModel("virtual_list").GetModelHandle().DirtyVariable("items");
+	for (int i = 0; i < 3; i++)
+		context->Update();
+	list->SetScrollTop(list->GetScrollHeight());
+	for (int i = 0; i < 3; i++)
+		context->Update();
+	CHECK(GetRowRange() == Pair<String, String>{"86", "99"});
+
+	// The spacers should be removed together with the view.
+	auto CountSpacers = [&]() {
+		int num_spacers = 0;
+		for (int i = 0; i < list->GetNumChildren(); i++)
+		{
+			if (list->GetChild(i)->GetTagName() == "#data-for-spacer")
+				num_spacers += 1;
+		}
+		return num_spacers;
+	};
+	CHECK(CountSpacers() == 2);
+
+	ElementList data_for_elements;
+	list->QuerySelectorAll(data_for_elements, "p[data-for]");
+	REQUIRE(data_for_elements.size() == 1);
+	list->RemoveChild(data_for_elements[0]);
+	context->Update();
+	CHECK(CountSpacers() == 0);
+
+	document->Close();
+	context->RemoveDataModel("virtual_list");
+
+	TestsShell::ShutdownShell();
+}
+
+static const String dirty_address_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+</head>
+<body template="window">
+<div data-model="dirty_address">
+	<p data-for="cell : cells">{{ cell }}</p>
+	<div id="sum">{{ cells[0] + cells[1] }}</div>
+	<div id="size">{{ cells.size }}</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("data_binding.dirty_address")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> cells = {1, 2, 3};
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("dirty_address");
+		REQUIRE(constructor);
+		REQUIRE(constructor.RegisterArray<Vector<int>>());
+		REQUIRE(constructor.Bind("cells", &cells));
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(dirty_address_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	auto GetText = [&](const String& selector) { return document->QuerySelector(selector)->GetInnerRML(); };
+	CHECK(GetText("p:nth-child(2)") == "2");
+	CHECK(GetText("p:nth-child(3)") == "3");
+	CHECK(GetText("#sum") == "3");
+
+	// Only views reading from the dirty address, or from its parents or children, should be updated.
+	cells[1] = 20;
+	cells[2] = 30;
+	handle.DirtyAddress("cells[1]");
+	CHECK(handle.IsVariableDirty("cells"));
+	TestsShell::RenderLoop();
+
+	CHECK(GetText("p:nth-child(2)") == "20");
+	CHECK(GetText("p:nth-child(3)") == "3");
+	CHECK(GetText("#sum") == "21");
+	CHECK(GetText("#size") == "3");
+
+	handle.DirtyAddress(DataAddress{DataAddressEntry("cells"), DataAddressEntry(2)});
+	TestsShell::RenderLoop();
+	CHECK(GetText("p:nth-child(3)") == "30");
+
+	// Dirtying the whole variable updates all views reading from it.
+	cells[0] = 10;
+	cells.push_back(4);
+	handle.DirtyVariable("cells");
+	TestsShell::RenderLoop();
+
+	CHECK(GetText("p:nth-child(1)") == "10");
+	CHECK(GetText("p:nth-child(4)") == "4");
+	CHECK(GetText("#sum") == "30");
+	CHECK(GetText("#size") == "4");
+
+	document->Close();
+	context->RemoveDataModel("dirty_address");
+
+	TestsShell::ShutdownShell();
+}
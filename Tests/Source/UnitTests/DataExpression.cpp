@@ -201,3 +201,82 @@ TEST_CASE("Data expressions")
 	CHECK(TestExpression("true ? num_multi[0] : num_multi[999]") == "left");
 	CHECK(TestExpression("false ? num_multi[999] : num_multi[1]") == "right");
 }
+
+static Variant RunProgram(const Program& program)
+{
+	DataInterpreter interpreter(program, {}, interface);
+	if (!interpreter.Run())
+		FAIL_CHECK("Could not execute program:\n" << DumpProgram(program));
+	return interpreter.Result();
+}
+
+TEST_CASE("Data expressions.Optimizer")
+{
+	const Variant pop_left = Variant(int(Register::L));
+	const Variant pop_right = Variant(int(Register::R));
+
+	SUBCASE("Fold constants")
+	{
+		// 3 * 4
+		Program program = {
+			{Instruction::Literal, Variant(3)},
+			{Instruction::Push, {}},
+			{Instruction::Literal, Variant(4)},
+			{Instruction::Pop, pop_left},
+			{Instruction::Multiply, {}},
+		};
+		OptimizeProgram(program);
+		REQUIRE(program.size() == 1);
+		CHECK(program[0].instruction == Instruction::Literal);
+		CHECK(RunProgram(program).Get<int>() == 12);
+	}
+
+	SUBCASE("Fuse operands")
+	{
+		// (0 ? 5 : 3) + 4, the jumps prevent the ternary from being folded on the left-hand side.
+		Program program = {
+			{Instruction::Literal, Variant(0)},
+			{Instruction::Push, {}},
+			{Instruction::Pop, pop_right},
+			{Instruction::JumpIfZero, Variant(uint64_t(6))},
+			{Instruction::Literal, Variant(5)},
+			{Instruction::Jump, Variant(uint64_t(7))},
+			{Instruction::Literal, Variant(3)},
+			{Instruction::Push, {}},
+			{Instruction::Literal, Variant(4)},
+			{Instruction::Pop, pop_left},
+			{Instruction::Add, {}},
+		};
+		CHECK(RunProgram(program).Get<int>() == 7);
+
+		OptimizeProgram(program);
+		REQUIRE(program.size() == 9);
+		CHECK(program[7].instruction == Instruction::LiteralRight);
+		CHECK(RunProgram(program).Get<int>() == 7);
+	}
+
+	SUBCASE("Jump target inside sequence")
+	{
+		// The literal at index 8 is a jump target, where the left-hand operand was pushed at index 1 rather than at
+		// index 7. The sequence starting at index 6 must not be folded, even though the jump target is an instruction
+		// of the same kind as the first one in the sequence.
+		Program program = {
+			{Instruction::Literal, Variant(20)},
+			{Instruction::Push, {}},
+			{Instruction::Literal, Variant(0)},
+			{Instruction::Push, {}},
+			{Instruction::Pop, pop_right},
+			{Instruction::JumpIfZero, Variant(uint64_t(8))},
+			{Instruction::Literal, Variant(10)},
+			{Instruction::Push, {}},
+			{Instruction::Literal, Variant(2)},
+			{Instruction::Pop, pop_left},
+			{Instruction::Add, {}},
+		};
+		CHECK(RunProgram(program).Get<int>() == 22);
+
+		OptimizeProgram(program);
+		CHECK(program.size() == 11);
+		CHECK(RunProgram(program).Get<int>() == 22);
+	}
+}
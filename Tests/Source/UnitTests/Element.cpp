@@ -30,10 +30,14 @@
 #include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include "../Common/TypesToString.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
+#include <RmlUi/Core/EventListener.h>
 #include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/StyleSharing.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -280,6 +284,31 @@ TEST_CASE("Element")
 		CHECK(clone->GetProperty<String>("background-color") == "#0000ff");
 	}
 
+	SUBCASE("UpdateCleanSubtrees")
+	{
+		// Elements in clean subtrees are skipped during update, make sure changes are still picked up after a few idle updates.
+		for (int i = 0; i < 3; i++)
+			context->Update();
+
+		CHECK(span->GetComputedValues().color() == Colourb(255, 0, 0));
+		span->SetProperty("color", "#0f0");
+		context->Update();
+		CHECK(span->GetComputedValues().color() == Colourb(0, 255, 0));
+
+		div->SetProperty("font-size", "30px");
+		context->Update();
+		CHECK(span->GetComputedValues().font_size() == 30.f);
+
+		// Elements dirtied before being attached should also be updated.
+		ElementPtr detached = document->CreateElement("span");
+		detached->SetProperty("color", "#00f");
+		context->Update();
+		Element* attached = div->AppendChild(std::move(detached));
+		context->Update();
+		CHECK(attached->GetComputedValues().color() == Colourb(0, 0, 255));
+		CHECK(attached->GetComputedValues().font_size() == 30.f);
+	}
+
 	SUBCASE("SetInnerRML")
 	{
 		Element* element = document->GetFirstChild();
@@ -291,6 +320,17 @@ TEST_CASE("Element")
 		element->SetInnerRML(inner_rml);
 		CHECK(element->GetInnerRML() == inner_rml);
 
+		// Repeated contents are instanced from a pre-parsed fragment, which should give identical results.
+		element->SetInnerRML("text");
+		element->SetInnerRML(inner_rml);
+		CHECK(element->GetInnerRML() == inner_rml);
+
+		// Mismatched tags should be reported each time.
+		TestsShell::SetNumExpectedWarnings(6);
+		for (int i = 0; i < 2; i++)
+			element->SetInnerRML("<span><b>text</span>");
+		TestsShell::SetNumExpectedWarnings(0);
+
 		ElementPtr element_ptr = document->CreateElement("div");
 		CHECK(element_ptr->GetInnerRML() == "");
 		element_ptr->SetInnerRML("text");
@@ -466,3 +506,516 @@ TEST_CASE("Element.ScrollIntoView")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String document_render_culling_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body, div { display: block; }
+		body { width: 400px; height: 300px; }
+		#container { height: 100px; overflow: hidden; }
+		.row { height: 20px; background-color: #f00; }
+		#transformed { width: 100px; height: 100px; background-color: #0f0; }
+	</style>
+</head>
+<body>
+<div id="container"/>
+<div id="transformed"/>
+</body>
+</rml>
+)";
+
+class ElementRenderCounter : public Element {
+public:
+	ElementRenderCounter(const String& tag) : Element(tag) {}
+	using Element::SetRenderCulling;
+	int num_render_calls = 0;
+
+protected:
+	void OnRender() override { num_render_calls += 1; }
+};
+
+TEST_CASE("Element.RenderCulling")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_render_culling_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* container = document->GetElementById("container");
+	Element* transformed = document->GetElementById("transformed");
+
+	auto SetNumRows = [&](int num_rows) {
+		String rml;
+		for (int i = 0; i < num_rows; i++)
+			rml += "<div class=\"row\"/>";
+		container->SetInnerRML(rml);
+	};
+	auto CountRenderCalls = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		return render_interface->GetCounters().render_geometry;
+	};
+
+	SetNumRows(0);
+	const size_t num_calls_empty = CountRenderCalls();
+
+	// Five rows fit in the container.
+	SetNumRows(5);
+	const size_t num_calls_visible_rows = CountRenderCalls();
+	CHECK(num_calls_visible_rows == num_calls_empty + 5);
+
+	// Rows clipped by the container should not be rendered.
+	SetNumRows(50);
+	CHECK(CountRenderCalls() == num_calls_visible_rows);
+
+	container->SetScrollTop(500.f);
+	CHECK(CountRenderCalls() == num_calls_visible_rows);
+
+	// A partially visible row should still be rendered.
+	container->SetScrollTop(510.f);
+	CHECK(CountRenderCalls() == num_calls_visible_rows + 1);
+
+	// Elements transformed outside the viewport should not be rendered.
+	transformed->SetProperty("transform", "translateX(-200px)");
+	CHECK(CountRenderCalls() == num_calls_visible_rows);
+
+	transformed->SetProperty("transform", "translateX(-50px)");
+	CHECK(CountRenderCalls() == num_calls_visible_rows + 1);
+
+	// Custom rendering may draw outside the element's box, thus it is only culled when enabled by the element.
+	static ElementInstancerGeneric<ElementRenderCounter> counter_instancer;
+	Factory::RegisterElementInstancer("render-counter", &counter_instancer);
+
+	transformed->SetProperty("transform", "translateX(-200px)");
+	for (bool cull_on_render : {false, true})
+	{
+		auto counter = rmlui_static_cast<ElementRenderCounter*>(transformed->AppendChild(document->CreateElement("render-counter")));
+		counter->SetRenderCulling(true, cull_on_render);
+
+		CountRenderCalls();
+		CHECK(counter->num_render_calls == (cull_on_render ? 0 : 1));
+		transformed->RemoveChild(counter);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_hit_testing_rml = R"(
+<rml>
+<head>
+	<style>
+		body { left: 0; top: 0; width: 400px; height: 400px; }
+		div { display: block; }
+		#grid { width: 200px; height: 100px; }
+		.icon { float: left; width: 20px; height: 20px; }
+		#moving { position: absolute; left: 300px; top: 0; width: 20px; height: 20px; }
+	</style>
+</head>
+<body>
+<div id="grid"/>
+<div id="moving"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.HitTesting")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_hit_testing_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// Enough icons for the stacking context to be spatially indexed.
+	Element* grid = document->GetElementById("grid");
+	String rml;
+	for (int i = 0; i < 50; i++)
+		rml += CreateString("<div class=\"icon\" id=\"icon%d\"/>", i);
+	grid->SetInnerRML(rml);
+
+	Element* moving = document->GetElementById("moving");
+	Element* icon1 = document->GetElementById("icon1");
+	Element* icon2 = document->GetElementById("icon2");
+	Element* icon12 = document->GetElementById("icon12");
+
+	auto GetElementAt = [&](int x, int y) {
+		context->Update();
+		context->Render();
+		context->ProcessMouseMove(x, y, 0);
+		return context->GetHoverElement();
+	};
+
+	CHECK(GetElementAt(25, 5) == icon1);
+	CHECK(GetElementAt(45, 25) == icon12);
+	CHECK(GetElementAt(5, 150) == document);
+
+	icon1->SetProperty("pointer-events", "none");
+	CHECK(GetElementAt(25, 5) == grid);
+	icon1->RemoveProperty("pointer-events");
+	CHECK(GetElementAt(25, 5) == icon1);
+
+	CHECK(GetElementAt(305, 5) == moving);
+	moving->SetProperty("left", "350px");
+	CHECK(GetElementAt(305, 5) == document);
+	CHECK(GetElementAt(355, 5) == moving);
+
+	// Transformed elements are hit at their projected position.
+	icon2->SetProperty("transform", "translateY(200px)");
+	CHECK(GetElementAt(45, 5) == grid);
+	CHECK(GetElementAt(45, 205) == icon2);
+	icon2->RemoveProperty("transform");
+	CHECK(GetElementAt(45, 205) == document);
+	CHECK(GetElementAt(45, 5) == icon2);
+
+	// Removed elements must no longer be hit.
+	grid->SetInnerRML("");
+	CHECK(GetElementAt(25, 5) == grid);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_hover_chain_rml = R"(
+<rml>
+<head>
+	<style>
+		body { left: 0; top: 0; width: 400px; height: 400px; }
+		div { display: block; height: 100px; }
+		#outer { width: 200px; }
+		#inner { width: 100px; }
+		#sibling { width: 200px; }
+	</style>
+</head>
+<body>
+<div id="outer"><div id="inner"/></div>
+<div id="sibling"/>
+</body>
+</rml>
+)";
+
+class HoverEventLog : public EventListener {
+public:
+	void ProcessEvent(Event& event) override
+	{
+		if (!log.empty())
+			log += ' ';
+		log += (event == EventId::Mouseover ? "over:" : "out:") + event.GetTargetElement()->GetId();
+	}
+
+	String log;
+};
+
+class StopPropagationListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override { event.StopPropagation(); }
+};
+
+TEST_CASE("Element.HoverChain")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_hover_chain_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* outer = document->GetElementById("outer");
+	Element* inner = document->GetElementById("inner");
+	Element* sibling = document->GetElementById("sibling");
+
+	HoverEventLog listener;
+	document->AddEventListener(EventId::Mouseover, &listener, true);
+	document->AddEventListener(EventId::Mouseout, &listener, true);
+
+	auto MoveMouse = [&](int x, int y) {
+		listener.log.clear();
+		context->Update();
+		context->ProcessMouseMove(x, y, 0);
+		return listener.log;
+	};
+
+	// Entering elements dispatches from the root downwards.
+	CHECK(MoveMouse(50, 50) == "over: over:outer over:inner");
+	CHECK(inner->IsPseudoClassSet("hover"));
+	CHECK(outer->IsPseudoClassSet("hover"));
+	CHECK(document->IsPseudoClassSet("hover"));
+
+	// Moving within the hovered element leaves the chain untouched.
+	CHECK(MoveMouse(60, 60) == "");
+
+	// Only elements below the common ancestor are affected, leaving elements from the leaf upwards.
+	CHECK(MoveMouse(150, 50) == "out:inner");
+	CHECK(!inner->IsPseudoClassSet("hover"));
+	CHECK(outer->IsPseudoClassSet("hover"));
+
+	CHECK(MoveMouse(50, 150) == "out:outer over:sibling");
+	CHECK(!outer->IsPseudoClassSet("hover"));
+	CHECK(sibling->IsPseudoClassSet("hover"));
+
+	// Removing the hovered element clears its hover state, and the chain is rebuilt from its remaining ancestors.
+	ElementPtr removed_sibling = document->RemoveChild(sibling);
+	CHECK(!removed_sibling->IsPseudoClassSet("hover"));
+	removed_sibling.reset();
+	CHECK(MoveMouse(50, 160) == "");
+	CHECK(context->GetHoverElement() == document);
+	CHECK(MoveMouse(50, 50) == "over:outer over:inner");
+
+	// The hover state is applied by the default action of the mouse events. Thus, it is not applied when propagation is
+	// stopped, while dispatching the events manually does apply it.
+	StopPropagationListener stop_listener;
+	inner->AddEventListener(EventId::Mouseover, &stop_listener);
+	CHECK(MoveMouse(150, 50) == "out:inner");
+	CHECK(MoveMouse(50, 50) == "over:inner");
+	CHECK(!inner->IsPseudoClassSet("hover"));
+	inner->RemoveEventListener(EventId::Mouseover, &stop_listener);
+
+	inner->DispatchEvent(EventId::Mouseover, Dictionary());
+	CHECK(inner->IsPseudoClassSet("hover"));
+	inner->DispatchEvent(EventId::Mouseout, Dictionary());
+	CHECK(!inner->IsPseudoClassSet("hover"));
+
+	document->RemoveEventListener(EventId::Mouseover, &listener, true);
+	document->RemoveEventListener(EventId::Mouseout, &listener, true);
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+class ElementUpdateCounter : public Element {
+public:
+	ElementUpdateCounter(const String& tag) : Element(tag) {}
+
+	void SetNeedsUpdate(bool needs_update) { Element::SetNeedsUpdate(needs_update); }
+
+	int num_updates = 0;
+
+protected:
+	void OnUpdate() override
+	{
+		// Calling the base implementation should not affect whether we are updated.
+		Element::OnUpdate();
+		num_updates += 1;
+	}
+};
+
+static const String document_update_loop_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { width: 400px; height: 400px; }
+		#scroll { width: 200px; height: 100px; overflow-y: scroll; }
+		#content { height: 1000px; }
+		scrollbarvertical sliderarrowdec, scrollbarvertical sliderarrowinc { width: 16px; height: 16px; }
+	</style>
+</head>
+<body>
+<div id="scroll"><div id="content"/></div>
+<update-counter id="counter"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.UpdateLoop")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	static ElementInstancerGeneric<ElementUpdateCounter> counter_instancer;
+	Factory::RegisterElementInstancer("update-counter", &counter_instancer);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_update_loop_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+	double time = system_interface->GetElapsedTime();
+	auto UpdateAfter = [&](double dt) {
+		time += dt;
+		system_interface->SetTime(time);
+		context->Update();
+		context->Render();
+	};
+
+	SUBCASE("NeedsUpdate")
+	{
+		auto counter = rmlui_dynamic_cast<ElementUpdateCounter*>(document->GetElementById("counter"));
+		REQUIRE(counter);
+
+		// Elements from custom instancers are visited during every update loop by default.
+		const int num_updates_initial = counter->num_updates;
+		for (int i = 0; i < 5; i++)
+			UpdateAfter(0.1);
+		CHECK(counter->num_updates == num_updates_initial + 5);
+
+		// Clones keep being visited as well.
+		ElementPtr clone_ptr = counter->Clone();
+		auto clone = rmlui_dynamic_cast<ElementUpdateCounter*>(document->AppendChild(std::move(clone_ptr)));
+		REQUIRE(clone);
+		UpdateAfter(0.1);
+		const int num_updates_clone = clone->num_updates;
+		for (int i = 0; i < 5; i++)
+			UpdateAfter(0.1);
+		CHECK(clone->num_updates == num_updates_clone + 5);
+		document->RemoveChild(clone);
+
+		// After opting out, unchanged elements are skipped during the update loop, even when they override OnUpdate().
+		counter->SetNeedsUpdate(false);
+		UpdateAfter(0.1);
+		const int num_updates_idle = counter->num_updates;
+		for (int i = 0; i < 5; i++)
+			UpdateAfter(0.1);
+		CHECK(counter->num_updates == num_updates_idle);
+
+		counter->SetNeedsUpdate(true);
+		for (int i = 0; i < 5; i++)
+			UpdateAfter(0.1);
+		CHECK(counter->num_updates == num_updates_idle + 5);
+	}
+
+	SUBCASE("ScrollArrowRepeat")
+	{
+		Element* scroll = document->GetElementById("scroll");
+		Element* arrow_inc = context->GetElementAtPoint(scroll->GetAbsoluteOffset(BoxArea::Border) + Vector2f(192, 92));
+		REQUIRE(arrow_inc);
+		REQUIRE(arrow_inc->GetTagName() == "sliderarrowinc");
+
+		const Vector2f arrow_center = arrow_inc->GetAbsoluteOffset(BoxArea::Border) + 0.5f * arrow_inc->GetBox().GetSize(BoxArea::Border);
+		context->ProcessMouseMove(int(arrow_center.x), int(arrow_center.y), 0);
+		context->ProcessMouseButtonDown(0, 0);
+
+		auto HoldFor = [&](double duration) {
+			for (double t = 0; t < duration; t += 0.05)
+				UpdateAfter(0.05);
+		};
+
+		// The first click scrolls a single line, then holding the arrow keeps scrolling one line at a time after a delay.
+		HoldFor(0.4);
+		const float scroll_top_clicked = scroll->GetScrollTop();
+		CHECK(scroll_top_clicked > 0.f);
+
+		HoldFor(1.0);
+		const float scroll_top_held = scroll->GetScrollTop();
+		CHECK(scroll_top_held >= 5.f * scroll_top_clicked);
+
+		// Releasing the arrow stops the scrolling, once any smooth scrolling has settled.
+		context->ProcessMouseButtonUp(0, 0);
+		HoldFor(0.5);
+		const float scroll_top_released = scroll->GetScrollTop();
+		CHECK(scroll_top_released >= scroll_top_held);
+		HoldFor(1.0);
+		CHECK(scroll->GetScrollTop() == scroll_top_released);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_style_sharing_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { font-size: 16px; overflow: hidden; }
+		li { display: block; padding: 0.5em; line-height: 1.5; color: #f00; }
+		li.odd { color: #0f0; }
+		li:hover { color: #00f; }
+	</style>
+</head>
+<body>
+<ul id="list"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.StyleSharing")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_style_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	constexpr int num_rows = 100;
+	constexpr int inline_row = 50;
+	String rows_rml;
+	for (int i = 0; i < num_rows; i++)
+	{
+		rows_rml += (i % 2 ? "<li class='odd'" : "<li");
+		rows_rml += (i == inline_row ? " style='color: #fff'>" : ">");
+		rows_rml += "Row</li>";
+	}
+
+	Element* list = document->GetElementById("list");
+	list->SetInnerRML(rows_rml);
+	REQUIRE(list->GetNumChildren() == num_rows);
+
+	auto CheckRows = [&](float font_size) {
+		for (int i = 0; i < num_rows; i++)
+		{
+			INFO("Row " << i);
+			Element* row = list->GetChild(i);
+			const ComputedValues& computed = row->GetComputedValues();
+
+			Colourb expected_color = (i % 2 ? Colourb(0, 255, 0) : Colourb(255, 0, 0));
+			if (i == inline_row)
+				expected_color = Colourb(255, 255, 255);
+			else if (row->IsPseudoClassSet("hover"))
+				expected_color = Colourb(0, 0, 255);
+
+			CHECK(computed.color() == expected_color);
+			CHECK(computed.font_size() == font_size);
+			CHECK(computed.line_height().value == 1.5f * font_size);
+			CHECK(row->GetBox().GetEdge(BoxArea::Padding, BoxEdge::Top) == 0.5f * font_size);
+		}
+	};
+
+	StyleSharingStatistics stats_before = Rml::GetStyleSharingStatistics();
+	context->Update();
+	StyleSharingStatistics stats_after = Rml::GetStyleSharingStatistics();
+
+	// The first row of each class and the row with inline properties are resolved, all other rows are copied from a preceding sibling.
+	CHECK(stats_after.num_hits - stats_before.num_hits == num_rows - 3);
+	CheckRows(16.f);
+
+	// Changing an inherited property dirties all rows, including their em-relative properties.
+	stats_before = stats_after;
+	document->SetProperty("font-size", "20px");
+	context->Update();
+	stats_after = Rml::GetStyleSharingStatistics();
+
+	CHECK(stats_after.num_hits - stats_before.num_hits == num_rows - 3);
+	CheckRows(20.f);
+
+	// A row in a different state gets its own definition, while its siblings can still share with the rows before it.
+	list->GetChild(10)->SetPseudoClass("hover", true);
+	context->Update();
+	CheckRows(20.f);
+	CHECK(list->GetChild(10)->GetComputedValues().color() == Colourb(0, 0, 255));
+
+	list->GetChild(10)->SetPseudoClass("hover", false);
+	context->Update();
+	CheckRows(20.f);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+
+	// The statistics start over after shutdown.
+	CHECK(Rml::GetStyleSharingStatistics().num_hits == 0);
+	CHECK(Rml::GetStyleSharingStatistics().num_misses == 0);
+}
@@ -103,18 +103,24 @@ TEST_CASE("ElementBackgroundBorder.render_stats")
 		return;
 
 	MESSAGE(TestsShell::GetRenderStats());
-	render_interface->Reset();
 
-	for (int i = 1; i < 50; i++)
-	{
-		wrapper->SetScrollTop(1.3333f * float(i));
+	auto ScrollThrough = [&]() {
+		for (int i = 0; i < 50; i++)
+		{
+			wrapper->SetScrollTop(1.3333f * float(i));
+			context->Update();
+			context->Render();
+		}
+
+		wrapper->SetScrollTop(FLT_MAX);
 		context->Update();
 		context->Render();
-	}
+	};
 
-	wrapper->SetScrollTop(FLT_MAX);
-	context->Update();
-	context->Render();
+	// Rows outside the scroll region are not rendered, so their geometry is first compiled when they are scrolled into view.
+	ScrollThrough();
+	render_interface->Reset();
+	ScrollThrough();
 
 	// Ensure that we have no unnecessary compile geometry commands. The geometry for the background-border should not
 	// change in size as long as scrolling occurs in integer increments.
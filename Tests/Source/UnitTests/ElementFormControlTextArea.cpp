@@ -0,0 +1,158 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/ElementFormControlTextArea.h>
+#include <RmlUi/Core/Input.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_textarea_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			width: 800px;
+			height: 600px;
+		}
+		textarea {
+			display: block;
+			width: 200px;
+			height: 100px;
+			overflow-y: auto;
+		}
+	</style>
+</head>
+
+<body>
+<textarea id="edited"/>
+<textarea id="reference"/>
+</body>
+</rml>
+)";
+
+// Returns the character index at the beginning and end of each line, by navigating through the text area using the keyboard.
+static Vector<int> GetLineBoundaries(Context* context, ElementFormControlTextArea* element)
+{
+	Vector<int> result;
+	element->Focus();
+	context->ProcessKeyDown(Input::KI_HOME, Input::KM_CTRL);
+
+	int previous_end = -1;
+	while (true)
+	{
+		int begin = 0, end = 0;
+		context->ProcessKeyDown(Input::KI_HOME, 0);
+		element->GetSelection(&begin, nullptr, nullptr);
+		context->ProcessKeyDown(Input::KI_END, 0);
+		element->GetSelection(&end, nullptr, nullptr);
+		if (end == previous_end)
+			break;
+
+		result.push_back(begin);
+		result.push_back(end);
+		previous_end = end;
+		context->ProcessKeyDown(Input::KI_DOWN, 0);
+	}
+	return result;
+}
+
+TEST_CASE("ElementFormControlTextArea.incremental_formatting")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_textarea_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto edited = rmlui_dynamic_cast<ElementFormControlTextArea*>(document->GetElementById("edited"));
+	auto reference = rmlui_dynamic_cast<ElementFormControlTextArea*>(document->GetElementById("reference"));
+	REQUIRE(edited);
+	REQUIRE(reference);
+
+	String value;
+	for (int i = 0; i < 40; i++)
+	{
+		value += "Line " + ToString(i) + ":";
+		for (int j = 0; j < i % 7; j++)
+			value += " lorem ipsum";
+		value += '\n';
+	}
+
+	edited->SetValue(value);
+	context->Update();
+
+	// Each edit selects a character range, which is then replaced by typing the given text, or deleted if there is no text.
+	struct Edit {
+		int selection_start, selection_end;
+		const char* text;
+	};
+	const Edit edits[] = {
+		{25, 25, "inserted words "},
+		{40, 40, "\n"},
+		{41, 41, ""},
+		{60, 60, " more text that will surely need to wrap over several lines"},
+		{100, 180, ""},
+		{150, 400, "x"},
+		{0, 0, "At the beginning\n\n"},
+		{200, 200, "    "},
+		{290, 298, "   \n   "},
+		{5000, 5000, "\nAt the end"},
+		{3, 60, "replaced"},
+		{400, 400, "😍🌐😎 "},
+		{0, 5000, "Everything replaced"},
+	};
+
+	for (const Edit& edit : edits)
+	{
+		INFO("Edit with selection " << edit.selection_start << "-" << edit.selection_end << " and text '" << edit.text << "'");
+
+		edited->Focus();
+		edited->SetSelectionRange(edit.selection_start, edit.selection_end);
+		if (edit.text[0] != '\0')
+			context->ProcessTextInput(edit.text);
+		else
+			context->ProcessKeyDown(Input::KI_BACK, 0);
+		context->Update();
+
+		reference->SetValue(edited->GetValue());
+		context->Update();
+
+		CHECK(edited->GetScrollHeight() == reference->GetScrollHeight());
+		CHECK(GetLineBoundaries(context, edited) == GetLineBoundaries(context, reference));
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,151 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <chrono>
+#include <doctest.h>
+#include <thread>
+
+using namespace Rml;
+
+static const String document_lottie_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			width: 800px;
+			height: 600px;
+		}
+		lottie {
+			display: block;
+			width: 32px;
+			height: 32px;
+		}
+	</style>
+</head>
+
+<body>
+<lottie id="animation" src="/basic/lottie/data/a_mountain.json"/>
+</body>
+</rml>
+)";
+
+// Renders the context at the given time and returns the number of generated textures. When a new frame is expected, keeps rendering until
+// the frame has been rendered in the background and uploaded.
+static int RenderAt(double t, bool expect_new_frame)
+{
+	TestsShell::GetTestsSystemInterface()->SetTime(t);
+	const auto& counters = TestsShell::GetTestsRenderInterface()->GetCounters();
+	const size_t initial_generate_texture = counters.generate_texture;
+
+	for (int i = 0; i < 2000; i++)
+	{
+		TestsShell::RenderLoop();
+		const int num_generated = int(counters.generate_texture - initial_generate_texture);
+		if (!expect_new_frame || num_generated > 0)
+			return num_generated;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return 0;
+}
+
+TEST_CASE("ElementLottie.frame_cache")
+{
+	// This test only works with the dummy renderer.
+	if (!TestsShell::GetTestsRenderInterface())
+		return;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsShell::GetTestsSystemInterface()->SetTime(0.0);
+	ElementDocument* document = context->LoadDocumentFromMemory(document_lottie_rml);
+	REQUIRE(document);
+	Element* element = document->GetElementById("animation");
+	REQUIRE(element);
+	document->Show();
+
+	// The animation runs at 25 frames per second, thus each of these times displays a separate frame.
+	constexpr int num_times = 4;
+	const double times[num_times] = {0.0, 0.1, 0.2, 0.3};
+
+	SUBCASE("Disabled")
+	{
+		for (double t : times)
+			CHECK(RenderAt(t, true) == 1);
+
+		// Without the frame cache, every frame is rendered and uploaded again.
+		for (double t : times)
+			CHECK(RenderAt(t, true) == 1);
+	}
+
+	SUBCASE("Enabled")
+	{
+		element->SetAttribute("frame-cache", num_times);
+
+		for (double t : times)
+			CHECK(RenderAt(t, true) == 1);
+
+		// All frames are cached along with their textures, so they are displayed immediately without any uploads.
+		for (double t : times)
+			CHECK(RenderAt(t, false) == 0);
+		for (int i = num_times - 1; i >= 0; i--)
+			CHECK(RenderAt(times[i], false) == 0);
+	}
+
+	SUBCASE("LeastRecentlyUsed")
+	{
+		element->SetAttribute("frame-cache", 2);
+
+		for (double t : times)
+			CHECK(RenderAt(t, true) == 1);
+
+		// Only the last two frames are cached, display them in reverse order so that the last frame becomes the least recently used one.
+		CHECK(RenderAt(times[3], false) == 0);
+		CHECK(RenderAt(times[2], false) == 0);
+
+		// The first frame was evicted, rendering it again evicts the last frame.
+		CHECK(RenderAt(times[0], true) == 1);
+		CHECK(RenderAt(times[2], false) == 0);
+		CHECK(RenderAt(times[3], true) == 1);
+
+		// Reducing the capacity keeps only the most recently displayed frame.
+		element->SetAttribute("frame-cache", 1);
+		CHECK(RenderAt(times[2], true) == 1);
+		CHECK(RenderAt(times[3], false) == 0);
+	}
+
+	document->Close();
+	TestsShell::GetTestsSystemInterface()->SetTime(0.0);
+	TestsShell::ShutdownShell();
+}
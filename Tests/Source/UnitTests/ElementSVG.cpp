@@ -0,0 +1,130 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/SVG/SVGCache.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_svg_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			width: 800px;
+			height: 600px;
+		}
+		svg {
+			display: inline-block;
+			width: 16px;
+			height: 16px;
+		}
+		svg.large {
+			width: 32px;
+			height: 32px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="icons"/>
+<svg class="large" src="/basic/svg/data/tiger.svg"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("ElementSVG.shared_cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const SVG::CacheStatistics initial = SVG::GetCacheStatistics();
+	REQUIRE(initial.num_documents == 0);
+	REQUIRE(initial.num_textures == 0);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_svg_rml);
+	REQUIRE(document);
+
+	constexpr int num_icons = 300;
+	String icons_rml;
+	for (int i = 0; i < num_icons; i++)
+		icons_rml += "<svg src=\"/basic/svg/data/tiger.svg\"/>";
+	document->GetElementById("icons")->SetInnerRML(icons_rml);
+
+	document->Show();
+	context->Update();
+	context->Render();
+
+	// All the icons share a single parsed document, and one texture per rendered size.
+	SVG::CacheStatistics statistics = SVG::GetCacheStatistics();
+	CHECK(statistics.num_documents == 1);
+	CHECK(statistics.num_document_loads - initial.num_document_loads == 1);
+	CHECK(statistics.num_textures == 2);
+	CHECK(statistics.num_texture_renders - initial.num_texture_renders == 2);
+	CHECK(statistics.document_source_bytes > 0);
+	CHECK(statistics.texture_bytes == (16 * 16 + 32 * 32) * 4);
+
+	// Resizing a single icon only adds a texture for the new size, while keeping the existing ones.
+	Element* icon = document->GetElementById("icons")->GetFirstChild();
+	icon->SetProperty("width", "24px");
+	icon->SetProperty("height", "24px");
+	context->Update();
+	context->Render();
+
+	statistics = SVG::GetCacheStatistics();
+	CHECK(statistics.num_documents == 1);
+	CHECK(statistics.num_document_loads - initial.num_document_loads == 1);
+	CHECK(statistics.num_textures == 3);
+	CHECK(statistics.num_texture_renders - initial.num_texture_renders == 3);
+
+	// Textures are released when no element uses them anymore.
+	document->GetElementById("icons")->SetInnerRML("");
+	context->Update();
+	context->Render();
+
+	statistics = SVG::GetCacheStatistics();
+	CHECK(statistics.num_documents == 1);
+	CHECK(statistics.num_textures == 1);
+	CHECK(statistics.texture_bytes == 32 * 32 * 4);
+
+	document->Close();
+	context->Update();
+
+	statistics = SVG::GetCacheStatistics();
+	CHECK(statistics.num_documents == 0);
+	CHECK(statistics.num_textures == 0);
+	CHECK(statistics.document_source_bytes == 0);
+	CHECK(statistics.texture_bytes == 0);
+
+	TestsShell::ShutdownShell();
+}
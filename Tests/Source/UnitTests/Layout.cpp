@@ -138,3 +138,162 @@ TEST_CASE("Layout.Position.Relative")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_layout_boundary_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 500px;
+			height: 400px;
+			top: 50px;
+			left: 50px;
+			font-family: LatoLatin;
+			font-size: 16px;
+		}
+		#list {
+			width: 200px;
+			height: 60px;
+			padding: 5px;
+			overflow: auto;
+		}
+		#absolute {
+			position: absolute;
+			top: 0;
+			right: 0;
+			width: 20px;
+			height: 20px;
+		}
+		#flex {
+			display: flex;
+		}
+		#flex > div {
+			flex: 1;
+			height: 50px;
+			overflow: hidden;
+		}
+	</style>
+</head>
+
+<body>
+	<div id="list">
+		<p id="row0">Row 0</p>
+		<p id="row1">Row 1</p>
+		<p id="row2">Row 2</p>
+	</div>
+	<div id="flex">
+		<div style="width: 100px"><span id="item0">Item 0</span></div>
+		<div style="width: 100px"><span id="item1">Item 1</span></div>
+	</div>
+	<p id="after">After</p>
+</body>
+</rml>
+)";
+
+static void CollectBoxes(Element* element, Vector<Rectanglef>& boxes)
+{
+	boxes.push_back(Rectanglef::FromPositionSize(element->GetAbsoluteOffset(), element->GetBox().GetSize(BoxArea::Border)));
+	for (int i = 0; i < element->GetNumChildren(true); i++)
+		CollectBoxes(element->GetChild(i), boxes);
+}
+
+TEST_CASE("Layout.Boundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_boundary_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* list = document->GetElementById("list");
+	Element* after = document->GetElementById("after");
+	const float after_top = after->GetAbsoluteTop();
+	const float list_scroll_height = list->GetScrollHeight();
+
+	auto CheckSameAsFullLayout = [&]() {
+		Vector<Rectanglef> boxes_incremental, boxes_full;
+		CollectBoxes(document, boxes_incremental);
+
+		// Setting a property on the document forces a layout of the whole document.
+		document->SetProperty("width", "500px");
+		context->Update();
+		CollectBoxes(document, boxes_full);
+
+		REQUIRE(boxes_incremental.size() == boxes_full.size());
+		for (size_t i = 0; i < boxes_full.size(); i++)
+			CHECK(boxes_incremental[i] == boxes_full[i]);
+	};
+
+	SUBCASE("Dirty flags")
+	{
+		// The dirty query is protected, access it through a member pointer named from a derived class.
+		struct LayoutQuery : Element {
+			static bool IsDirty(Element* element) { return (element->*&LayoutQuery::IsLayoutDirty)(); }
+		};
+		auto IsLayoutDirty = [](Element* element) { return LayoutQuery::IsDirty(element); };
+
+		Element* row1 = document->GetElementById("row1");
+		CHECK(!IsLayoutDirty(document));
+
+		row1->SetInnerRML("Row 1 changed");
+		CHECK(IsLayoutDirty(row1));
+		CHECK(IsLayoutDirty(list));
+		CHECK(IsLayoutDirty(document));
+		CHECK(!IsLayoutDirty(after));
+
+		context->Update();
+		CHECK(!IsLayoutDirty(row1));
+		CHECK(!IsLayoutDirty(list));
+		CHECK(!IsLayoutDirty(document));
+	}
+
+	SUBCASE("Scroll container")
+	{
+		Element* row1 = document->GetElementById("row1");
+		const float row1_height = row1->GetBox().GetSize().y;
+		row1->SetInnerRML("Row 1 with a lot more text that should wrap over several lines");
+		context->Update();
+
+		CHECK(row1->GetBox().GetSize().y > row1_height);
+		CHECK(list->GetScrollHeight() > list_scroll_height);
+		CHECK(after->GetAbsoluteTop() == after_top);
+		CheckSameAsFullLayout();
+	}
+
+	SUBCASE("Flex item")
+	{
+		document->GetElementById("item1")->SetInnerRML("Item 1 with a lot more text");
+		context->Update();
+
+		CHECK(after->GetAbsoluteTop() == after_top);
+		CheckSameAsFullLayout();
+	}
+
+	SUBCASE("Absolute element outside boundary")
+	{
+		// The containing block of the absolutely positioned element is outside the list, thus the whole document must be formatted.
+		ElementPtr absolute = document->CreateElement("div");
+		absolute->SetId("absolute");
+		list->AppendChild(std::move(absolute));
+		context->Update();
+
+		CHECK(document->GetElementById("absolute")->GetBox().GetSize() == Vector2f(20.f, 20.f));
+		CheckSameAsFullLayout();
+	}
+
+	SUBCASE("Boundary changed")
+	{
+		list->SetProperty("height", "100px");
+		document->GetElementById("row0")->SetInnerRML("Row 0 changed");
+		context->Update();
+
+		CHECK(after->GetAbsoluteTop() == after_top + 40.f);
+		CheckSameAsFullLayout();
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
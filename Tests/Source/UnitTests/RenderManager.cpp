@@ -0,0 +1,283 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/RenderInterface.h>
+#include <RmlUi/Core/RenderManager.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <algorithm>
+#include <doctest.h>
+
+using namespace Rml;
+
+// Records the rendered output in screen space, such that it can be compared regardless of how the draws are split up.
+class RecordingRenderInterface : public RenderInterface {
+public:
+	CompiledGeometryHandle CompileGeometry(Span<const Vertex> vertices, Span<const int> indices) override
+	{
+		meshes[++last_geometry] = Mesh{Vector<Vertex>(vertices.begin(), vertices.end()), Vector<int>(indices.begin(), indices.end())};
+		return last_geometry;
+	}
+	void RenderGeometry(CompiledGeometryHandle geometry, Vector2f translation, TextureHandle texture) override
+	{
+		num_render_calls += 1;
+		const Mesh& mesh = meshes.at(geometry);
+		for (int index : mesh.indices)
+		{
+			const Vertex& vertex = mesh.vertices[index];
+			const Vector2f position = vertex.position + translation;
+			output.push_back(CreateString("vertex %g %g #%02x%02x%02x%02x %g %g texture %d", position.x, position.y, vertex.colour.red,
+				vertex.colour.green, vertex.colour.blue, vertex.colour.alpha, vertex.tex_coord.x, vertex.tex_coord.y, (int)texture));
+		}
+	}
+	void ReleaseGeometry(CompiledGeometryHandle geometry) override { meshes.erase(geometry); }
+
+	TextureHandle LoadTexture(Vector2i& texture_dimensions, const String& /*source*/) override
+	{
+		texture_dimensions = {64, 64};
+		return ++last_texture;
+	}
+	TextureHandle GenerateTexture(Span<const byte> /*source*/, Vector2i /*source_dimensions*/) override { return ++last_texture; }
+	void ReleaseTexture(TextureHandle /*texture*/) override {}
+
+	void EnableScissorRegion(bool enable) override { output.push_back(CreateString("enable scissor %d", (int)enable)); }
+	void SetScissorRegion(Rectanglei region) override
+	{
+		output.push_back(CreateString("scissor %d %d %d %d", region.Left(), region.Top(), region.Right(), region.Bottom()));
+	}
+	void SetTransform(const Matrix4f* transform) override { output.push_back(transform ? "transform" : "transform identity"); }
+
+	void ResetOutput()
+	{
+		output.clear();
+		num_render_calls = 0;
+	}
+
+	StringList output;
+	int num_render_calls = 0;
+
+private:
+	UnorderedMap<CompiledGeometryHandle, Mesh> meshes;
+	CompiledGeometryHandle last_geometry = 0;
+	TextureHandle last_texture = 0;
+};
+
+// Refers to the compiled vertex and index data instead of copying them, like some of the backends do. Counts the compiled geometry whose data
+// changed before it was released, which is not allowed by the render interface.
+class ReferencingRenderInterface : public RecordingRenderInterface {
+public:
+	CompiledGeometryHandle CompileGeometry(Span<const Vertex> vertices, Span<const int> indices) override
+	{
+		const CompiledGeometryHandle geometry = RecordingRenderInterface::CompileGeometry(vertices, indices);
+		references[geometry] = Reference{vertices, indices, Vector<Vertex>(vertices.begin(), vertices.end()),
+			Vector<int>(indices.begin(), indices.end())};
+		num_compiled_geometries += 1;
+		return geometry;
+	}
+	void RenderGeometry(CompiledGeometryHandle geometry, Vector2f translation, TextureHandle texture) override
+	{
+		for (auto& pair : references)
+			CheckUnchanged(pair.second);
+		RecordingRenderInterface::RenderGeometry(geometry, translation, texture);
+	}
+	void ReleaseGeometry(CompiledGeometryHandle geometry) override
+	{
+		auto it = references.find(geometry);
+		if (it != references.end())
+		{
+			CheckUnchanged(it->second);
+			references.erase(it);
+		}
+		RecordingRenderInterface::ReleaseGeometry(geometry);
+	}
+
+	int num_compiled_geometries = 0;
+	int num_changed_geometries = 0;
+
+private:
+	struct Reference {
+		Span<const Vertex> vertices;
+		Span<const int> indices;
+		Vector<Vertex> vertices_copy;
+		Vector<int> indices_copy;
+		bool changed = false;
+	};
+
+	void CheckUnchanged(Reference& reference)
+	{
+		if (reference.changed)
+			return;
+		const bool vertices_equal = std::equal(reference.vertices.begin(), reference.vertices.end(), reference.vertices_copy.begin(),
+			reference.vertices_copy.end(), [](const Vertex& a, const Vertex& b) {
+				return a.position == b.position && a.colour == b.colour && a.tex_coord == b.tex_coord;
+			});
+		const bool indices_equal =
+			std::equal(reference.indices.begin(), reference.indices.end(), reference.indices_copy.begin(), reference.indices_copy.end());
+		if (!vertices_equal || !indices_equal)
+		{
+			reference.changed = true;
+			num_changed_geometries += 1;
+		}
+	}
+
+	UnorderedMap<CompiledGeometryHandle, Reference> references;
+};
+
+static const String document_batching_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 14px;
+			color: #333;
+		}
+		div.row {
+			height: 20px;
+			border: 1px #ccc;
+			background-color: #eee;
+		}
+		div.clip {
+			height: 50px;
+			overflow: hidden;
+		}
+		div.rotated {
+			transform: rotate(5deg);
+		}
+	</style>
+</head>
+
+<body>
+	<div class="row">First row</div>
+	<div class="row">Second row</div>
+	<img src="/assets/high_scores_alien_1.tga"/>
+	<div class="clip">
+		<div class="row">Clipped row</div>
+		<div class="row">Clipped row</div>
+		<div class="row">Clipped row</div>
+	</div>
+	<div class="rotated">
+		<div class="row">Transformed row</div>
+	</div>
+	<div class="row">Last row</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("RenderManager.Batching")
+{
+	// Initialize the shell for its interfaces and fonts.
+	TestsShell::GetContext();
+
+	RecordingRenderInterface render_interface;
+	Context* context = Rml::CreateContext("batching", Vector2i(1280, 720), &render_interface);
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	REQUIRE(document);
+	document->Show();
+
+	RenderManager& render_manager = context->GetRenderManager();
+	CHECK(!render_manager.IsBatchingEnabled());
+
+	auto RenderFrame = [&](bool enable_batching) {
+		render_manager.EnableBatching(enable_batching);
+		context->Update();
+		context->Render();
+		render_interface.ResetOutput();
+		context->Render();
+		return render_interface.num_render_calls;
+	};
+
+	const int num_calls_unbatched = RenderFrame(false);
+	const StringList output_unbatched = render_interface.output;
+
+	const int num_calls_batched = RenderFrame(true);
+	const StringList output_batched = render_interface.output;
+
+	MESSAGE("Render calls without batching: ", num_calls_unbatched, ", with batching: ", num_calls_batched);
+	CHECK(num_calls_batched > 0);
+	CHECK(num_calls_batched < num_calls_unbatched);
+
+	// The rendered vertices and render state should be identical, in the same order.
+	REQUIRE(output_batched.size() == output_unbatched.size());
+	for (size_t i = 0; i < output_batched.size(); i++)
+		CHECK(output_batched[i] == output_unbatched[i]);
+
+	// The output should stay the same when disabling batching again.
+	RenderFrame(false);
+	CHECK(render_interface.output == output_unbatched);
+
+	document->Close();
+	Rml::RemoveContext("batching");
+	Rml::ReleaseRenderManagers();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("RenderManager.BatchGeometryLifetime")
+{
+	TestsShell::GetContext();
+
+	ReferencingRenderInterface render_interface;
+	Context* context = Rml::CreateContext("batching", Vector2i(1280, 720), &render_interface);
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	REQUIRE(document);
+	document->Show();
+
+	RenderManager& render_manager = context->GetRenderManager();
+	render_manager.EnableBatching(true);
+	context->Update();
+	context->Render();
+
+	// All element geometry is compiled during the first frame, thereby anything compiled during the next frame is merged batch geometry.
+	// The image switches the texture, which splits the rows into multiple batches within the same frame.
+	for (int i = 0; i < 3; i++)
+	{
+		const int num_compiled_before = render_interface.num_compiled_geometries;
+		context->Render();
+		CHECK(render_interface.num_compiled_geometries - num_compiled_before >= 2);
+	}
+
+	document->Close();
+	Rml::RemoveContext("batching");
+	Rml::ReleaseRenderManagers();
+
+	// The data of each batch must stay unchanged until it is released, even when further batches are compiled in the meantime.
+	CHECK(render_interface.num_compiled_geometries > 0);
+	CHECK(render_interface.num_changed_geometries == 0);
+
+	TestsShell::ShutdownShell();
+}
@@ -31,6 +31,8 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/StyleSheetContainer.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 
@@ -539,3 +541,224 @@ TEST_CASE("Selectors")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("Selectors.invalidation")
+{
+	const String document_rml = R"(
+<rml>
+<head>
+	<style>
+		body { width: 400px; height: 300px; }
+		div { width: 10px; }
+		.on { width: 20px; }
+		.parent:hover p { width: 30px; }
+		.parent.on p { width: 40px; }
+		#toggle + p { width: 50px; }
+		span:not(.on) p { width: 60px; }
+		[data-wide] p { width: 70px; }
+		p { width: 5px; }
+		p:custom-state { width: 80px; }
+		p:hover:custom-state { width: 90px; }
+	</style>
+</head>
+<body>
+	<div id="subject"/>
+	<div id="parent" class="parent"><p id="child"/></div>
+	<div id="sibling"/><p id="next"/>
+	<span id="span"><p id="negated"/></span>
+	<div id="attribute"><p id="attribute_child"/></div>
+</body>
+</rml>
+)";
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	auto width = [document](const String& id) {
+		Element* element = document->GetElementById(id);
+		REQUIRE(element);
+		return element->GetProperty("width")->ToString();
+	};
+
+	CHECK(width("subject") == "10px");
+	CHECK(width("child") == "5px");
+	CHECK(width("next") == "5px");
+	CHECK(width("negated") == "60px");
+	CHECK(width("attribute_child") == "5px");
+
+	document->GetElementById("subject")->SetClass("on", true);
+	document->GetElementById("parent")->SetPseudoClass("hover", true);
+	document->GetElementById("sibling")->SetId("toggle");
+	document->GetElementById("span")->SetClass("on", true);
+	document->GetElementById("attribute")->SetAttribute("data-wide", "");
+	context->Update();
+
+	CHECK(width("subject") == "20px");
+	CHECK(width("child") == "30px");
+	CHECK(width("next") == "50px");
+	CHECK(width("negated") == "5px");
+	CHECK(width("attribute_child") == "70px");
+
+	document->GetElementById("parent")->SetPseudoClass("hover", false);
+	document->GetElementById("parent")->SetClass("on", true);
+	context->Update();
+	CHECK(width("child") == "40px");
+
+	document->GetElementById("negated")->SetPseudoClass("custom-state", true);
+	context->Update();
+	CHECK(width("negated") == "80px");
+
+	document->GetElementById("negated")->SetPseudoClass("hover", true);
+	context->Update();
+	CHECK(width("negated") == "90px");
+
+	document->GetElementById("negated")->SetPseudoClass("hover", false);
+	document->GetElementById("negated")->SetPseudoClass("custom-state", false);
+	context->Update();
+	CHECK(width("negated") == "5px");
+
+	document->GetElementById("subject")->SetClass("on", false);
+	document->GetElementById("parent")->SetClassNames("parent");
+	document->GetElementById("toggle")->SetId("sibling");
+	document->GetElementById("span")->SetClass("on", false);
+	document->GetElementById("attribute")->RemoveAttribute("data-wide");
+	context->Update();
+
+	CHECK(width("subject") == "10px");
+	CHECK(width("child") == "5px");
+	CHECK(width("next") == "5px");
+	CHECK(width("negated") == "60px");
+	CHECK(width("attribute_child") == "5px");
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Selectors.names_added_by_later_style_sheet")
+{
+	// Names of elements are only interned by selectors. Thus, names set on elements before any selector uses them must still match once a
+	// style sheet using them is loaded.
+	const String document_rml = R"(
+<rml>
+<head>
+	<style>
+		body { width: 400px; height: 300px; }
+	</style>
+</head>
+<body>
+	<div id="late-id"><p id="child" class="late-class"/></div>
+	<late-tag id="tag"/>
+	<span id="pseudo"/>
+</body>
+</rml>
+)";
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->GetElementById("pseudo")->SetPseudoClass("late-state", true);
+	document->Show();
+	context->Update();
+
+	auto width = [document](const String& id) {
+		Element* element = document->GetElementById(id);
+		REQUIRE(element);
+		return element->GetProperty("width")->ToString();
+	};
+
+	CHECK(width("late-id") == "auto");
+	CHECK(width("child") == "auto");
+	CHECK(width("tag") == "auto");
+	CHECK(width("pseudo") == "auto");
+
+	document->SetStyleSheetContainer(Factory::InstanceStyleSheetString(R"(
+		body { width: 400px; height: 300px; }
+		#late-id { width: 10px; }
+		#late-id .late-class { width: 20px; }
+		late-tag { width: 30px; }
+		span:late-state { width: 40px; }
+	)"));
+	context->Update();
+
+	CHECK(width("late-id") == "10px");
+	CHECK(width("child") == "20px");
+	CHECK(width("tag") == "30px");
+	CHECK(width("pseudo") == "40px");
+
+	document->GetElementById("pseudo")->SetPseudoClass("late-state", false);
+	document->GetElementById("child")->SetClass("late-class", false);
+	context->Update();
+	CHECK(width("pseudo") == "auto");
+	CHECK(width("child") == "auto");
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Selectors.ancestor_filter")
+{
+	const String document_rml = R"(
+<rml>
+<head>
+	<style>
+		body { width: 400px; height: 300px; }
+		p { width: 5px; }
+		.outer .inner p { width: 10px; }
+		#outer > div > p.child { width: 20px; }
+		.sibling + div p.nested { width: 30px; }
+		span.missing p { width: 40px; }
+	</style>
+</head>
+<body>
+	<div id="outer" class="outer">
+		<div class="inner"><p id="p0"/><p id="p1" class="child"/></div>
+	</div>
+	<div class="sibling"/>
+	<div><div><p id="p2" class="nested"/></div></div>
+</body>
+</rml>
+)";
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	auto width = [document](const String& id) {
+		Element* element = document->GetElementById(id);
+		REQUIRE(element);
+		return element->GetProperty("width")->ToString();
+	};
+
+	CHECK(width("p0") == "10px");
+	CHECK(width("p1") == "20px");
+	CHECK(width("p2") == "30px");
+
+	document->GetElementById("outer")->SetClass("outer", false);
+	context->Update();
+	CHECK(width("p0") == "5px");
+	CHECK(width("p1") == "20px");
+
+	document->GetElementById("outer")->SetClass("outer", true);
+	document->GetElementById("outer")->SetId("renamed");
+	context->Update();
+	CHECK(width("p0") == "10px");
+	CHECK(width("p1") == "10px");
+
+	// Queries are matched outside of the update traversal.
+	CHECK(document->QuerySelector(".outer .inner p") == document->GetElementById("p0"));
+	CHECK(document->QuerySelector(".sibling + div p") == document->GetElementById("p2"));
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
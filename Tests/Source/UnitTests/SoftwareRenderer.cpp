@@ -0,0 +1,535 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core/DecorationTypes.h>
+#include <RmlUi/Core/Math.h>
+#include <RmlUi/Core/Mesh.h>
+#include <RmlUi/Core/MeshUtilities.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <RmlUi/Core/Types.h>
+#include <RmlUi/Core/Variant.h>
+#include <RmlUi_Renderer_Software.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+namespace {
+
+constexpr int viewport_size = 16;
+
+const ColourbPremultiplied transparent(0, 0);
+const ColourbPremultiplied red(255, 0, 0, 255);
+const ColourbPremultiplied blue(0, 0, 255, 255);
+const ColourbPremultiplied white(255, 255, 255, 255);
+
+// A quad compiled by the renderer, the mesh must outlive the geometry handle.
+struct Quad {
+	Quad(RenderInterface_Software& renderer, Vector2f origin, Vector2f size, ColourbPremultiplied colour, Vector2f top_left_texcoord = {0, 0},
+		Vector2f bottom_right_texcoord = {1, 1}) :
+		renderer(renderer)
+	{
+		MeshUtilities::GenerateQuad(mesh, origin, size, colour, top_left_texcoord, bottom_right_texcoord);
+		handle = renderer.CompileGeometry(mesh.vertices, mesh.indices);
+	}
+	~Quad() { renderer.ReleaseGeometry(handle); }
+
+	RenderInterface_Software& renderer;
+	Mesh mesh;
+	CompiledGeometryHandle handle = {};
+};
+
+struct TestRenderer : RenderInterface_Software {
+	explicit TestRenderer(int num_threads = 1, Vector2i size = Vector2i(viewport_size)) : RenderInterface_Software(num_threads)
+	{
+		SetViewport(size.x, size.y);
+	}
+
+	ColourbPremultiplied Pixel(int x, int y) const { return GetFramePixels()[y * GetFrameSize().x + x]; }
+
+	int CountPixels(ColourbPremultiplied colour) const
+	{
+		int count = 0;
+		for (const ColourbPremultiplied pixel : GetFramePixels())
+			count += int(pixel == colour);
+		return count;
+	}
+};
+
+bool IsNear(ColourbPremultiplied a, ColourbPremultiplied b, int tolerance = 1)
+{
+	for (int i = 0; i < 4; i++)
+	{
+		if (Math::Absolute(int(a[i]) - int(b[i])) > tolerance)
+			return false;
+	}
+	return true;
+}
+
+String ToString(ColourbPremultiplied c)
+{
+	return CreateString("(%d, %d, %d, %d)", c.red, c.green, c.blue, c.alpha);
+}
+
+#define CHECK_PIXEL(renderer, x, y, expected)                                                                                                   \
+	CHECK_MESSAGE(IsNear((renderer).Pixel(x, y), expected), "Pixel (", x, ", ", y, ") is ", ToString((renderer).Pixel(x, y)), ", expected ", \
+		ToString(expected))
+
+ColorStopList MakeStops(ColourbPremultiplied first, ColourbPremultiplied last)
+{
+	return ColorStopList{ColorStop{first, NumericValue(0.f, Unit::NUMBER)}, ColorStop{last, NumericValue(1.f, Unit::NUMBER)}};
+}
+
+} // namespace
+
+TEST_CASE("SoftwareRenderer.Geometry")
+{
+	TestRenderer renderer;
+	Quad background(renderer, {0, 0}, Vector2f(viewport_size), blue);
+	Quad square(renderer, {2, 2}, {4, 4}, red);
+	Quad translucent(renderer, {0, 0}, {1, 1}, ColourbPremultiplied(128, 0, 0, 128));
+
+	renderer.BeginFrame();
+	renderer.RenderGeometry(square.handle, {}, {});
+	renderer.RenderGeometry(square.handle, {8, 8}, {});
+	renderer.EndFrame();
+
+	REQUIRE(renderer.GetFrameSize() == Vector2i(viewport_size));
+	CHECK(renderer.CountPixels(red) == 2 * 4 * 4);
+	CHECK_PIXEL(renderer, 2, 2, red);
+	CHECK_PIXEL(renderer, 5, 5, red);
+	CHECK_PIXEL(renderer, 1, 2, transparent);
+	CHECK_PIXEL(renderer, 6, 5, transparent);
+	CHECK_PIXEL(renderer, 10, 13, red);
+	CHECK_PIXEL(renderer, 14, 14, transparent);
+
+	// Premultiplied blending onto an opaque background.
+	renderer.BeginFrame();
+	renderer.RenderGeometry(background.handle, {}, {});
+	renderer.RenderGeometry(translucent.handle, {3, 4}, {});
+	renderer.EndFrame();
+
+	CHECK_PIXEL(renderer, 3, 4, ColourbPremultiplied(128, 0, 127, 255));
+	CHECK_PIXEL(renderer, 4, 4, blue);
+	CHECK(renderer.CountPixels(blue) == viewport_size * viewport_size - 1);
+}
+
+TEST_CASE("SoftwareRenderer.Texture")
+{
+	TestRenderer renderer;
+	Quad quad(renderer, {4, 4}, {2, 2}, white);
+
+	const byte texture_data[] = {
+		255, 0, 0, 255, /**/ 0, 255, 0, 255, //
+		0, 0, 255, 255, /**/ 0, 0, 0, 0,     //
+	};
+	const TextureHandle texture = renderer.GenerateTexture({texture_data, sizeof(texture_data)}, {2, 2});
+	REQUIRE(texture);
+
+	renderer.BeginFrame();
+	renderer.RenderGeometry(quad.handle, {}, texture);
+	renderer.EndFrame();
+
+	// Texel centers map exactly to pixel centers, so no filtering should take place.
+	CHECK_PIXEL(renderer, 4, 4, red);
+	CHECK_PIXEL(renderer, 5, 4, ColourbPremultiplied(0, 255, 0, 255));
+	CHECK_PIXEL(renderer, 4, 5, blue);
+	CHECK_PIXEL(renderer, 5, 5, transparent);
+
+	renderer.ReleaseTexture(texture);
+}
+
+TEST_CASE("SoftwareRenderer.Scissor")
+{
+	TestRenderer renderer;
+	Quad quad(renderer, {0, 0}, Vector2f(viewport_size), red);
+
+	renderer.BeginFrame();
+	renderer.EnableScissorRegion(true);
+	renderer.SetScissorRegion(Rectanglei::FromPositionSize({2, 3}, {4, 5}));
+	renderer.RenderGeometry(quad.handle, {}, {});
+	renderer.EnableScissorRegion(false);
+	renderer.EndFrame();
+
+	CHECK(renderer.CountPixels(red) == 4 * 5);
+	CHECK_PIXEL(renderer, 2, 3, red);
+	CHECK_PIXEL(renderer, 5, 7, red);
+	CHECK_PIXEL(renderer, 1, 3, transparent);
+	CHECK_PIXEL(renderer, 2, 2, transparent);
+	CHECK_PIXEL(renderer, 6, 7, transparent);
+	CHECK_PIXEL(renderer, 5, 8, transparent);
+
+	// A scissor region partially outside the viewport.
+	renderer.BeginFrame();
+	renderer.EnableScissorRegion(true);
+	renderer.SetScissorRegion(Rectanglei::FromPositionSize({12, -4}, {10, 6}));
+	renderer.RenderGeometry(quad.handle, {}, {});
+	renderer.EnableScissorRegion(false);
+	renderer.EndFrame();
+
+	CHECK(renderer.CountPixels(red) == 4 * 2);
+	CHECK_PIXEL(renderer, 15, 0, red);
+	CHECK_PIXEL(renderer, 12, 1, red);
+	CHECK_PIXEL(renderer, 12, 2, transparent);
+}
+
+TEST_CASE("SoftwareRenderer.ClipMask")
+{
+	TestRenderer renderer;
+	Quad quad(renderer, {0, 0}, Vector2f(viewport_size), red);
+	Quad mask(renderer, {0, 0}, {8, 8}, white);
+
+	SUBCASE("Set")
+	{
+		renderer.BeginFrame();
+		renderer.EnableClipMask(true);
+		renderer.RenderToClipMask(ClipMaskOperation::Set, mask.handle, {2, 2});
+		renderer.RenderGeometry(quad.handle, {}, {});
+		renderer.EnableClipMask(false);
+		renderer.EndFrame();
+
+		CHECK(renderer.CountPixels(red) == 8 * 8);
+		CHECK_PIXEL(renderer, 2, 2, red);
+		CHECK_PIXEL(renderer, 9, 9, red);
+		CHECK_PIXEL(renderer, 1, 1, transparent);
+		CHECK_PIXEL(renderer, 10, 10, transparent);
+	}
+
+	SUBCASE("SetInverse")
+	{
+		renderer.BeginFrame();
+		renderer.EnableClipMask(true);
+		renderer.RenderToClipMask(ClipMaskOperation::SetInverse, mask.handle, {});
+		renderer.RenderGeometry(quad.handle, {}, {});
+		renderer.EnableClipMask(false);
+		renderer.EndFrame();
+
+		CHECK(renderer.CountPixels(red) == viewport_size * viewport_size - 8 * 8);
+		CHECK_PIXEL(renderer, 7, 7, transparent);
+		CHECK_PIXEL(renderer, 8, 0, red);
+		CHECK_PIXEL(renderer, 0, 8, red);
+	}
+
+	SUBCASE("Intersect")
+	{
+		renderer.BeginFrame();
+		renderer.EnableClipMask(true);
+		renderer.RenderToClipMask(ClipMaskOperation::Set, mask.handle, {});
+		renderer.RenderToClipMask(ClipMaskOperation::Intersect, mask.handle, {4, 6});
+		renderer.RenderGeometry(quad.handle, {}, {});
+		renderer.EnableClipMask(false);
+		renderer.EndFrame();
+
+		CHECK(renderer.CountPixels(red) == 4 * 2);
+		CHECK_PIXEL(renderer, 4, 6, red);
+		CHECK_PIXEL(renderer, 7, 7, red);
+		CHECK_PIXEL(renderer, 3, 6, transparent);
+		CHECK_PIXEL(renderer, 4, 5, transparent);
+		CHECK_PIXEL(renderer, 8, 7, transparent);
+	}
+
+	SUBCASE("Disabled")
+	{
+		renderer.BeginFrame();
+		renderer.EnableClipMask(true);
+		renderer.RenderToClipMask(ClipMaskOperation::Set, mask.handle, {});
+		renderer.EnableClipMask(false);
+		renderer.RenderGeometry(quad.handle, {}, {});
+		renderer.EndFrame();
+
+		CHECK(renderer.CountPixels(red) == viewport_size * viewport_size);
+	}
+}
+
+TEST_CASE("SoftwareRenderer.Layers")
+{
+	TestRenderer renderer;
+	Quad background(renderer, {0, 0}, Vector2f(viewport_size), blue);
+	Quad translucent(renderer, {0, 0}, {8, 8}, ColourbPremultiplied(128, 0, 0, 128));
+
+	auto RenderLayer = [&](BlendMode blend_mode, Span<const CompiledFilterHandle> filters) {
+		renderer.BeginFrame();
+		renderer.RenderGeometry(background.handle, {}, {});
+		const LayerHandle layer = renderer.PushLayer();
+		CHECK(layer != LayerHandle(0));
+		renderer.RenderGeometry(translucent.handle, {}, {});
+		renderer.CompositeLayers(layer, LayerHandle(0), blend_mode, filters);
+		renderer.PopLayer();
+		renderer.EndFrame();
+	};
+
+	SUBCASE("Blend")
+	{
+		RenderLayer(BlendMode::Blend, {});
+		CHECK_PIXEL(renderer, 0, 0, ColourbPremultiplied(128, 0, 127, 255));
+		CHECK_PIXEL(renderer, 7, 7, ColourbPremultiplied(128, 0, 127, 255));
+		CHECK_PIXEL(renderer, 8, 8, blue);
+	}
+
+	SUBCASE("Replace")
+	{
+		RenderLayer(BlendMode::Replace, {});
+		CHECK_PIXEL(renderer, 0, 0, ColourbPremultiplied(128, 0, 0, 128));
+		CHECK_PIXEL(renderer, 8, 8, transparent);
+	}
+
+	SUBCASE("Opacity")
+	{
+		const CompiledFilterHandle opacity = renderer.CompileFilter("opacity", Dictionary{{"value", Variant(0.5f)}});
+		REQUIRE(opacity);
+		const CompiledFilterHandle filters[] = {opacity};
+
+		RenderLayer(BlendMode::Replace, {filters, 1});
+		CHECK_PIXEL(renderer, 0, 0, ColourbPremultiplied(64, 0, 0, 64));
+		CHECK_PIXEL(renderer, 8, 8, transparent);
+
+		renderer.ReleaseFilter(opacity);
+	}
+
+	SUBCASE("Scissor")
+	{
+		// Compositing only affects the scissor region.
+		renderer.BeginFrame();
+		renderer.RenderGeometry(background.handle, {}, {});
+		const LayerHandle layer = renderer.PushLayer();
+		renderer.RenderGeometry(translucent.handle, {}, {});
+		renderer.EnableScissorRegion(true);
+		renderer.SetScissorRegion(Rectanglei::FromPositionSize({0, 0}, {2, 2}));
+		renderer.CompositeLayers(layer, LayerHandle(0), BlendMode::Replace, {});
+		renderer.EnableScissorRegion(false);
+		renderer.PopLayer();
+		renderer.EndFrame();
+
+		CHECK(renderer.CountPixels(ColourbPremultiplied(128, 0, 0, 128)) == 2 * 2);
+		CHECK(renderer.CountPixels(blue) == viewport_size * viewport_size - 2 * 2);
+	}
+}
+
+TEST_CASE("SoftwareRenderer.Filters")
+{
+	TestRenderer renderer;
+
+	auto RenderFiltered = [&](CompiledGeometryHandle geometry, CompiledFilterHandle filter) {
+		REQUIRE(filter);
+		const CompiledFilterHandle filters[] = {filter};
+		renderer.BeginFrame();
+		const LayerHandle layer = renderer.PushLayer();
+		renderer.RenderGeometry(geometry, {}, {});
+		renderer.CompositeLayers(layer, LayerHandle(0), BlendMode::Blend, {filters, 1});
+		renderer.PopLayer();
+		renderer.EndFrame();
+		renderer.ReleaseFilter(filter);
+	};
+
+	SUBCASE("Grayscale")
+	{
+		Quad quad(renderer, {0, 0}, {4, 4}, red);
+		RenderFiltered(quad.handle, renderer.CompileFilter("grayscale", Dictionary{{"value", Variant(1.f)}}));
+		CHECK_PIXEL(renderer, 0, 0, ColourbPremultiplied(54, 54, 54, 255));
+		CHECK_PIXEL(renderer, 4, 4, transparent);
+	}
+
+	SUBCASE("Invert")
+	{
+		Quad quad(renderer, {0, 0}, {4, 4}, ColourbPremultiplied(255, 0, 0, 255));
+		RenderFiltered(quad.handle, renderer.CompileFilter("invert", Dictionary{{"value", Variant(1.f)}}));
+		CHECK_PIXEL(renderer, 3, 3, ColourbPremultiplied(0, 255, 255, 255));
+		CHECK_PIXEL(renderer, 4, 4, transparent);
+	}
+
+	SUBCASE("DropShadow")
+	{
+		Quad quad(renderer, {2, 2}, {2, 2}, white);
+		const Dictionary parameters = {
+			{"color", Variant(Colourb(0, 0, 0, 255))},
+			{"offset", Variant(Vector2f(3, 3))},
+			{"sigma", Variant(0.f)},
+		};
+		RenderFiltered(quad.handle, renderer.CompileFilter("drop-shadow", parameters));
+
+		CHECK(renderer.CountPixels(white) == 2 * 2);
+		CHECK(renderer.CountPixels(ColourbPremultiplied(0, 0, 0, 255)) == 2 * 2);
+		CHECK_PIXEL(renderer, 2, 2, white);
+		CHECK_PIXEL(renderer, 3, 3, white);
+		CHECK_PIXEL(renderer, 5, 5, ColourbPremultiplied(0, 0, 0, 255));
+		CHECK_PIXEL(renderer, 6, 6, ColourbPremultiplied(0, 0, 0, 255));
+		CHECK_PIXEL(renderer, 4, 4, transparent);
+		CHECK_PIXEL(renderer, 7, 7, transparent);
+	}
+
+	SUBCASE("Blur")
+	{
+		// Blurring the left half of the viewport should result in a smooth, horizontal transition around the center.
+		Quad quad(renderer, {0, 0}, {viewport_size / 2, viewport_size}, white);
+		RenderFiltered(quad.handle, renderer.CompileFilter("blur", Dictionary{{"sigma", Variant(2.f)}}));
+
+		const int y = viewport_size / 2;
+		CHECK_PIXEL(renderer, 0, y, white);
+		CHECK_PIXEL(renderer, viewport_size - 1, y, transparent);
+
+		const int center_left = renderer.Pixel(viewport_size / 2 - 1, y).alpha;
+		const int center_right = renderer.Pixel(viewport_size / 2, y).alpha;
+		CHECK(center_left > 128);
+		CHECK(center_left < 255);
+		CHECK(center_right > 0);
+		CHECK(center_right < 128);
+		CHECK(Math::Absolute(center_left + center_right - 255) <= 2);
+
+		for (int x = 1; x < viewport_size; x++)
+		{
+			CHECK(renderer.Pixel(x, y).alpha <= renderer.Pixel(x - 1, y).alpha);
+			CHECK(renderer.Pixel(x, 0) == renderer.Pixel(x, y));
+		}
+	}
+}
+
+TEST_CASE("SoftwareRenderer.Gradients")
+{
+	TestRenderer renderer;
+
+	SUBCASE("Linear")
+	{
+		// Texture coordinates are used as the gradient positions, here mapped to pixel coordinates.
+		Quad quad(renderer, {0, 0}, {viewport_size, 1}, white, {0, 0}, {viewport_size, 1});
+		const Dictionary parameters = {
+			{"p0", Variant(Vector2f(0, 0))},
+			{"p1", Variant(Vector2f(viewport_size, 0))},
+			{"color_stop_list", Variant(MakeStops(red, blue))},
+		};
+		const CompiledShaderHandle shader = renderer.CompileShader("linear-gradient", parameters);
+		REQUIRE(shader);
+
+		renderer.BeginFrame();
+		renderer.RenderShader(shader, quad.handle, {}, {});
+		renderer.EndFrame();
+		renderer.ReleaseShader(shader);
+
+		CHECK_PIXEL(renderer, 0, 0, ColourbPremultiplied(254, 0, 1, 255));
+		CHECK_PIXEL(renderer, viewport_size - 1, 0, ColourbPremultiplied(1, 0, 254, 255));
+		for (int x = 0; x < viewport_size; x++)
+		{
+			const ColourbPremultiplied pixel = renderer.Pixel(x, 0);
+			const ColourbPremultiplied mirrored = renderer.Pixel(viewport_size - 1 - x, 0);
+			CHECK(pixel.alpha == 255);
+			CHECK(Math::Absolute(int(pixel.red) - int(mirrored.blue)) <= 1);
+			CHECK(Math::Absolute(int(pixel.red) + int(pixel.blue) - 255) <= 1);
+			if (x > 0)
+				CHECK(pixel.red < renderer.Pixel(x - 1, 0).red);
+		}
+		CHECK_PIXEL(renderer, 0, 1, transparent);
+	}
+
+	SUBCASE("Radial")
+	{
+		Quad quad(renderer, {0, 0}, Vector2f(viewport_size), white, {0, 0}, Vector2f(viewport_size));
+		const Dictionary parameters = {
+			{"center", Variant(Vector2f(viewport_size / 2))},
+			{"radius", Variant(Vector2f(viewport_size / 2))},
+			{"color_stop_list", Variant(MakeStops(white, transparent))},
+		};
+		const CompiledShaderHandle shader = renderer.CompileShader("radial-gradient", parameters);
+		REQUIRE(shader);
+
+		renderer.BeginFrame();
+		renderer.RenderShader(shader, quad.handle, {}, {});
+		renderer.EndFrame();
+		renderer.ReleaseShader(shader);
+
+		CHECK_PIXEL(renderer, viewport_size / 2, viewport_size / 2, ColourbPremultiplied(249, 249, 249, 249));
+		CHECK_PIXEL(renderer, 0, 0, transparent);
+		CHECK_PIXEL(renderer, viewport_size - 1, viewport_size - 1, transparent);
+
+		// The gradient is symmetric around its center, which lies on the corner between the four center pixels.
+		const int c = viewport_size / 2;
+		for (int d = 0; d < c; d++)
+		{
+			CHECK(renderer.Pixel(c + d, c) == renderer.Pixel(c - 1 - d, c));
+			CHECK(renderer.Pixel(c, c + d) == renderer.Pixel(c, c - 1 - d));
+			if (d > 0)
+				CHECK(renderer.Pixel(c + d, c).alpha < renderer.Pixel(c + d - 1, c).alpha);
+		}
+	}
+}
+
+TEST_CASE("SoftwareRenderer.Threads")
+{
+	// The rendered frame should not depend on how it is split into tiles and distributed among threads.
+	const Vector2i size = {200, 150};
+	TestRenderer single_thread(1, size);
+	TestRenderer multiple_threads(4, size);
+
+	auto Render = [&](TestRenderer& renderer) {
+		Quad quad(renderer, {10, 20}, {170, 110}, ColourbPremultiplied(200, 100, 50, 200), {0, 0}, {1, 1});
+		Quad mask(renderer, {40, 30}, {100, 100}, white);
+
+		const Dictionary parameters = {
+			{"center", Variant(Vector2f(0.5f, 0.5f))},
+			{"angle", Variant(0.3f)},
+			{"color_stop_list", Variant(MakeStops(red, blue))},
+		};
+		const CompiledShaderHandle shader = renderer.CompileShader("conic-gradient", parameters);
+		REQUIRE(shader);
+		const CompiledFilterHandle blur = renderer.CompileFilter("blur", Dictionary{{"sigma", Variant(3.f)}});
+		REQUIRE(blur);
+		const CompiledFilterHandle filters[] = {blur};
+
+		const Matrix4f rotation = Matrix4f::Translate(100, 75, 0) * Matrix4f::RotateZ(0.2f) * Matrix4f::Translate(-100, -75, 0);
+
+		renderer.BeginFrame();
+		renderer.RenderGeometry(quad.handle, {}, {});
+		const LayerHandle layer = renderer.PushLayer();
+		renderer.SetTransform(&rotation);
+		renderer.RenderShader(shader, quad.handle, {5, 5}, {});
+		renderer.SetTransform(nullptr);
+		renderer.EnableClipMask(true);
+		renderer.RenderToClipMask(ClipMaskOperation::SetInverse, mask.handle, {});
+		renderer.CompositeLayers(layer, LayerHandle(0), BlendMode::Blend, {filters, 1});
+		renderer.EnableClipMask(false);
+		renderer.PopLayer();
+		renderer.EndFrame();
+
+		renderer.ReleaseFilter(blur);
+		renderer.ReleaseShader(shader);
+	};
+
+	Render(single_thread);
+	Render(multiple_threads);
+
+	const Span<const ColourbPremultiplied> expected = single_thread.GetFramePixels();
+	const Span<const ColourbPremultiplied> result = multiple_threads.GetFramePixels();
+	REQUIRE(expected.size() == size_t(size.x * size.y));
+	REQUIRE(result.size() == expected.size());
+
+	int num_different = 0;
+	for (size_t i = 0; i < expected.size(); i++)
+		num_different += int(expected[i] != result[i]);
+	CHECK(num_different == 0);
+
+	// Make sure something was actually rendered, in and outside the clip mask.
+	CHECK(single_thread.Pixel(20, 25) != transparent);
+	CHECK(single_thread.Pixel(90, 80) != single_thread.Pixel(20, 25));
+}
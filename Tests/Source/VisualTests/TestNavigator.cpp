@@ -423,11 +423,26 @@ bool TestNavigator::CaptureCurrentView()
 	return result;
 }
 
-void TestNavigator::StartTestSuiteIteration(IterationState new_iteration_state)
+void TestNavigator::StartTestSuiteIteration(IterationState new_iteration_state, bool all_suites)
 {
 	if (iteration_state != IterationState::None || new_iteration_state == IterationState::None)
 		return;
 
+	iterate_all_suites = all_suites;
+	iteration_failures = 0;
+	if (all_suites)
+		suite_index = 0;
+
+	BeginSuiteIteration(new_iteration_state);
+}
+
+void TestNavigator::SetComparisonThreshold(double threshold)
+{
+	comparison_threshold = Rml::Math::Clamp(threshold, 0.0, 1.0);
+}
+
+void TestNavigator::BeginSuiteIteration(IterationState new_iteration_state)
+{
 	source_state = SourceType::None;
 
 	TestSuite& suite = CurrentSuite();
@@ -447,9 +462,9 @@ void TestNavigator::StartTestSuiteIteration(IterationState new_iteration_state)
 	LoadActiveTest();
 }
 
-static bool SaveFile(const Rml::String& file_path, const Rml::String& contents)
+static bool SaveFile(const Rml::String& file_path, const Rml::String& contents, bool append)
 {
-	std::FILE* file = std::fopen(file_path.c_str(), "wt");
+	std::FILE* file = std::fopen(file_path.c_str(), append ? "at" : "wt");
 	if (!file)
 		return false;
 
@@ -468,6 +483,10 @@ void TestNavigator::StopTestSuiteIteration()
 	TestSuite& suite = CurrentSuite();
 	const int num_tests = suite.GetNumTests();
 	const int num_filtered_tests = suite.GetNumFilteredTests();
+	const bool completed = (iteration_index == num_tests || iteration_index == num_filtered_tests);
+
+	if (!completed)
+		iteration_failures += 1;
 
 	if (iteration_state == IterationState::Capture)
 	{
@@ -496,6 +515,7 @@ void TestNavigator::StopTestSuiteIteration()
 		Rml::Vector<int> not_equal;
 		Rml::Vector<int> failed;
 		Rml::Vector<int> skipped;
+		int num_below_threshold = 0;
 
 		for (int i = 0; i < (int)comparison_results.size(); i++)
 		{
@@ -509,10 +529,16 @@ void TestNavigator::StopTestSuiteIteration()
 				equal.push_back(i);
 			else
 				not_equal.push_back(i);
+
+			if (!comparison.skipped && comparison.success && !comparison.is_equal && comparison.similarity_score < comparison_threshold)
+				num_below_threshold += 1;
 		}
 
-		Rml::String summary = Rml::CreateString("  Total tests: %d\n  Not equal: %d\n  Failed: %d\n  Skipped: %d\n  Equal: %d", num_tests,
-			(int)not_equal.size(), (int)failed.size(), (int)skipped.size(), (int)equal.size());
+		iteration_failures += (int)failed.size() + num_below_threshold;
+
+		Rml::String summary = Rml::CreateString(
+			"  Total tests: %d\n  Not equal: %d\n  Failed: %d\n  Skipped: %d\n  Equal: %d\n  Below threshold (%.1f%%): %d", num_tests,
+			(int)not_equal.size(), (int)failed.size(), (int)skipped.size(), (int)equal.size(), comparison_threshold * 100.0, num_below_threshold);
 
 		if (!suite.GetFilter().empty())
 			summary += "\n  Filter applied: " + suite.GetFilter();
@@ -534,7 +560,7 @@ void TestNavigator::StopTestSuiteIteration()
 		Rml::String log;
 		log.reserve(comparison_results.size() * 100);
 
-		log += "RmlUi VisualTests comparison log output\n---------------------------------------\n\n" + summary;
+		log += "RmlUi VisualTests comparison log output\n---------------------------------------\n\nSuite: " + suite.GetDirectory() + "\n" + summary;
 		log += "\n\nNot Equal:\n";
 
 		if (!not_equal.empty())
@@ -566,15 +592,14 @@ void TestNavigator::StopTestSuiteIteration()
 			suite.SetIndex(i);
 			log += Rml::CreateString("%5d   %s\n", i + 1, suite.GetFilename().c_str());
 		}
-		log += "\nEqual:\n";
-		for (int i : equal)
-		{
-			suite.SetIndex(i);
-			log += Rml::CreateString("%5d   %s\n", i + 1, suite.GetFilename().c_str());
-		}
+
+		// When iterating over all suites, the logs of the following suites are appended to the first one.
+		const bool append_log = (iterate_all_suites && suite_index > 0);
+		if (append_log)
+			log = "\n\n" + log;
 
 		const Rml::String log_path = GetCaptureOutputDirectory() + "/comparison.log";
-		bool save_result = SaveFile(log_path, log);
+		bool save_result = SaveFile(log_path, log, append_log);
 		if (save_result && failed.empty())
 			Rml::Log::Message(Rml::Log::LT_INFO, "Comparison log output written to %s", log_path.c_str());
 		else if (save_result && !failed.empty())
@@ -584,12 +609,22 @@ void TestNavigator::StopTestSuiteIteration()
 			Rml::Log::Message(Rml::Log::LT_ERROR, "Failed writing comparison log output to file %s", log_path.c_str());
 	}
 
+	const IterationState previous_iteration_state = iteration_state;
+	suite.SetIndex(iteration_initial_index);
+
 	iteration_index = -1;
 	iteration_initial_index = -1;
 	iteration_wait_frames = -1;
 	iteration_state = IterationState::None;
 
-	suite.SetIndex(iteration_initial_index);
+	if (iterate_all_suites && completed && suite_index + 1 < (int)test_suites.size())
+	{
+		suite_index += 1;
+		BeginSuiteIteration(previous_iteration_state);
+		return;
+	}
+
+	iterate_all_suites = false;
 	LoadActiveTest();
 }
 
@@ -37,6 +37,8 @@
 
 class TestNavigator : public Rml::EventListener {
 public:
+	enum class IterationState { None, Capture, Comparison };
+
 	TestNavigator(Rml::RenderInterface* render_interface, Rml::Context* context, TestViewer* viewer, TestSuiteList test_suites, int start_suite,
 		int start_case);
 	~TestNavigator();
@@ -45,11 +47,20 @@ public:
 
 	void Render();
 
+	// Captures or compares screenshots of every test in the current suite, over the following updates. With 'all_suites' set, instead starts
+	// from the first suite and continues through every suite in turn.
+	void StartTestSuiteIteration(IterationState iteration_state, bool all_suites = false);
+	bool IsIterating() const { return iteration_state != IterationState::None; }
+
+	// Sets the minimum similarity score in [0, 1] for a comparison to pass. By default, the screen must be identical to the capture.
+	void SetComparisonThreshold(double threshold);
+	// Returns true if the last iteration was aborted, or if any comparison failed or scored below the threshold.
+	bool HasIterationFailures() const { return iteration_failures > 0; }
+
 protected:
 	void ProcessEvent(Rml::Event& event) override;
 
 private:
-	enum class IterationState { None, Capture, Comparison };
 	enum class ReferenceState { None, ShowReference, ShowReferenceHighlight };
 
 	TestSuite& CurrentSuite() { return test_suites[suite_index]; }
@@ -60,7 +71,7 @@ private:
 
 	bool CaptureCurrentView();
 
-	void StartTestSuiteIteration(IterationState iteration_state);
+	void BeginSuiteIteration(IterationState new_iteration_state);
 	void StopTestSuiteIteration();
 
 	void StartGoTo();
@@ -92,6 +103,9 @@ private:
 	int iteration_index = -1;
 	int iteration_initial_index = -1;
 	int iteration_wait_frames = -1;
+	bool iterate_all_suites = false;
+	int iteration_failures = 0;
+	double comparison_threshold = 1.0;
 
 	Rml::Vector<ComparisonResult> comparison_results;
 };
@@ -39,6 +39,7 @@
 #include <RmlUi_Backend.h>
 #include <Shell.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #if defined RMLUI_PLATFORM_WIN32
 	#include <RmlUi_Include_Windows.h>
@@ -48,12 +49,26 @@ int main(int argc, char** argv)
 #endif
 {
 	const char* command_line = nullptr;
+	TestNavigator::IterationState start_iteration = TestNavigator::IterationState::None;
+	double comparison_threshold = 1.0;
 
 #ifdef RMLUI_PLATFORM_WIN32
 	command_line = win_command_line;
 #else
-	if (argc > 1)
-		command_line = argv[1];
+	// Optionally start by capturing or comparing all test suites, then exit when done. Useful for headless backends. A comparison passes when its
+	// similarity score is at least the given threshold, by default only identical images pass. The exit code is non-zero on any failure.
+	for (int i = 1; i < argc; i++)
+	{
+		const Rml::String argument = argv[i];
+		if (argument == "--capture")
+			start_iteration = TestNavigator::IterationState::Capture;
+		else if (argument == "--compare")
+			start_iteration = TestNavigator::IterationState::Comparison;
+		else if (argument.rfind("--threshold=", 0) == 0)
+			comparison_threshold = atof(argument.c_str() + 12);
+		else
+			command_line = argv[i];
+	}
 #endif
 	int load_suite_index = -1;
 	int load_case_index = -1;
@@ -75,6 +90,7 @@ int main(int argc, char** argv)
 		}
 	}
 
+	int exit_code = 0;
 	int window_width = 1500;
 	int window_height = 800;
 
@@ -129,6 +145,9 @@ int main(int argc, char** argv)
 		TestViewer viewer(context);
 
 		TestNavigator navigator(Backend::GetRenderInterface(), context, &viewer, std::move(test_suites), load_suite_index, load_case_index);
+		navigator.SetComparisonThreshold(comparison_threshold);
+		navigator.StartTestSuiteIteration(start_iteration, true);
+		const bool exit_after_iteration = navigator.IsIterating();
 
 		bool running = true;
 		while (running)
@@ -143,12 +162,18 @@ int main(int argc, char** argv)
 			Backend::PresentFrame();
 
 			navigator.Update();
+
+			if (exit_after_iteration && !navigator.IsIterating())
+				running = false;
 		}
+
+		if (exit_after_iteration && navigator.HasIterationFailures())
+			exit_code = 1;
 	}
 
 	Rml::Shutdown();
 	Shell::Shutdown();
 	Backend::Shutdown();
 
-	return 0;
+	return exit_code;
 }